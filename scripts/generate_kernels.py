@@ -0,0 +1,744 @@
+#!/usr/bin/env python
+# Generate the generic kernels (src/sha1-cracker_generic*.c) for all preimage lengths
+#
+# For every length, the word blocks are expanded symbolically: word block t is the
+# set of rotations of the input word blocks it is the XOR of (equal terms cancel).
+# That yields the word blocks that are always zero, the rotations of word block 0
+# every word block depends on (the inner loop precomputation) and the initial step
+# constants that do not depend on the preimage. Lengths with the same schedule
+# share one kernel, the kernel of a slice is picked by its length.
+#
+# Usage: python scripts/generate_kernels.py (run again after changing it)
+import os
+
+MAX_PREIMAGE_LENGTH = 12
+
+K_00_19 = 0x5A827999
+SHA1_IV = [0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0]
+
+SOURCE_DIRECTORY = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src")
+
+LICENSE = """/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+"""
+
+def rotate_left(word, bits):
+    return ((word << bits) | (word >> (32 - bits))) & 0xFFFFFFFF
+
+def f_00_19(mB, mC, mD):
+    return mD ^ (mB & (mC ^ mD))
+
+# Word blocks 0 - 79 as sets of (input word block, rotation)
+def expand_blocks(length):
+    blocks = []
+    for i in range(16):
+        # bytes up to the padding byte and the length word
+        if i <= (length >> 2) or i == 15:
+            blocks.append(frozenset([(i, 0)]))
+        else:
+            blocks.append(frozenset())
+    for i in range(16, 80):
+        terms = blocks[i - 3] ^ blocks[i - 8] ^ blocks[i - 14] ^ blocks[i - 16]
+        blocks.append(frozenset((word, (bits + 1) % 32) for (word, bits) in terms))
+
+    return blocks
+
+# Everything a kernel is specialized on
+class Schedule:
+    def __init__(self, length):
+        blocks = expand_blocks(length)
+        # rotations of word block 0 and whether the precomputed part can be nonzero
+        self.w0 = [sorted(bits for (word, bits) in block if word == 0) for block in blocks]
+        self.precomputed = [any(word != 0 for (word, bits) in block) for block in blocks]
+        self.zero = [not self.w0[i] and not self.precomputed[i] for i in range(80)]
+        # initial step constants (see setupSlice), None if a word block of the slice is added
+        a, b, c, d, e = SHA1_IV
+        constants = [rotate_left(a, 5) + f_00_19(b, c, d) + e + K_00_19,
+                     f_00_19(a, rotate_left(b, 30), c) + d + K_00_19,
+                     c + K_00_19,
+                     rotate_left(b, 30) + K_00_19,
+                     rotate_left(a, 30) + K_00_19]
+        self.constants = [constants[0] & 0xFFFFFFFF]
+        for i in range(1, 5):
+            self.constants.append(None if blocks[i] else constants[i] & 0xFFFFFFFF)
+        self.constants.append(None)
+        for i in range(64, 80):
+            if self.zero[i]:
+                raise ValueError("word block " + str(i) + " is zero, the early exit needs it")
+
+    def key(self):
+        return (tuple(tuple(w0) for w0 in self.w0), tuple(self.precomputed), tuple(self.constants))
+
+# Instruction set specific parts of the kernels
+class Scalar:
+    suffix = "Scalar"
+    lanes = 1
+    type = "uint32_t"
+    prelude = ""
+    rotate = "LEFT_ROTATE"
+    precomputed = "p_precomputedBlocks"
+    slice_precomputed = "p_setup->p_precomputedBlocks"
+
+    def xor(self, terms):
+        return " ^ ".join(terms)
+
+    def set1(self, value):
+        return value
+
+    def macros(self):
+        return """// constants for k-values
+#define K_00_19              UINT32_C(0x5A827999)
+#define K_20_39              UINT32_C(0x6ED9EBA1)
+#define K_40_59              UINT32_C(0x8F1BBCDC)
+#define K_60_79              UINT32_C(0xCA62C1D6)
+
+// macros for f-functions
+#define F_00_19(mB, mC, mD) (mD ^ (mB & (mC ^ mD)))
+#define F_40_59(mB, mC, mD) ((mB & mC) ^ (mD & (mB ^ mC)))
+#define F_REST(mB, mC, mD)  (mB ^ mC ^ mD)
+// macro for circular left-shift of a 32-bit word (taken from RFC 3174)
+#define LEFT_ROTATE(word, bits) (((word) << (bits)) | ((word) >> (32 - (bits))))
+// macros for the different round additions (word blocks 1 - 15 are part of the constants)
+#define ROUND_ADDITION_00                           (ROUND_CONSTANT_00 + p_blocks[0])
+#define ROUND_ADDITION_01(mA)                       (ROUND_CONSTANT_01 + LEFT_ROTATE(mA, 5))
+#define ROUND_ADDITION_02(mA, mB, mC, mD)           (ROUND_CONSTANT_02 + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_03(mA, mB, mC, mD)           (ROUND_CONSTANT_03 + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_04(mA, mB, mC, mD)           (ROUND_CONSTANT_04 + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_05_14(mA, mB, mC, mD, mE)    (K_00_19 + mE + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_15(mA, mB, mC, mD, mE)       (ROUND_CONSTANT_15 + mE + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+// macros for setting state variables in each round
+#define ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition) \\
+    mE = mRoundAddition;                                   \\
+    mB = LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_END(mA, mB, mE, f, k, i)         \\
+    mE = k + mE + LEFT_ROTATE(mA, 5) + f + (p_blocks[i]); \\
+    mB = LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_ZERO(mA, mB, mE, f, k) \\
+    mE = k + mE + LEFT_ROTATE(mA, 5) + f;       \\
+    mB = LEFT_ROTATE(mB, 30);
+// macros for the round functions
+#define ROUND_00_15(mA, mB, mC, mD, mE, mRoundAddition) \\
+    ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition)
+#define ROUND_16_19(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, F_00_19(mB, mC, mD), K_00_19, i)
+#define ROUND_20_39(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, F_REST(mB, mC, mD), K_20_39, i)
+#define ROUND_40_59(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, F_40_59(mB, mC, mD), K_40_59, i)
+#define ROUND_60_79(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, F_REST(mB, mC, mD), K_60_79, i)
+// macros for rounds whose word block is always zero
+#define ROUND_16_19_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_00_19(mB, mC, mD), K_00_19)
+#define ROUND_20_39_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_REST(mB, mC, mD), K_20_39)
+#define ROUND_40_59_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_40_59(mB, mC, mD), K_40_59)
+#define ROUND_60_79_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_REST(mB, mC, mD), K_60_79)
+// macro for rewinding rounds 79 - 76 of a single target (see initTargetSet)
+#define REWIND_ROUNDS_79_76(m74, m73, m72, m71)                                             \\
+    m74 = p_targets->p_rewind[0] - p_blocks[79];                                            \\
+    m73 = p_targets->p_rewind[1] - (p_targets->p_rewind[2] ^ m74) - p_blocks[78];           \\
+    m72 = p_targets->p_rewind[3] - F_REST(p_targets->p_rewind[4], m74, m73) - p_blocks[77]; \\
+    m71 = p_targets->p_rewind[5] - F_REST(LEFT_ROTATE(m74, 2), m73, m72) - p_blocks[76];
+"""
+
+    def declarations(self):
+        return """    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_w0[23],
+                           p_blocks[80],
+                           p_state[5];
+    uint32_t               a, b, c, d, e, temp;
+    // rewound results of rounds 74 - 71 (single target)
+    uint32_t               r74, r73, r72, r71;
+    const struct targetSet *p_targets = p_job->p_targets;
+"""
+
+    def setup(self):
+        return ""
+
+    def loop_start(self):
+        return """    // inner loop through all combinations of input bytes 0 - 3
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low++)
+        {
+            // generate (missing) first word block based on new input
+            p_blocks[0] = p_setup->p_innerHigh[high] | p_setup->p_innerLow[low];
+"""
+
+    def early_exit_single(self):
+        return """                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                if(LIKELY(LEFT_ROTATE(d, 30) != r71))
+                    continue;
+                COUNT(earlyExitPassed, 1);
+"""
+
+    def early_exit_multiple(self):
+        return """                temp = LEFT_ROTATE(a, 30) + p_blocks[79];
+                if(LIKELY(!TARGET_SET_MAY_CONTAIN(p_targets, temp)))
+                    continue;
+                if(!targetSetContainsKey(p_targets, temp))
+                    continue;
+"""
+
+    def report(self):
+        return """            // compare the full state against all targets with this early exit value
+            p_state[0] = a;
+            p_state[1] = b;
+            p_state[2] = c;
+            p_state[3] = d;
+            p_state[4] = e;
+            getSlicePreimage(p_setup,
+                             (uint64_t) high * p_setup->numberOfInnerLow + low,
+                             p_preimage);
+            reportCandidate(p_job,
+                            p_state,
+                            p_preimage,
+                            p_setup->length);
+"""
+
+# Shared by the SSE2 and AVX2 kernels
+class Vector:
+    rotate = "VEC_LEFT_ROTATE"
+    precomputed = "p_vecPrecomputedBlocks"
+    slice_precomputed = "p_vecPrecomputedBlocks"
+
+    def xor(self, terms):
+        # XOR pairs first, so that independent XORs can run in parallel
+        while len(terms) > 1:
+            pairs = ["XOR(" + terms[i] + ", " + terms[i + 1] + ")" for i in range(0, len(terms) - 1, 2)]
+            if len(terms) % 2:
+                pairs[-1] = "XOR(" + pairs[-1] + ", " + terms[-1] + ")"
+            terms = pairs
+
+        return terms[0]
+
+    def set1(self, value):
+        return "SET1INT(" + value + ")"
+
+    def macros(self):
+        return self.intrinsics + """
+// macros for f-functions
+#define VF_00_19(mB, mC, mD) (XOR(mD, (AND(mB, (XOR(mC, mD))))))
+#define VF_40_59(mB, mC, mD) (XOR(AND(mB, mC), (AND(mD, (XOR(mB, mC))))))
+#define VF_REST(mB, mC, mD)  (XOR((XOR(mB, mC)), mD))
+
+// macros for circular left-shift (adapted from RFC 3174)
+#define VEC_LEFT_ROTATE(word, bits) (OR((SLLI((word), (bits))), (SRLI((word), (32 - (bits))))))
+
+// macros for the different round additions (word blocks 1 - 15 are part of the constants)
+#define ROUND_ADDITION_00                           (ADD(ROUND_CONSTANT_00, p_blocks[0]))
+#define ROUND_ADDITION_01(mA)                       (ADD(ROUND_CONSTANT_01, VEC_LEFT_ROTATE(mA, 5)))
+#define ROUND_ADDITION_02(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_02, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_03(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_03, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_04(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_04, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_05_14(mA, mB, mC, mD, mE)    (ADD(ADD(ADD(K_00_19, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_15(mA, mB, mC, mD, mE)       (ADD(ADD(ADD(ROUND_CONSTANT_15, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+
+// macros for setting state variables in each round
+#define ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition) \\
+    mE = mRoundAddition;                                   \\
+    mB = VEC_LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_END(mA, mB, mE, f, k, i)                             \\
+    mE = ADD(ADD(ADD(k, mE), VEC_LEFT_ROTATE(mA, 5)), ADD(f, (p_blocks[i]))); \\
+    mB = VEC_LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_ZERO(mA, mB, mE, f, k)           \\
+    mE = ADD(ADD(ADD(k, mE), VEC_LEFT_ROTATE(mA, 5)), f); \\
+    mB = VEC_LEFT_ROTATE(mB, 30);
+
+// macros for the round functions
+#define ROUND_00_15(mA, mB, mC, mD, mE, mRoundAddition) \\
+    ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition)
+#define ROUND_16_19(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, VF_00_19(mB, mC, mD), K_00_19, i)
+#define ROUND_20_39(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, VF_REST(mB, mC, mD), K_20_39, i)
+#define ROUND_40_59(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, VF_40_59(mB, mC, mD), K_40_59, i)
+#define ROUND_60_79(mA, mB, mC, mD, mE, i) \\
+    ROUND_PROCESSING_END(mA, mB, mE, VF_REST(mB, mC, mD), K_60_79, i)
+// macros for rounds whose word block is always zero
+#define ROUND_16_19_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_00_19(mB, mC, mD), K_00_19)
+#define ROUND_20_39_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_REST(mB, mC, mD), K_20_39)
+#define ROUND_40_59_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_40_59(mB, mC, mD), K_40_59)
+#define ROUND_60_79_ZERO(mA, mB, mC, mD, mE) \\
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_REST(mB, mC, mD), K_60_79)
+// macro for rewinding rounds 79 - 76 of a single target (see initTargetSet)
+#define REWIND_ROUNDS_79_76(m74, m73, m72, m71)                                      \\
+    m74 = SUB(p_vecRewind[0], p_blocks[79]);                                         \\
+    m73 = SUB(SUB(p_vecRewind[1], XOR(p_vecRewind[2], m74)), p_blocks[78]);          \\
+    m72 = SUB(SUB(p_vecRewind[3], VF_REST(p_vecRewind[4], m74, m73)), p_blocks[77]); \\
+    m71 = SUB(SUB(p_vecRewind[5], VF_REST(VEC_LEFT_ROTATE(m74, 2), m73, m72)), p_blocks[76]);
+""" + self.probe
+
+    def declarations(self):
+        lanes = str(self.lanes)
+        return """    int                    index,
+                           mask""" + self.probe_declarations + """;
+    TYPE                a, b, c, d, e, vecTemp;
+    // rewound results of rounds 74 - 71 (single target)
+    TYPE                r74, r73, r72, r71,
+                           p_vecRewind[6];
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_tempSave[LANES],
+                           p_stateSave[5][LANES],
+                           p_state[5];
+    TYPE                p_vecPrecomputedBlocks[80],
+                           p_w0[23],
+                           p_blocks[80];
+    const struct targetSet *p_targets = p_job->p_targets;
+    // constant vectors
+    const TYPE   K_00_19 = SET1INT(0x5A827999),
+                    K_20_39 = SET1INT(0x6ED9EBA1),
+                    K_40_59 = SET1INT(0x8F1BBCDC),
+                    K_60_79 = SET1INT(0xCA62C1D6);
+""".replace("TYPE", self.type).replace("LANES", lanes)
+
+    def setup(self):
+        return """    // precomputed word blocks are the same in all lanes
+    for(index = 16; index < 80; index++)
+        p_vecPrecomputedBlocks[index] = SET1INT(p_setup->p_precomputedBlocks[index]);
+    // only used if there is a single target (see initTargetSet)
+    for(index = 0; index < 6; index++)
+        p_vecRewind[index] = SET1INT(p_targets->p_rewind[index]);
+"""
+
+    def loop_start(self):
+        return """    // inner loop through all combinations of input bytes 0 - 3, WORD low table entries at once
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low += LANES)
+        {
+            // generate (missing) first word blocks based on new input
+            p_blocks[0] = OR(SET1INT(p_setup->p_innerHigh[high]),
+                             LOAD(p_setup->p_innerLow + low));
+""".replace("WORD", self.lanes_word).replace("LANES", str(self.lanes))
+
+    def early_exit_single(self):
+        return """                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                mask = MOVEMASK(CMPEQ(VEC_LEFT_ROTATE(d, 30), r71));
+                if(LIKELY(mask == 0))
+                    continue;
+                COUNT(earlyExitPassed, __builtin_popcount(mask));
+"""
+
+    def early_exit_multiple(self):
+        return """                vecTemp = ADD(VEC_LEFT_ROTATE(a, 30), p_blocks[79]);
+                STORE(p_tempSave, vecTemp);
+                mask = 0;
+                for(index = 0; index < LANES; index++)
+                    if(TARGET_SET_MAY_CONTAIN(p_targets, p_tempSave[index])
+                       && targetSetContainsKey(p_targets, p_tempSave[index]))
+                        mask |= 1 << index;
+                if(LIKELY(mask == 0))
+                    continue;
+""".replace("LANES", str(self.lanes))
+
+    def report(self):
+        return """            STORE(p_stateSave[0], a);
+            STORE(p_stateSave[1], b);
+            STORE(p_stateSave[2], c);
+            STORE(p_stateSave[3], d);
+            STORE(p_stateSave[4], e);
+            // compare the full state of every remaining lane against the targets
+            for(index = 0; index < LANES; index++)
+            {
+                // lanes past the end of the low table repeat its last entry
+                if(!(mask & (1 << index)) || low + index >= p_setup->numberOfInnerLow)
+                    continue;
+                p_state[0] = p_stateSave[0][index];
+                p_state[1] = p_stateSave[1][index];
+                p_state[2] = p_stateSave[2][index];
+                p_state[3] = p_stateSave[3][index];
+                p_state[4] = p_stateSave[4][index];
+                getSlicePreimage(p_setup,
+                                 (uint64_t) high * p_setup->numberOfInnerLow + low + index,
+                                 p_preimage);
+                reportCandidate(p_job,
+                                p_state,
+                                p_preimage,
+                                p_setup->length);
+            }
+""".replace("LANES", str(self.lanes))
+
+class Sse2(Vector):
+    suffix = "Sse2"
+    lanes = 4
+    lanes_word = "four"
+    type = "__m128i"
+    # SSE2 has no gathers, the filter is probed lane by lane
+    probe = ""
+    probe_declarations = ""
+    prelude = """// compile this kernel for SSE2, it is only called if the CPU supports it
+#pragma GCC target("sse2")
+// SSE2 intrinsics
+#include <emmintrin.h>
+"""
+    intrinsics = """// macros for SSE2 intrinsics
+#define OR(x, y)                        (_mm_or_si128(x, y))
+#define XOR(x, y)                       (_mm_xor_si128(x, y))
+#define AND(x, y)                       (_mm_and_si128(x, y))
+#define ADD(x, y)                       (_mm_add_epi32(x, y))
+#define SUB(x, y)                       (_mm_sub_epi32(x, y))
+#define SLLI(x, bits)                   (_mm_slli_epi32(x, bits))
+#define SRLI(x, bits)                   (_mm_srli_epi32(x, bits))
+#define SET1INT(x)                      (_mm_set1_epi32(x))
+#define STORE(loc, x)                   (_mm_storeu_si128(((__m128i *) loc), x))
+#define LOAD(loc)                       (_mm_loadu_si128((const __m128i *) (loc)))
+#define CMPEQ(x, y)                     (_mm_cmpeq_epi32(x, y))
+#define MOVEMASK(x)                     (_mm_movemask_ps(_mm_castsi128_ps(x)))
+"""
+
+class Avx2(Vector):
+    suffix = "Avx2"
+    lanes = 8
+    lanes_word = "eight"
+    type = "__m256i"
+    probe = """// macros for probing the filter of a target set with all lanes at once (see TARGET_SET_MAY_CONTAIN)
+#define VEC_FILTER_BIT(mHash, bits) \\
+    (_mm256_sllv_epi32(SET1INT(1), AND(SRLI((mHash), (bits)), SET1INT(31))))
+#define PROBE_FILTER(p_set, mKey, mBits, passed)                                                        \\
+    mBits  = _mm256_mullo_epi32((mKey), SET1INT(TARGET_FILTER_MULTIPLIER));                             \\
+    mBits  = OR(OR(VEC_FILTER_BIT(mBits, 27), VEC_FILTER_BIT(mBits, 22)), VEC_FILTER_BIT(mBits, 17));   \\
+    passed = MOVEMASK(CMPEQ(AND(_mm256_i32gather_epi32((const int *) (p_set)->p_filter,                 \\
+                                                       AND((mKey), SET1INT((p_set)->filterMask)), 4),   \\
+                                mBits),                                                                 \\
+                            mBits));
+"""
+    probe_declarations = """,
+                           passed;
+    __m256i                vecBits"""
+
+    def early_exit_multiple(self):
+        return """                vecTemp = ADD(VEC_LEFT_ROTATE(a, 30), p_blocks[79]);
+                PROBE_FILTER(p_targets, vecTemp, vecBits, passed)
+                if(LIKELY(passed == 0))
+                    continue;
+                STORE(p_tempSave, vecTemp);
+                mask = 0;
+                for(index = 0; index < 8; index++)
+                    if((passed & (1 << index)) && targetSetContainsKey(p_targets, p_tempSave[index]))
+                        mask |= 1 << index;
+                if(LIKELY(mask == 0))
+                    continue;
+"""
+    prelude = """// compile this kernel for AVX2, it is only called if the CPU supports it
+#pragma GCC target("avx2")
+// AVX2 (and other) intrinsics
+#include <immintrin.h>
+"""
+    intrinsics = """// macros for AVX2 intrinsics
+#define OR(x, y)                        (_mm256_or_si256(x, y))
+#define XOR(x, y)                       (_mm256_xor_si256(x, y))
+#define AND(x, y)                       (_mm256_and_si256(x, y))
+#define ADD(x, y)                       (_mm256_add_epi32(x, y))
+#define SUB(x, y)                       (_mm256_sub_epi32(x, y))
+#define SLLI(x, bits)                   (_mm256_slli_epi32(x, bits))
+#define SRLI(x, bits)                   (_mm256_srli_epi32(x, bits))
+#define SET1INT(x)                      (_mm256_set1_epi32(x))
+#define STORE(loc, x)                   (_mm256_storeu_si256(((__m256i *) loc), x))
+#define LOAD(loc)                       (_mm256_loadu_si256((const __m256i *) (loc)))
+#define CMPEQ(x, y)                     (_mm256_cmpeq_epi32(x, y))
+#define MOVEMASK(x)                     (_mm256_movemask_ps(_mm256_castsi256_ps(x)))
+"""
+
+ROUND_GROUPS = [(16, 20, "ROUND_16_19"), (20, 40, "ROUND_20_39"), (40, 60, "ROUND_40_59"), (60, 80, "ROUND_60_79")]
+STATE = ["a", "b", "c", "d", "e"]
+
+def round_name(i):
+    for (first, end, name) in ROUND_GROUPS:
+        if first <= i < end:
+            return name
+
+# Round i, the state variables rotate by one every round
+def emit_round(schedule, i):
+    offset = (5 - i % 5) % 5
+    state = ", ".join(STATE[(offset + j) % 5] for j in range(5))
+    if schedule.zero[i]:
+        return round_name(i) + "_ZERO(" + state + ")"
+
+    return round_name(i) + "(" + state + ", " + str(i) + ")"
+
+def block_expression(isa, schedule, i, precomputed):
+    terms = []
+    if schedule.precomputed[i]:
+        terms.append(precomputed + "[" + str(i) + "]")
+    terms += ["p_w0[" + str(bits) + "]" for bits in schedule.w0[i]]
+
+    return isa.xor(terms)
+
+def emit_blocks(isa, schedule, first, end):
+    lines = []
+    for i in range(first, end):
+        if not schedule.zero[i]:
+            lines.append("    p_blocks[" + str(i) + "] = " + block_expression(isa, schedule, i, isa.precomputed) + ";")
+
+    return "\n".join(lines) + "\n"
+
+def lengths_name(lengths):
+    if len(lengths) == 1:
+        return "Length" + str(lengths[0])
+
+    return "Length" + str(lengths[0]) + "To" + str(lengths[-1])
+
+def lengths_text(lengths):
+    if len(lengths) == 1:
+        return "length " + str(lengths[0])
+
+    return "lengths " + str(lengths[0]) + " - " + str(lengths[-1])
+
+def emit_prototypes(isa, name):
+    lines = []
+    for function in ["precomputeInnerLoop", "precomputeBlocks72To75", "precomputeBlocks76To79"]:
+        head = "static inline void " + function + name + "("
+        indent = " " * len(head)
+        lines.append(head + "const " + isa.type + " *" + isa.precomputed + ",")
+        lines.append(indent + isa.type.ljust(len(isa.type) + 6) + " *p_w0,")
+        lines.append(indent + isa.type.ljust(len(isa.type) + 6) + " *p_blocks);")
+
+    return "\n".join(lines) + "\n"
+
+def emit_precompute(isa, schedule, name):
+    rotations = sorted(set(bits for w0 in schedule.w0[16:80] for bits in w0))
+    lines = []
+    parameters = """(
+    const TYPE *PRECOMPUTED,
+    TYPE       *p_w0,
+    TYPE       *p_blocks
+)
+{
+""".replace("TYPE", isa.type).replace("PRECOMPUTED", isa.precomputed)
+    # inner loop
+    lines.append("/**\n * Function: precomputeInnerLoop" + name + "\n */")
+    lines.append("static inline void precomputeInnerLoop" + name)
+    lines.append(parameters + "    // rotate w0")
+    for bits in rotations:
+        lines.append("    p_w0[" + str(bits).rjust(2) + "] = " + isa.rotate + "(p_blocks[0], " + str(bits).rjust(2) + ");")
+    lines.append("    // word blocks of rounds 16 - 71, word blocks that are always zero are left out")
+    lines.append(emit_blocks(isa, schedule, 16, 72) + "}")
+    # early exit
+    lines.append("/**\n * Function: precomputeBlocks72To75" + name + "\n */")
+    lines.append("static inline void precomputeBlocks72To75" + name)
+    lines.append(parameters + "    // word blocks of rounds 72 - 75 (see precomputeInnerLoop" + name + ")")
+    lines.append(emit_blocks(isa, schedule, 72, 76) + "}")
+    lines.append("/**\n * Function: precomputeBlocks76To79" + name + "\n */")
+    lines.append("static inline void precomputeBlocks76To79" + name)
+    lines.append(parameters + "    // word blocks of rounds 76 - 79 (see precomputeInnerLoop" + name + ")")
+    lines.append(emit_blocks(isa, schedule, 76, 80) + "}")
+
+    return "\n".join(lines) + "\n"
+
+def emit_kernel(isa, schedule, lengths):
+    name = lengths_name(lengths)
+    calls = {}
+    for function in ["precomputeInnerLoop", "precomputeBlocks72To75", "precomputeBlocks76To79"]:
+        head = function + name + "("
+        indent = " " * len(head)
+        calls[function] = (head + isa.slice_precomputed + ",\n" + "INDENT" + indent + "p_w0,\n"
+                           + "INDENT" + indent + "p_blocks);")
+    text = "/**\n * Function: crackSlice" + name + "\n */\n"
+    text += "static int crackSlice" + name + "\n(\n"
+    text += "    struct crackJob         *p_job,\n    const struct sliceSetup *p_setup\n)\n{\n"
+    text += isa.declarations()
+    # initial step constants
+    text += "    // initial step constants, the ones without word blocks of the slice are the same for all slices\n"
+    constants = []
+    for (i, constant) in enumerate(schedule.constants):
+        label = "ROUND_CONSTANT_" + ("15" if i == 5 else "0" + str(i))
+        if constant is None:
+            value = isa.set1("p_setup->p_roundConstants[" + str(i) + "]")
+        else:
+            value = isa.set1("UINT32_C(0x%08X)" % constant)
+        constants.append(label + " = " + value)
+    head = "    const " + isa.type.ljust(len(isa.type) + 2) + " "
+    text += head + (",\n" + " " * len(head)).join(constants) + ";\n"
+    text += isa.setup()
+    text += isa.loop_start()
+    text += """            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            """ + calls["precomputeInnerLoop"].replace("INDENT", " " * 12) + """
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, """ + str(isa.lanes) + """);
+            // initialize state variables with constants
+            a = """ + isa.set1("SHA1_IV_0") + """;
+            b = """ + isa.set1("SHA1_IV_1") + """;
+            c = """ + isa.set1("SHA1_IV_2") + """;
+            d = """ + isa.set1("SHA1_IV_3") + """;
+            e = """ + isa.set1("SHA1_IV_4") + """;
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+"""
+    for i in range(5, 15):
+        offset = (5 - i % 5) % 5
+        state = ", ".join(STATE[(offset + j) % 5] for j in range(5))
+        text += "            ROUND_00_15(" + state + ", ROUND_ADDITION_05_14(" + state + "))\n"
+    text += """            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+"""
+    for (first, end, group) in ROUND_GROUPS:
+        text += "            // rounds " + str(first) + " - " + str(min(end, 72) - 1) + "\n"
+        for i in range(first, min(end, 72)):
+            text += "            " + emit_round(schedule, i) + "\n"
+    text += """            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                """ + calls["precomputeBlocks76To79"].replace("INDENT", " " * 16) + """
+""" + isa.early_exit_single() + """                """ + calls["precomputeBlocks72To75"].replace("INDENT", " " * 16) + """
+                """ + emit_round(schedule, 72) + """
+                """ + emit_round(schedule, 73) + """
+                """ + emit_round(schedule, 74) + """
+            }
+            else
+            {
+                """ + calls["precomputeBlocks72To75"].replace("INDENT", " " * 16) + """
+                p_blocks[79] = """ + block_expression(isa, schedule, 79, isa.slice_precomputed) + """;
+                """ + emit_round(schedule, 72) + """
+                """ + emit_round(schedule, 73) + """
+                """ + emit_round(schedule, 74) + """
+""" + isa.early_exit_multiple() + """                """ + calls["precomputeBlocks76To79"].replace("INDENT", " " * 16) + """
+            }
+            // rounds 75 - 79
+"""
+    for i in range(75, 80):
+        text += "            " + emit_round(schedule, i) + "\n"
+    text += "            /**************************************************************/\n"
+    text += isa.report()
+    text += """            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+"""
+
+    return text
+
+def emit_file(isa, groups):
+    text = LICENSE
+    text += """/*
+ *  Generated by scripts/generate_kernels.py, do not edit.
+ *
+ *  Generic kernel for arbitrary keyspaces, specialized per preimage length:
+"""
+    for (schedule, lengths) in groups:
+        zero = [str(i) for i in range(16, 80) if schedule.zero[i]]
+        text += " *  - " + lengths_text(lengths) + ": "
+        text += ("word blocks " + ", ".join(zero) + " are always zero") if zero else "no word block 16 - 79 is always zero"
+        precomputed = len([i for i in range(16, 80) if not schedule.precomputed[i] and not schedule.zero[i]])
+        if precomputed:
+            text += ", " + str(precomputed) + " only depend on word block 0"
+        constants = [str(i) for i in range(1, 5) if schedule.constants[i] is not None]
+        if constants:
+            if len(constants) == 1:
+                text += ", initial step constant " + constants[0] + " is fixed"
+            else:
+                text += ", initial step constants " + ", ".join(constants) + " are fixed"
+        text += "\n"
+    text += " */\n#include \"sha1-cracker.h\"\n"
+    text += isa.prelude + "\n"
+    text += isa.macros()
+    text += """
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+
+// function prototypes
+"""
+    for (schedule, lengths) in groups:
+        name = lengths_name(lengths)
+        text += "static int crackSlice" + name + "(struct crackJob         *p_job,\n"
+        text += " " * len("static int crackSlice" + name + "(") + "const struct sliceSetup *p_setup);\n"
+        text += emit_prototypes(isa, name)
+    text += """
+/**
+ * Function: crackSliceGeneric""" + isa.suffix + """
+ */
+int crackSliceGeneric""" + isa.suffix + """
+(
+    struct crackJob *p_job,
+    uint64_t        slice
+)
+{
+    struct sliceSetup setup;
+    // outer loop bytes, padding and initial step constants of the slice
+    CYCLES_START(outerStart);
+    setupSlice(p_job->p_layout,
+               slice,
+               &setup);
+    CYCLES_STOP(outerCycles, outerStart);
+    COUNT(outerPrecomputes, 1);
+    // every preimage length has its own kernel (lengths with the same schedule share one)
+    switch(setup.length)
+    {
+"""
+    for (index, (schedule, lengths)) in enumerate(groups):
+        for length in lengths:
+            if index == len(groups) - 1 and length == lengths[-1]:
+                text += "        default:\n"
+            else:
+                text += "        case " + str(length) + ":\n"
+        text += "            return crackSlice" + lengths_name(lengths) + "(p_job,\n"
+        text += " " * len("            return crackSlice" + lengths_name(lengths) + "(") + "&setup);\n"
+    text += "    }\n}\n"
+    for (schedule, lengths) in groups:
+        text += emit_kernel(isa, schedule, lengths)
+    for (schedule, lengths) in groups:
+        text += emit_precompute(isa, schedule, lengths_name(lengths))
+
+    return text
+
+# Group consecutive lengths with the same schedule
+groups = []
+for length in range(1, MAX_PREIMAGE_LENGTH + 1):
+    schedule = Schedule(length)
+    if groups and groups[-1][0].key() == schedule.key():
+        groups[-1][1].append(length)
+    else:
+        groups.append((schedule, [length]))
+
+for (isa, fileName) in [(Scalar(), "sha1-cracker_generic.c"),
+                        (Sse2(), "sha1-cracker_generic_sse2.c"),
+                        (Avx2(), "sha1-cracker_generic_avx2.c")]:
+    with open(os.path.join(SOURCE_DIRECTORY, fileName), "w") as output:
+        output.write(emit_file(isa, groups))
+    print("Generated src/" + fileName + ": " + ", ".join(lengths_text(lengths) for (schedule, lengths) in groups))
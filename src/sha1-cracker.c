@@ -34,8 +34,7 @@
 #define ROUND_CONSTANT_03    UINT32_C(0x0D675E47B)
 #define ROUND_CONSTANT_04    UINT32_C(0x0B453C259)
 #define ROUND_CONSTANT_15    UINT32_C(0x05A8279C9)
-// length of preimage (always 6 bytes)
-#define PREIMAGE_LENGTH_BYTE                   6
+// length of preimage in bits (always 6 bytes)
 #define PREIMAGE_LENGTH_BIT  UINT32_C(0x00000030)
 
 // macros for f-functions
@@ -70,12 +69,24 @@
     ROUND_PROCESSING_END(mA, mB, mE, F_40_59(mB, mC, mD), K_40_59, i)
 #define ROUND_60_79(mA, mB, mC, mD, mE, i) \
     ROUND_PROCESSING_END(mA, mB, mE, F_REST(mB, mC, mD), K_60_79, i)
+// macro for rewinding rounds 79 - 76 of a single target (see initTargetSet)
+#define REWIND_ROUNDS_79_76(m74, m73, m72, m71)                                             \
+    m74 = p_targets->p_rewind[0] - p_blocks[79];                                            \
+    m73 = p_targets->p_rewind[1] - (p_targets->p_rewind[2] ^ m74) - p_blocks[78];           \
+    m72 = p_targets->p_rewind[3] - F_REST(p_targets->p_rewind[4], m74, m73) - p_blocks[77]; \
+    m71 = p_targets->p_rewind[5] - F_REST(LEFT_ROTATE(m74, 2), m73, m72) - p_blocks[76];
 
 // function prototypes
 static inline void precomputeOuterLoop(uint32_t *p_precomputedBlocks);
 static inline void precomputeInnerLoop(uint32_t *p_precomputedBlocks,
                                        uint32_t *p_w0,
                                        uint32_t *p_blocks);
+static inline void precomputeBlocks72To75(uint32_t *p_precomputedBlocks,
+                                          uint32_t *p_w0,
+                                          uint32_t *p_blocks);
+static inline void precomputeBlocks76To79(uint32_t *p_precomputedBlocks,
+                                          uint32_t *p_w0,
+                                          uint32_t *p_blocks);
 // skeleton for word blocks that already contains the correct padding
 static const uint32_t p_blocksSkeleton[16] = {  0u, UINT32_C(0x8000), 0u,
                                                 0u, 0u, 0u, 0u, 0u,   0u,
@@ -83,198 +94,216 @@ static const uint32_t p_blocksSkeleton[16] = {  0u, UINT32_C(0x8000), 0u,
                                                 PREIMAGE_LENGTH_BIT };
 
 /**
- * Function: crackHash
+ * Function: crackSliceScalar
  */
-int crackHash
+int crackSliceScalar
 (
-    struct hash targetHash,
-    char        *p_result
+    struct crackJob *p_job,
+    uint64_t        slice
 )
 {
-           char     p_currInput[6];
-           uint32_t p_precomputedBlocks[80],
-                    p_w0[21],
-                    p_blocks[80],
-                    p_earlyExit[5];
-    static uint32_t a, b, c, d, e, temp;
-    // precompute early exit values
-    p_earlyExit[0] = targetHash.a - SHA1_IV_0;
-    p_earlyExit[1] = targetHash.b - SHA1_IV_1;
-    p_earlyExit[2] = targetHash.c - SHA1_IV_2;
-    p_earlyExit[3] = targetHash.d - SHA1_IV_3;
-    p_earlyExit[4] = targetHash.e - SHA1_IV_4;
-    // values c, d, e are rotated by 30 - rotate by 2 more to undo
-    p_earlyExit[2] = LEFT_ROTATE(p_earlyExit[2], 2);
-    p_earlyExit[3] = LEFT_ROTATE(p_earlyExit[3], 2);
-    p_earlyExit[4] = LEFT_ROTATE(p_earlyExit[4], 2);
-    // outer loop through all two letter combinations from 'a' to 'z'
-    for (p_currInput[4] = 'a'; p_currInput[4] <= 'z'; p_currInput[4]++)
-        for (p_currInput[5] = 'a'; p_currInput[5] <= 'z'; p_currInput[5]++)
-        {
-            // reset precomputed word blocks
-            memcpy(p_precomputedBlocks,
-                   p_blocksSkeleton,
-                   64);
-            // set second word block based on input
-            p_precomputedBlocks[1] |= (p_currInput[4] << 24) 
-                                   |  (p_currInput[5] << 16);
-            // precompute word blocks for outer loop
-            precomputeOuterLoop(p_precomputedBlocks);
-            // inner loop through all four letter combinations from 'a' to 'z'
-            for (p_currInput[0] = 'a'; p_currInput[0] <= 'z'; p_currInput[0]++)
-                for (p_currInput[1] = 'a'; p_currInput[1] <= 'z'; p_currInput[1]++)
-                    for (p_currInput[2] = 'a'; p_currInput[2] <= 'z'; p_currInput[2]++)
-                        for (p_currInput[3] = 'a'; p_currInput[3] <= 'z'; p_currInput[3]++)
-                        {
-                            // reset first 16 word blocks
-                            memcpy(p_blocks,
-                                   p_precomputedBlocks,
-                                   64);
-                            // generate (missing) first word block based on new input
-                            p_blocks[0] =  (p_currInput[0] << 24)
-                                        |  (p_currInput[1] << 16)
-                                        |  (p_currInput[2] << 8)
-                                        |  (p_currInput[3]);
-                            // precompute word blocks for inner loop
-                            precomputeInnerLoop(p_precomputedBlocks,
-                                                p_w0,
-                                                p_blocks);
-                            // initialize state variables with constants
-                            a = SHA1_IV_0;
-                            b = SHA1_IV_1;
-                            c = SHA1_IV_2;
-                            d = SHA1_IV_3;
-                            e = SHA1_IV_4;
-                            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
-                            // round 00
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
-                            // round 01
-                            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
-                            // round 02
-                            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
-                            // round 03
-                            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
-                            // round 04
-                            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
-                            // rounds 05 - 14
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
-                            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
-                            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
-                            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
-                            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
-                            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
-                            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
-                            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
-                            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
-                            // round 15
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
-                            // rounds 16 - 19
-                            ROUND_16_19(e, a, b, c, d, 16)
-                            ROUND_16_19(d, e, a, b, c, 17)
-                            ROUND_16_19(c, d, e, a, b, 18)
-                            ROUND_16_19(b, c, d, e, a, 19)
-                            // rounds 20 - 39
-                            ROUND_20_39(a, b, c, d, e, 20)
-                            ROUND_20_39(e, a, b, c, d, 21)
-                            ROUND_20_39(d, e, a, b, c, 22)
-                            ROUND_20_39(c, d, e, a, b, 23)
-                            ROUND_20_39(b, c, d, e, a, 24)
-                            ROUND_20_39(a, b, c, d, e, 25)
-                            ROUND_20_39(e, a, b, c, d, 26)
-                            ROUND_20_39(d, e, a, b, c, 27)
-                            ROUND_20_39(c, d, e, a, b, 28)
-                            ROUND_20_39(b, c, d, e, a, 29)
-                            ROUND_20_39(a, b, c, d, e, 30)
-                            ROUND_20_39(e, a, b, c, d, 31)
-                            ROUND_20_39(d, e, a, b, c, 32)
-                            ROUND_20_39(c, d, e, a, b, 33)
-                            ROUND_20_39(b, c, d, e, a, 34)
-                            ROUND_20_39(a, b, c, d, e, 35)
-                            ROUND_20_39(e, a, b, c, d, 36)
-                            ROUND_20_39(d, e, a, b, c, 37)
-                            ROUND_20_39(c, d, e, a, b, 38)
-                            ROUND_20_39(b, c, d, e, a, 39)
-                            // rounds 40 - 59
-                            ROUND_40_59(a, b, c, d, e, 40)
-                            ROUND_40_59(e, a, b, c, d, 41)
-                            ROUND_40_59(d, e, a, b, c, 42)
-                            ROUND_40_59(c, d, e, a, b, 43)
-                            ROUND_40_59(b, c, d, e, a, 44)
-                            ROUND_40_59(a, b, c, d, e, 45)
-                            ROUND_40_59(e, a, b, c, d, 46)
-                            ROUND_40_59(d, e, a, b, c, 47)
-                            ROUND_40_59(c, d, e, a, b, 48)
-                            ROUND_40_59(b, c, d, e, a, 49)
-                            ROUND_40_59(a, b, c, d, e, 50)
-                            ROUND_40_59(e, a, b, c, d, 51)
-                            ROUND_40_59(d, e, a, b, c, 52)
-                            ROUND_40_59(c, d, e, a, b, 53)
-                            ROUND_40_59(b, c, d, e, a, 54)
-                            ROUND_40_59(a, b, c, d, e, 55)
-                            ROUND_40_59(e, a, b, c, d, 56)
-                            ROUND_40_59(d, e, a, b, c, 57)
-                            ROUND_40_59(c, d, e, a, b, 58)
-                            ROUND_40_59(b, c, d, e, a, 59)
-                            // rounds 60 - 79
-                            ROUND_60_79(a, b, c, d, e, 60)
-                            ROUND_60_79(e, a, b, c, d, 61)
-                            ROUND_60_79(d, e, a, b, c, 62)
-                            ROUND_60_79(c, d, e, a, b, 63)
-                            ROUND_60_79(b, c, d, e, a, 64)
-                            ROUND_60_79(a, b, c, d, e, 65)
-                            ROUND_60_79(e, a, b, c, d, 66)
-                            ROUND_60_79(d, e, a, b, c, 67)
-                            ROUND_60_79(c, d, e, a, b, 68)
-                            ROUND_60_79(b, c, d, e, a, 69)
-                            ROUND_60_79(a, b, c, d, e, 70)
-                            ROUND_60_79(e, a, b, c, d, 71)
-                            ROUND_60_79(d, e, a, b, c, 72)
-                            ROUND_60_79(c, d, e, a, b, 73)
-                            ROUND_60_79(b, c, d, e, a, 74)
-                            /**************************************************************/
-                            // round 75
-                            ROUND_60_79(a, b, c, d, e, 75)
-                            if(e != p_earlyExit[4])
-                                continue;
-                            // round 76
-                            temp = p_blocks[73] ^ p_blocks[68] ^ p_blocks[62] ^ p_blocks[60];
-                            p_blocks[76] = LEFT_ROTATE(temp, 1);
-                            ROUND_60_79(e, a, b, c, d, 76)
-                            if(d != p_earlyExit[3])
-                                continue;
-                            // round 77
-                            temp = p_blocks[74] ^ p_blocks[69] ^ p_blocks[63] ^ p_blocks[61];
-                            p_blocks[77] = LEFT_ROTATE(temp, 1);
-                            ROUND_60_79(d, e, a, b, c, 77)
-                            if(c != p_earlyExit[2])
-                                continue;
-                            // round 78
-                            temp = p_blocks[75] ^ p_blocks[70] ^ p_blocks[64] ^ p_blocks[62];
-                            p_blocks[78] = LEFT_ROTATE(temp, 1);
-                            ROUND_60_79(c, d, e, a, b, 78)
-                            if(b != p_earlyExit[1])
-                                continue;
-                            // round 79
-                            temp = p_blocks[76] ^ p_blocks[71] ^ p_blocks[65] ^ p_blocks[63];
-                            p_blocks[79] = LEFT_ROTATE(temp, 1);
-                            ROUND_60_79(b, c, d, e, a, 79)
-                            if(a != p_earlyExit[0])
-                                continue;
-                            // if we end up here, the target hash was found
-                            goto success;
-                        }
-        }
-    // if we end up here, no preimage was found
+    char                   p_currInput[6];
+    uint32_t               p_precomputedBlocks[80],
+                           p_w0[23],
+                           p_blocks[80],
+                           p_state[5];
+    uint32_t               a, b, c, d, e, temp;
+    // rewound results of rounds 74 - 71 (single target)
+    uint32_t               r74, r73, r72, r71;
+    const struct targetSet *p_targets = p_job->p_targets;
+    // the slice selects one of the two letter combinations of the outer loop
+    p_currInput[4] = 'a' + slice / 26;
+    p_currInput[5] = 'a' + slice % 26;
+    // reset precomputed word blocks
+    memcpy(p_precomputedBlocks,
+           p_blocksSkeleton,
+           64);
+    // set second word block based on input
+    p_precomputedBlocks[1] |= (p_currInput[4] << 24) 
+                           |  (p_currInput[5] << 16);
+    // precompute word blocks for outer loop
+    CYCLES_START(outerStart);
+    precomputeOuterLoop(p_precomputedBlocks);
+    CYCLES_STOP(outerCycles, outerStart);
+    COUNT(outerPrecomputes, 1);
+    // inner loop through all four letter combinations from 'a' to 'z'
+    for (p_currInput[0] = 'a'; p_currInput[0] <= 'z'; p_currInput[0]++)
+        for (p_currInput[1] = 'a'; p_currInput[1] <= 'z'; p_currInput[1]++)
+            for (p_currInput[2] = 'a'; p_currInput[2] <= 'z'; p_currInput[2]++)
+                for (p_currInput[3] = 'a'; p_currInput[3] <= 'z'; p_currInput[3]++)
+                {
+                    // reset first 16 word blocks
+                    memcpy(p_blocks,
+                           p_precomputedBlocks,
+                           64);
+                    // generate (missing) first word block based on new input
+                    p_blocks[0] =  (p_currInput[0] << 24)
+                                |  (p_currInput[1] << 16)
+                                |  (p_currInput[2] << 8)
+                                |  (p_currInput[3]);
+                    // precompute word blocks for inner loop
+                    CYCLES_START(innerStart);
+                    precomputeInnerLoop(p_precomputedBlocks,
+                                        p_w0,
+                                        p_blocks);
+                    CYCLES_STOP(innerCycles, innerStart);
+                    COUNT(innerPrecomputes, 1);
+                    COUNT(candidates, 1);
+                    // initialize state variables with constants
+                    a = SHA1_IV_0;
+                    b = SHA1_IV_1;
+                    c = SHA1_IV_2;
+                    d = SHA1_IV_3;
+                    e = SHA1_IV_4;
+                    /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+                    // round 00
+                    ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+                    // round 01
+                    ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+                    // round 02
+                    ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+                    // round 03
+                    ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+                    // round 04
+                    ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+                    // rounds 05 - 14
+                    ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+                    ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+                    ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+                    ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+                    ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+                    ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+                    ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+                    ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+                    ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+                    ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+                    // round 15
+                    ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+                    // rounds 16 - 19
+                    ROUND_16_19(e, a, b, c, d, 16)
+                    ROUND_16_19(d, e, a, b, c, 17)
+                    ROUND_16_19(c, d, e, a, b, 18)
+                    ROUND_16_19(b, c, d, e, a, 19)
+                    // rounds 20 - 39
+                    ROUND_20_39(a, b, c, d, e, 20)
+                    ROUND_20_39(e, a, b, c, d, 21)
+                    ROUND_20_39(d, e, a, b, c, 22)
+                    ROUND_20_39(c, d, e, a, b, 23)
+                    ROUND_20_39(b, c, d, e, a, 24)
+                    ROUND_20_39(a, b, c, d, e, 25)
+                    ROUND_20_39(e, a, b, c, d, 26)
+                    ROUND_20_39(d, e, a, b, c, 27)
+                    ROUND_20_39(c, d, e, a, b, 28)
+                    ROUND_20_39(b, c, d, e, a, 29)
+                    ROUND_20_39(a, b, c, d, e, 30)
+                    ROUND_20_39(e, a, b, c, d, 31)
+                    ROUND_20_39(d, e, a, b, c, 32)
+                    ROUND_20_39(c, d, e, a, b, 33)
+                    ROUND_20_39(b, c, d, e, a, 34)
+                    ROUND_20_39(a, b, c, d, e, 35)
+                    ROUND_20_39(e, a, b, c, d, 36)
+                    ROUND_20_39(d, e, a, b, c, 37)
+                    ROUND_20_39(c, d, e, a, b, 38)
+                    ROUND_20_39(b, c, d, e, a, 39)
+                    // rounds 40 - 59
+                    ROUND_40_59(a, b, c, d, e, 40)
+                    ROUND_40_59(e, a, b, c, d, 41)
+                    ROUND_40_59(d, e, a, b, c, 42)
+                    ROUND_40_59(c, d, e, a, b, 43)
+                    ROUND_40_59(b, c, d, e, a, 44)
+                    ROUND_40_59(a, b, c, d, e, 45)
+                    ROUND_40_59(e, a, b, c, d, 46)
+                    ROUND_40_59(d, e, a, b, c, 47)
+                    ROUND_40_59(c, d, e, a, b, 48)
+                    ROUND_40_59(b, c, d, e, a, 49)
+                    ROUND_40_59(a, b, c, d, e, 50)
+                    ROUND_40_59(e, a, b, c, d, 51)
+                    ROUND_40_59(d, e, a, b, c, 52)
+                    ROUND_40_59(c, d, e, a, b, 53)
+                    ROUND_40_59(b, c, d, e, a, 54)
+                    ROUND_40_59(a, b, c, d, e, 55)
+                    ROUND_40_59(e, a, b, c, d, 56)
+                    ROUND_40_59(d, e, a, b, c, 57)
+                    ROUND_40_59(c, d, e, a, b, 58)
+                    ROUND_40_59(b, c, d, e, a, 59)
+                    // rounds 60 - 79
+                    ROUND_60_79(a, b, c, d, e, 60)
+                    ROUND_60_79(e, a, b, c, d, 61)
+                    ROUND_60_79(d, e, a, b, c, 62)
+                    ROUND_60_79(c, d, e, a, b, 63)
+                    ROUND_60_79(b, c, d, e, a, 64)
+                    ROUND_60_79(a, b, c, d, e, 65)
+                    ROUND_60_79(e, a, b, c, d, 66)
+                    ROUND_60_79(d, e, a, b, c, 67)
+                    ROUND_60_79(c, d, e, a, b, 68)
+                    ROUND_60_79(b, c, d, e, a, 69)
+                    ROUND_60_79(a, b, c, d, e, 70)
+                    ROUND_60_79(e, a, b, c, d, 71)
+                    /**************************************************************/
+                    /***************** EARLY EXIT OPTIMIZATION *******************/
+                    /*
+                     *  For a single target, rounds 79 - 76 are rewound from the target, which
+                     *  only needs word blocks 76 - 79, and compared against the result of round
+                     *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+                     *  block 79 (the target with round 79 undone) probes the filter
+                     *  first and, only if that passes, the sorted keys to rule out false positives.
+                     */
+                    if(p_targets->numberOfTargets == 1)
+                    {
+                        precomputeBlocks76To79(p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                        REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                        if(LIKELY(LEFT_ROTATE(d, 30) != r71))
+                            continue;
+                        COUNT(earlyExitPassed, 1);
+                        precomputeBlocks72To75(p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                        ROUND_60_79(d, e, a, b, c, 72)
+                        ROUND_60_79(c, d, e, a, b, 73)
+                        ROUND_60_79(b, c, d, e, a, 74)
+                    }
+                    else
+                    {
+                        precomputeBlocks72To75(p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                        p_blocks[79] = p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+                        ROUND_60_79(d, e, a, b, c, 72)
+                        ROUND_60_79(c, d, e, a, b, 73)
+                        ROUND_60_79(b, c, d, e, a, 74)
+                        temp = LEFT_ROTATE(a, 30) + p_blocks[79];
+                        if(LIKELY(!TARGET_SET_MAY_CONTAIN(p_targets, temp)))
+                            continue;
+                        if(!targetSetContainsKey(p_targets, temp))
+                            continue;
+                        precomputeBlocks76To79(p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                    }
+                    // rounds 75 - 79
+                    ROUND_60_79(a, b, c, d, e, 75)
+                    ROUND_60_79(e, a, b, c, d, 76)
+                    ROUND_60_79(d, e, a, b, c, 77)
+                    ROUND_60_79(c, d, e, a, b, 78)
+                    ROUND_60_79(b, c, d, e, a, 79)
+                    // compare the full state against all targets with this early exit value
+                    p_state[0] = a;
+                    p_state[1] = b;
+                    p_state[2] = c;
+                    p_state[3] = d;
+                    p_state[4] = e;
+                    reportCandidate(p_job,
+                                    p_state,
+                                    p_currInput,
+                                    PREIMAGE_LENGTH_BYTE);
+                    // stop early once every target has been found
+                    if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                        return 0;
+                }
+    // if we end up here, targets are left after this slice
     return E_CRACK_NOT_FOUND;
-
-success:
-    // a preimage was found, copy it into p_result
-    memcpy(p_result,
-           p_currInput,
-           PREIMAGE_LENGTH_BYTE);
-
-    return 0;
 }
 /**
  * Function: precomputeOuterLoop
@@ -441,6 +470,8 @@ static inline void precomputeInnerLoop
     p_w0[18] = LEFT_ROTATE(p_blocks[0], 18);
     p_w0[19] = LEFT_ROTATE(p_blocks[0], 19);
     p_w0[20] = LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = LEFT_ROTATE(p_blocks[0], 22);
     // precompute word blocks (basis by Jens Steube)
     // note: slightly optimized for our special case
     p_blocks[16] = p_w0[1];
@@ -499,8 +530,36 @@ static inline void precomputeInnerLoop
     p_blocks[69] = p_precomputedBlocks[69];
     p_blocks[70] = p_precomputedBlocks[70] ^ p_w0[12] ^ p_w0[19];
     p_blocks[71] = p_precomputedBlocks[71] ^ p_w0[12] ^ p_w0[16];
+}
+/**
+ * Function: precomputeBlocks72To75
+ */
+static inline void precomputeBlocks72To75
+(
+    uint32_t *p_precomputedBlocks,
+    uint32_t *p_w0,
+    uint32_t *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoop)
     p_blocks[72] = p_precomputedBlocks[72] ^ p_w0[11] ^ p_w0[12] ^ p_w0[18] ^ p_w0[13] ^ p_w0[16] ^ p_w0[5];
     p_blocks[73] = p_precomputedBlocks[73] ^ p_w0[20];
     p_blocks[74] = p_precomputedBlocks[74] ^ p_w0[8]  ^ p_w0[16];
     p_blocks[75] = p_precomputedBlocks[75] ^ p_w0[6]  ^ p_w0[12] ^ p_w0[14];
 }
+/**
+ * Function: precomputeBlocks76To79
+ */
+static inline void precomputeBlocks76To79
+(
+    uint32_t *p_precomputedBlocks,
+    uint32_t *p_w0,
+    uint32_t *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79, word block 77 does not depend on word block 0
+    p_blocks[76] = p_precomputedBlocks[76] ^ p_w0[7]  ^ p_w0[8]  ^ p_w0[12] ^ p_w0[16] ^ p_w0[21];
+    p_blocks[77] = p_precomputedBlocks[77];
+    p_blocks[78] = p_precomputedBlocks[78] ^ p_w0[7]  ^ p_w0[8]  ^ p_w0[15] ^ p_w0[18] ^ p_w0[20];
+    p_blocks[79] = p_precomputedBlocks[79] ^ p_w0[8]  ^ p_w0[22];
+}
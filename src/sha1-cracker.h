@@ -19,11 +19,135 @@
 
 // memcpy
 #include <string.h>
+// size_t
+#include <stddef.h>
 // UINT32_C
 #include <stdint.h>
+// atomic_uchar, atomic_size_t, atomic_uint_fast64_t
+#include <stdatomic.h>
+// pthread_mutex_t
+#include <pthread.h>
+// time_t
+#include <time.h>
+// UINT_MAX
+#include <limits.h>
 
-// error code
-#define E_CRACK_NOT_FOUND   0x0000000A
+// error codes
+#define E_CRACK_NOT_FOUND       0x0000000A
+#define E_CRACK_OUT_OF_MEMORY   0x0000000B
+#define E_CRACK_NO_SUCH_KERNEL  0x0000000C
+#define E_CRACK_BAD_KEYSPACE    0x0000000D
+#define E_CRACK_IO              0x0000000E
+#define E_CRACK_BAD_TABLE       0x0000000F
+#define E_CRACK_BAD_CHECKPOINT  0x00000010
+#define E_CRACK_BAD_RULE        0x00000011
+// length of preimage of the hand-tuned kernels (always 6 bytes)
+#define PREIMAGE_LENGTH_BYTE         6
+// keyspace of the hand-tuned kernels (together with PREIMAGE_LENGTH_BYTE)
+#define CRACK_DEFAULT_CHARSET      "abcdefghijklmnopqrstuvwxyz"
+// longest preimage of a configurable keyspace (padding stays in W[3])
+#define CRACK_MAX_PREIMAGE_LENGTH   12
+// bytes per result of crackHashesInKeyspace (preimage plus terminating zero)
+#define CRACK_RESULT_SIZE          (CRACK_MAX_PREIMAGE_LENGTH + 1)
+// longest word of a wordlist (longer lines are skipped)
+#define CRACK_MAX_WORD_LENGTH      255
+// bytes per result of crackHashesInWordlist
+#define CRACK_WORD_RESULT_SIZE     (CRACK_MAX_WORD_LENGTH + 1)
+// bytes of a wordlist handed to a worker thread at a time
+#define CRACK_WORDLIST_CHUNK_SIZE  1048576
+// longest rule (functions and operands, without spaces and no-ops)
+#define CRACK_MAX_RULE_LENGTH      255
+// returned by applyRule if the word grows beyond CRACK_MAX_WORD_LENGTH
+#define CRACK_RULE_REJECTED        UINT_MAX
+// the inner loop tables are padded to a multiple of the widest kernel
+#define CRACK_INNER_ALIGNMENT        8
+// candidate vectors the SSE2 and AVX2 kernels interleave per inner loop run (1 - 3)
+#ifndef CRACK_STREAMS
+#define CRACK_STREAMS                2
+#endif
+// the low inner loop table is swept once per high entry and should stay in L1
+#define CRACK_MAX_INNER_LOW       4096
+#define CRACK_MAX_INNER_HIGH   16777216
+// number of custom charsets a mask can refer to (?1 - ?4)
+#define CRACK_NUMBER_OF_CUSTOM_CHARSETS 4
+// number of outer loop slices (one per p_currInput[4]/[5] combination)
+#define CRACK_NUMBER_OF_SLICES     676
+// p_found of a target once its preimage is written completely
+#define CRACK_FOUND_WRITTEN          2
+// upper bound for the number of worker threads
+#define CRACK_MAX_THREADS          256
+// upper bound for the number of local worker processes of a sharded sweep
+#define CRACK_MAX_PROCESSES        256
+// default number of shards per worker process (more shards balance better)
+#define CRACK_SHARDS_PER_PROCESS     4
+// environment variable that overrides the kernel chosen at startup
+#define CRACK_KERNEL_ENV           "SHA1_CRACKER_KERNEL"
+// environment variable that turns pinning the workers of a sweep off ("off")
+#define CRACK_PLACEMENT_ENV        "SHA1_CRACKER_PLACEMENT"
+// upper bound for the number of NUMA nodes
+#define CRACK_MAX_NODES              64
+// upper bound for CPU numbers (CPU_SETSIZE of glibc)
+#define CRACK_MAX_CPUS             1024
+// root of the topology getCrackTopology reads
+#define CRACK_SYSFS_PATH           "/sys"
+// stack of a pinned worker thread, bound to the memory of its node
+#define CRACK_WORKER_STACK_SIZE   (8 * 1024 * 1024)
+// environment variable that turns work stealing off ("off"), the workers share a slice counter then
+#define CRACK_STEALING_ENV         "SHA1_CRACKER_STEALING"
+// slice ranges a worker's deque holds (taking a range pushes at most 64 halves)
+#ifndef CRACK_DEQUE_SIZE
+#define CRACK_DEQUE_SIZE            128
+#endif
+// longest message sha1Multi hashes in a single block (longer ones take sha1)
+#define CRACK_SHA1_MAX_SHORT_LENGTH 55
+// upper bound for the lanes of a multi-buffer SHA-1 engine
+#define CRACK_SHA1_MAX_LANES         8
+// hex digests the daemon parses at a time (see parseHashes)
+#define CRACK_DAEMON_BATCH_SIZE   1024
+// input buffer per client of the daemon (longer lines are skipped)
+#define CRACK_DAEMON_BUFFER_SIZE 65536
+// upper bound for the number of clients connected to the daemon socket
+#define CRACK_DAEMON_MAX_CLIENTS    64
+// milliseconds between two checks for targets whose sweep is done
+#define CRACK_DAEMON_POLL_INTERVAL 100
+// milliseconds between two checks whether the workers left a replaced generation
+#define CRACK_DAEMON_RETIRE_INTERVAL 1
+
+/*
+ *  Per-thread counters of the hot path, only maintained if compiled with
+ *  -DCRACK_INSTRUMENT (the macros expand to nothing otherwise). Cycles are
+ *  TSC cycles, reading the TSC around every inner loop precomputation adds
+ *  some overhead of its own.
+ */
+#ifdef CRACK_INSTRUMENT
+#define COUNT(counter, n)           (crackThreadCounters.counter += (n))
+#define CYCLES_START(start)         uint64_t start = __builtin_ia32_rdtsc()
+#define CYCLES_STOP(counter, start) (crackThreadCounters.counter += __builtin_ia32_rdtsc() - (start))
+#else
+#define COUNT(counter, n)           ((void) 0)
+#define CYCLES_START(start)         ((void) 0)
+#define CYCLES_STOP(counter, start) ((void) 0)
+#endif
+// membership of a CPU in a struct crackCpuSet
+#define CRACK_CPU_SET(p_set, cpu)   ((p_set)->p_words[(cpu) / 64] |= UINT64_C(1) << ((cpu) % 64))
+#define CRACK_CPU_ISSET(p_set, cpu) (((p_set)->p_words[(cpu) / 64] >> ((cpu) % 64)) & 1)
+// hint for branches the kernels take for almost every candidate
+#define LIKELY(x) (__builtin_expect(!!(x), 1))
+/*
+ *  Blocked Bloom filter of a target set: the low bits of an early exit value
+ *  pick a 32-bit word, three bits of the value times TARGET_FILTER_MULTIPLIER
+ *  pick the bits within it. A probe reads a single word, so the vector kernels
+ *  probe all lanes with one gather.
+ */
+#define TARGET_FILTER_MULTIPLIER UINT32_C(0x9E3779B1)
+#define TARGET_FILTER_BITS(key)                                                 \
+    ((UINT32_C(1) << (((key) * TARGET_FILTER_MULTIPLIER) >> 27))                \
+     | (UINT32_C(1) << ((((key) * TARGET_FILTER_MULTIPLIER) >> 22) & 31))       \
+     | (UINT32_C(1) << ((((key) * TARGET_FILTER_MULTIPLIER) >> 17) & 31)))
+// probe the filter of a target set with an early exit value
+#define TARGET_SET_MAY_CONTAIN(p_set, key)                                      \
+    (((p_set)->p_filter[(key) & (p_set)->filterMask] & TARGET_FILTER_BITS(key)) \
+     == TARGET_FILTER_BITS(key))
 
 struct hash 
 {
@@ -34,7 +158,582 @@ struct hash
 	uint32_t e;
 };
 
+/*
+ *  State after the first rounds of messages that share their leading bytes:
+ *  the multi-buffer engines start all lanes from it at numberOfRounds (one
+ *  round per word block made of shared bytes only). Engines that can't
+ *  resume simply hash from the start.
+ */
+struct sha1Prefix
+{
+	uint32_t     p_state[5];
+	unsigned int numberOfRounds;
+};
+
+// one line of a rule file, compiled by parseRules
+struct crackRule
+{
+	// function characters, each one followed by its operands
+	char         p_functions[CRACK_MAX_RULE_LENGTH];
+	unsigned int length;
+	// the rule only appends to the word, so every output starts with it
+	int          keepsWord;
+};
+
+struct targetEntry
+{
+	// target hash minus the initial hash state
+	uint32_t    p_state[5];
+	// target hash itself, to confirm a preimage with a full SHA-1
+	struct hash target;
+	// position of the target in the caller's array
+	size_t      index;
+};
+
+struct targetSet
+{
+	size_t             numberOfTargets;
+	// words of the filter minus one (see TARGET_SET_MAY_CONTAIN)
+	uint32_t           filterMask;
+	uint32_t           directoryShift;
+	uint32_t           *p_filter;
+	// index of the first key of each directory bucket (one extra at the end)
+	uint32_t           *p_directory;
+	// early exit values (see getEarlyExitKey), sorted
+	uint32_t           *p_keys;
+	// entries in the same order as p_keys
+	struct targetEntry *p_entries;
+	// constants to rewind rounds 79 - 76 of the first target (see initTargetSet)
+	uint32_t           p_rewind[6];
+};
+
+struct crackCounters
+{
+	uint64_t slices;
+	// candidates swept by the kernels (padding lanes included)
+	uint64_t candidates;
+	// single target: rewound round 71 matched, otherwise: filter passed
+	uint64_t earlyExitPassed;
+	// multiple targets: early exit value found among the sorted keys
+	uint64_t keyPassed;
+	// full states compared against the targets and the ones that matched
+	uint64_t reported;
+	uint64_t matched;
+	// precomputeOuterLoop (setupSlice for the generic kernels) and precomputeInnerLoop
+	uint64_t outerPrecomputes;
+	uint64_t innerPrecomputes;
+	uint64_t outerCycles;
+	uint64_t innerCycles;
+	// whole slices, the round bodies take what the precomputations leave
+	uint64_t sliceCycles;
+	// slice ranges taken from the deques of other workers
+	uint64_t steals;
+};
+
+struct keyspace
+{
+	// characters the candidates are built from (zero-terminated, no duplicates)
+	const char   *p_charset;
+	unsigned int minLength;
+	unsigned int maxLength;
+	/*
+	 *  Hashcat-style mask with one charset per position (e.g. "?u?l?l?l?d?d"),
+	 *  replaces p_charset if set. The lengths select prefixes of the mask, a
+	 *  maximum length of zero sweeps the whole mask only.
+	 */
+	const char   *p_mask;
+	// charsets of ?1 - ?4 within the mask (may use ?l, ?u, ?d, ?s, ?a and ??)
+	const char   *p_customCharsets[CRACK_NUMBER_OF_CUSTOM_CHARSETS];
+};
+
+struct keyspaceLayout
+{
+	// characters of every input byte position (zero-terminated)
+	char         p_charsets[CRACK_MAX_PREIMAGE_LENGTH][256];
+	unsigned int p_charsetLengths[CRACK_MAX_PREIMAGE_LENGTH];
+	unsigned int minLength;
+	unsigned int maxLength;
+	// set for six lower-case letters, which the hand-tuned kernels cover
+	int          isDefault;
+	// first slice of every length (one extra at the end holds the total)
+	uint64_t     p_firstSlice[CRACK_MAX_PREIMAGE_LENGTH + 2];
+	// first candidate index of every length (one extra at the end holds the total)
+	uint64_t     p_firstCandidate[CRACK_MAX_PREIMAGE_LENGTH + 2];
+	/*
+	 *  Parts of the first word block for the inner loop: the high table covers
+	 *  input bytes 0 up to the split, the low table the remaining ones (plus
+	 *  padding for lengths < 4). Index i is the number of inner positions
+	 *  (min(length, 4)).
+	 */
+	unsigned int p_innerSplit[5];
+	uint32_t     *p_innerHigh[5];
+	uint32_t     *p_innerLow[5];
+	uint32_t     p_numberOfInnerHigh[5];
+	uint32_t     p_numberOfInnerLow[5];
+};
+
+struct sliceSetup
+{
+	const struct keyspaceLayout *p_layout;
+	unsigned int                length;
+	// first input byte covered by the low table
+	unsigned int                innerSplit;
+	const uint32_t              *p_innerHigh;
+	const uint32_t              *p_innerLow;
+	uint32_t                    numberOfInnerHigh;
+	// the low table holds copies of its last entry up to CRACK_INNER_ALIGNMENT
+	uint32_t                    numberOfInnerLow;
+	// word blocks 0 - 79 with word block 0 set to zero
+	uint32_t                    p_precomputedBlocks[80];
+	// initial step constants of rounds 0 - 4 and 15 (word blocks 1 - 4, 15 included)
+	uint32_t                    p_roundConstants[6];
+	// outer loop part of the preimage
+	char                        p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+};
+
+struct lookupTable
+{
+	// rebuilt from the table header, maps entries back to preimages
+	struct keyspaceLayout layout;
+	// sorted digest prefix (upper 35 bits) and candidate index (lower 29 bits)
+	const uint64_t        *p_entries;
+	uint64_t              numberOfEntries;
+	void                  *p_mapping;
+	size_t                mappingSize;
+};
+
+// set of CPU numbers, e.g. a cpulist of /sys or an affinity mask
+struct crackCpuSet
+{
+	uint64_t p_words[CRACK_MAX_CPUS / 64];
+};
+
+/*
+ *  Cores the workers of a sweep are pinned to: the first allowed hardware
+ *  thread of every physical core, listed node by node.
+ */
+struct crackTopology
+{
+	unsigned int numberOfCores;
+	unsigned int p_cpus[CRACK_MAX_THREADS];
+	unsigned int p_nodes[CRACK_MAX_THREADS];
+	unsigned int numberOfNodes;
+};
+
+// worker thread pinned to a core, its stack on the node of the core
+struct placedThread
+{
+	pthread_t thread;
+	void      *p_stack;
+};
+
+/*
+ *  Chase-Lev deque of slice ranges [p_first[i], p_end[i]). Its worker pushes
+ *  and takes ranges at the bottom, the other workers steal from the top. The
+ *  indices only grow, a range lives at index % CRACK_DEQUE_SIZE.
+ */
+struct sliceDeque
+{
+	// stolen from, on a cache line of its own
+	atomic_int_fast64_t  top __attribute__((aligned(64)));
+	atomic_int_fast64_t  bottom __attribute__((aligned(64)));
+	atomic_uint_fast64_t p_first[CRACK_DEQUE_SIZE];
+	atomic_uint_fast64_t p_end[CRACK_DEQUE_SIZE];
+	// slices the worker keeps to itself if the deque is full [localFirst, localEnd)
+	uint64_t             localFirst;
+	uint64_t             localEnd;
+};
+
+// hands out the slices of a sweep to its workers
+struct sliceScheduler
+{
+	// one deque per worker, NULL if the workers share nextSlice instead
+	struct sliceDeque    *p_deques;
+	unsigned int         numberOfWorkers;
+	atomic_uint_fast64_t nextSlice;
+	uint64_t             endSlice;
+	// slices not handed out yet, idle workers keep stealing until none are left
+	atomic_uint_fast64_t pendingSlices;
+};
+
+struct checkpoint
+{
+	// file the sweep is saved to and resumed from (removed once the sweep is done)
+	const char   *p_path;
+	// seconds between two checkpoints (0 writes one after every slice)
+	unsigned int interval;
+};
+
+/*
+ *  Progress of a running sweep. The workers update it once per slice, so a
+ *  scheduler can poll it from another thread (or process, if it lives in
+ *  shared memory) while the sweep runs.
+ */
+struct crackProgress
+{
+	// called by the worker that finished a slice (NULL for none)
+	void                 (*callback)(const struct crackProgress *p_progress,
+									 void                       *p_context);
+	void                 *p_context;
+	// set when the sweep starts
+	uint64_t             numberOfCandidates;
+	uint64_t             startNanoseconds;
+	// candidates of the slices done so far, including the ones resumed from a checkpoint
+	atomic_uint_fast64_t candidatesTested;
+	atomic_uint_fast64_t candidatesResumed;
+	atomic_uint_fast64_t hashesPerSecond;
+	atomic_uint_fast64_t secondsRemaining;
+};
+
+/*
+ *  Targets of a checkpoint that were checked against the same slices. A sweep
+ *  resumed with more targets adds a class for the new ones, so every class
+ *  covers at least the slices of the ones after it.
+ */
+struct checkpointClass
+{
+	// all slices below are completed for the targets of the class
+	uint64_t         completedBelow;
+	// completed slices above completedBelow (sorted)
+	uint64_t         *p_completed;
+	size_t           numberOfCompleted;
+	// this class and the later ones, for the slices the earlier classes are done with
+	struct targetSet targets;
+	struct crackJob  *p_job;
+};
+
+struct checkpointState
+{
+	const struct checkpoint     *p_checkpoint;
+	const struct keyspaceLayout *p_layout;
+	const struct hash           *p_targets;
+	size_t                      numberOfTargets;
+	uint64_t                    numberOfSlices;
+	// class of every target, the first class sweeps with the job itself (see getSliceJob)
+	uint32_t                    *p_targetClasses;
+	struct checkpointClass      *p_classes;
+	uint32_t                    numberOfClasses;
+	// guards everything below
+	pthread_mutex_t             mutex;
+	time_t                      lastWrite;
+	/*
+	 *  Outer loop position: all slices below are completed (for the hand-tuned
+	 *  kernels slice = (p_currInput[4] - 'a') * 26 + p_currInput[5] - 'a').
+	 */
+	uint64_t                    completedBelow;
+	// slices above completedBelow completed for all targets since the sweep was resumed
+	uint64_t                    *p_completed;
+	size_t                      numberOfCompleted;
+	size_t                      capacity;
+	// results of the checkpoint file the sweep was resumed from
+	unsigned char               *p_restoredFound;
+	char                        *p_restoredResults;
+};
+
+struct crackJob
+{
+	const struct targetSet      *p_targets;
+	// NULL for the hand-tuned kernels
+	const struct keyspaceLayout *p_layout;
+	int                         (*crackSlice)(struct crackJob *p_job,
+											  uint64_t        slice);
+	uint64_t                    numberOfSlices;
+	// resultSize bytes per target (CRACK_RESULT_SIZE unless a wordlist is swept)
+	char                        *p_results;
+	size_t                      resultSize;
+	atomic_uchar                *p_found;
+	atomic_size_t               numberOfFound;
+	// first slice the scheduler hands out (behind the slices restored from a checkpoint)
+	atomic_uint_fast64_t        nextSlice;
+	// NULL if the sweep is not checkpointed
+	struct checkpointState      *p_checkpoint;
+	// set if only candidates in [firstCandidate, endCandidate) are reported
+	const struct keyspaceLayout *p_rangeLayout;
+	uint64_t                    firstCandidate;
+	uint64_t                    endCandidate;
+	// NULL if no progress is reported
+	struct crackProgress        *p_progress;
+	// set for every sweep, unlike p_layout
+	const struct keyspaceLayout *p_sweptLayout;
+};
+
 extern int crackHash(struct hash targetHash,
 					 char *p_result);
+extern int crackHashParallel(struct hash  targetHash,
+							 char         *p_result,
+							 unsigned int numberOfThreads);
+extern int crackHashes(const struct hash *p_targets,
+					   size_t            numberOfTargets,
+					   char              *p_results,
+					   unsigned int      numberOfThreads);
+extern int crackHashesInKeyspace(const struct hash     *p_targets,
+								 size_t                numberOfTargets,
+								 const struct keyspace *p_keyspace,
+								 char                  *p_results,
+								 unsigned int          numberOfThreads);
+extern int crackHashRange(struct hash           targetHash,
+						  uint64_t              firstCandidate,
+						  uint64_t              endCandidate,
+						  const struct keyspace *p_keyspace,
+						  char                  *p_result,
+						  unsigned int          numberOfThreads);
+extern int crackHashesInRange(const struct hash     *p_targets,
+							  size_t                numberOfTargets,
+							  uint64_t              firstCandidate,
+							  uint64_t              endCandidate,
+							  const struct keyspace *p_keyspace,
+							  char                  *p_results,
+							  unsigned int          numberOfThreads);
+// sharded sweeps over worker processes (see sha1-cracker_shard.c)
+extern int crackHashesSharded(const struct hash     *p_targets,
+							  size_t                numberOfTargets,
+							  const struct keyspace *p_keyspace,
+							  char                  *p_results,
+							  unsigned int          numberOfProcesses,
+							  uint64_t              numberOfShards);
+extern int runShardWorker(int                   fd,
+						  const struct hash     *p_targets,
+						  size_t                numberOfTargets,
+						  const struct keyspace *p_keyspace,
+						  unsigned int          numberOfThreads);
+extern int crackHashesWithCheckpoint(const struct hash       *p_targets,
+									 size_t                  numberOfTargets,
+									 const struct keyspace   *p_keyspace,
+									 char                    *p_results,
+									 unsigned int            numberOfThreads,
+									 const struct checkpoint *p_checkpoint);
+extern int crackHashesWithProgress(const struct hash       *p_targets,
+								   size_t                  numberOfTargets,
+								   const struct keyspace   *p_keyspace,
+								   char                    *p_results,
+								   unsigned int            numberOfThreads,
+								   const struct checkpoint *p_checkpoint,
+								   struct crackProgress    *p_progress);
+extern int crackHashesInWordlist(const struct hash *p_targets,
+								 size_t            numberOfTargets,
+								 const char        *p_path,
+								 char              *p_results,
+								 unsigned int      numberOfThreads);
+extern int crackHashesWithRules(const struct hash *p_targets,
+								size_t            numberOfTargets,
+								const char        *p_path,
+								const char        *p_rules,
+								char              *p_results,
+								unsigned int      numberOfThreads);
+// daemon mode: hex digests in, results out as they are found (see sha1-cracker_daemon.c)
+extern size_t parseHashes(const char  *p_text,
+						  size_t      length,
+						  struct hash *p_hashes,
+						  size_t      maxHashes,
+						  size_t      *p_numberOfHashes);
+extern int runCrackDaemon(int                   inputFd,
+						  int                   outputFd,
+						  const struct keyspace *p_keyspace,
+						  unsigned int          numberOfThreads);
+extern int listenCrackDaemon(const char            *p_path,
+							 const struct keyspace *p_keyspace,
+							 unsigned int          numberOfThreads);
+// implemented by each kernel: sweeps one outer loop slice
+extern int crackSliceScalar(struct crackJob *p_job,
+							uint64_t        slice);
+extern int crackSliceSse2(struct crackJob *p_job,
+						  uint64_t        slice);
+extern int crackSliceAvx2(struct crackJob *p_job,
+						  uint64_t        slice);
+extern int crackSliceAvx512(struct crackJob *p_job,
+							uint64_t        slice);
+// experimental: bitsliced AVX2 kernel, 256 candidates per register
+extern int crackSliceBitslice(struct crackJob *p_job,
+							  uint64_t        slice);
+// implemented by each generic kernel: sweeps one slice of a keyspace layout
+// (generated per preimage length by scripts/generate_kernels.py)
+extern int crackSliceGenericScalar(struct crackJob *p_job,
+								   uint64_t        slice);
+extern int crackSliceGenericSse2(struct crackJob *p_job,
+								 uint64_t        slice);
+extern int crackSliceGenericAvx2(struct crackJob *p_job,
+								 uint64_t        slice);
+// bound to the fastest kernels the CPU supports (see sha1-cracker_dispatch.c)
+extern int (*crackSlice)(struct crackJob *p_job,
+						 uint64_t        slice);
+extern int (*crackSliceGeneric)(struct crackJob *p_job,
+								uint64_t        slice);
+// counters of the worker threads of the last sweep (see CRACK_INSTRUMENT)
+extern unsigned int getCrackCounters(struct crackCounters *p_counters,
+									 unsigned int         maxThreads);
+#ifdef CRACK_INSTRUMENT
+extern _Thread_local struct crackCounters crackThreadCounters;
+#endif
+// kernel selection
+extern int selectCrackKernel(const char *p_name);
+extern const char *getCrackKernelName(void);
+// thread placement on multi-socket hosts (see sha1-cracker_numa.c)
+extern void setCrackPlacement(int isEnabled);
+extern int getCrackPlacement(void);
+extern int claimCrackPlacement(void);
+extern void releaseCrackPlacement(void);
+extern int pinCrackProcess(unsigned int index);
+extern int getCrackTopology(struct crackTopology *p_topology);
+extern int buildCrackTopology(struct crackTopology     *p_topology,
+							  const char               *p_sysfsPath,
+							  const struct crackCpuSet *p_allowed);
+extern int parseCpuList(const char         *p_text,
+						struct crackCpuSet *p_set);
+extern int startPlacedThread(struct placedThread *p_thread,
+							 void                *(*p_function)(void *),
+							 void                *p_arg,
+							 unsigned int        cpu,
+							 unsigned int        node);
+extern void joinPlacedThread(struct placedThread *p_thread);
+extern int initNodeTargetSet(struct targetSet       *p_copy,
+							 const struct targetSet *p_set,
+							 unsigned int           cpu,
+							 unsigned int           node);
+extern void freeNodeTargetSet(struct targetSet *p_copy);
+extern void *allocNodeMemory(size_t       size,
+							 unsigned int node);
+extern void freeNodeMemory(void   *p_memory,
+						   size_t size);
+// work-stealing scheduler of the slices (see sha1-cracker_scheduler.c)
+extern void setCrackStealing(int isEnabled);
+extern int getCrackStealing(void);
+extern void initSliceScheduler(struct sliceScheduler *p_scheduler,
+							   unsigned int          numberOfWorkers,
+							   uint64_t              firstSlice,
+							   uint64_t              endSlice,
+							   int                   isStealing);
+extern int getNextSlice(struct sliceScheduler *p_scheduler,
+						unsigned int          worker,
+						uint64_t              *p_slice);
+extern void leaveSliceScheduler(struct sliceScheduler *p_scheduler,
+								unsigned int          worker);
+extern void freeSliceScheduler(struct sliceScheduler *p_scheduler);
+// mangling rules of the wordlist mode (see sha1-cracker_rules.c)
+extern int parseRules(const char       *p_text,
+					  struct crackRule **pp_rules,
+					  size_t           *p_numberOfRules);
+extern unsigned int applyRule(const struct crackRule *p_rule,
+							  const char             *p_word,
+							  unsigned int           length,
+							  char                   *p_output);
+// full SHA-1 of arbitrary messages (see sha1-cracker_sha1.c)
+extern void sha1(const void  *p_data,
+				 size_t      length,
+				 struct hash *p_digest);
+extern int sha1Verify(const void        *p_data,
+					  size_t            length,
+					  const struct hash *p_expected);
+extern void sha1Multi(const char *const  *pp_messages,
+					  const unsigned int *p_lengths,
+					  size_t             numberOfMessages,
+					  struct hash        *p_digests);
+extern void loadSha1Block(const char   *p_message,
+						  unsigned int length,
+						  uint32_t     *p_words);
+extern void precomputeSha1Prefix(const char        *p_prefix,
+								 unsigned int      length,
+								 struct sha1Prefix *p_sha1Prefix);
+// implemented by each SHA-1 engine: compresses whole 64 byte blocks into p_state
+extern void sha1BlocksScalar(uint32_t            *p_state,
+							 const unsigned char *p_data,
+							 size_t              numberOfBlocks);
+extern void sha1BlocksShaNi(uint32_t            *p_state,
+							const unsigned char *p_data,
+							size_t              numberOfBlocks);
+// implemented by each SHA-1 engine: hashes one short message per lane (see struct sha1Prefix)
+extern void sha1MultiScalar(const char *const       *pp_messages,
+							const unsigned int      *p_lengths,
+							const struct sha1Prefix *p_prefix,
+							struct hash             *p_digests);
+extern void sha1MultiSse2(const char *const       *pp_messages,
+						  const unsigned int      *p_lengths,
+						  const struct sha1Prefix *p_prefix,
+						  struct hash             *p_digests);
+extern void sha1MultiAvx2(const char *const       *pp_messages,
+						  const unsigned int      *p_lengths,
+						  const struct sha1Prefix *p_prefix,
+						  struct hash             *p_digests);
+extern void sha1MultiShaNi(const char *const       *pp_messages,
+						   const unsigned int      *p_lengths,
+						   const struct sha1Prefix *p_prefix,
+						   struct hash             *p_digests);
+// bound to the fastest SHA-1 engine the CPU supports (see sha1-cracker_dispatch.c)
+extern void (*sha1Blocks)(uint32_t            *p_state,
+						  const unsigned char *p_data,
+						  size_t              numberOfBlocks);
+extern void (*sha1MultiLanes)(const char *const       *pp_messages,
+							  const unsigned int      *p_lengths,
+							  const struct sha1Prefix *p_prefix,
+							  struct hash             *p_digests);
+extern unsigned int numberOfSha1Lanes;
+// SHA-1 engine selection
+extern int selectSha1Engine(const char *p_name);
+extern const char *getSha1EngineName(void);
+// called by the kernels for every candidate that passed the early exit
+extern void reportCandidate(struct crackJob *p_job,
+							const uint32_t  *p_state,
+							const char      *p_preimage,
+							unsigned int    length);
+// target set handling
+extern int initTargetSet(struct targetSet  *p_set,
+						 const struct hash *p_targets,
+						 size_t            numberOfTargets);
+extern void freeTargetSet(struct targetSet *p_set);
+extern int targetSetContainsKey(const struct targetSet *p_set,
+								uint32_t               key);
+extern uint32_t getEarlyExitKey(const uint32_t *p_state);
+// keyspace handling
+extern int initKeyspaceLayout(struct keyspaceLayout *p_layout,
+							  const struct keyspace *p_keyspace);
+// finishes a layout whose charsets and lengths are set
+extern int buildKeyspaceLayout(struct keyspaceLayout *p_layout);
+extern void freeKeyspaceLayout(struct keyspaceLayout *p_layout);
+extern void setupSlice(const struct keyspaceLayout *p_layout,
+					   uint64_t                    slice,
+					   struct sliceSetup           *p_setup);
+extern void getSlicePreimage(const struct sliceSetup *p_setup,
+							 uint64_t                innerIndex,
+							 char                    *p_preimage);
+// linear candidate indices: slice by slice, inner loop order within a slice
+extern uint64_t getNumberOfCandidates(const struct keyspaceLayout *p_layout);
+extern uint64_t getCandidateIndex(const struct sliceSetup *p_setup,
+								  uint64_t                slice,
+								  uint64_t                innerIndex);
+extern unsigned int getCandidatePreimage(const struct keyspaceLayout *p_layout,
+										 uint64_t                    index,
+										 char                        *p_preimage);
+extern uint64_t getPreimageIndex(const struct keyspaceLayout *p_layout,
+								 const char                  *p_preimage,
+								 unsigned int                length);
+extern uint64_t getCandidateSlice(const struct keyspaceLayout *p_layout,
+								  uint64_t                    index);
+extern uint64_t getSliceCandidate(const struct keyspaceLayout *p_layout,
+								  uint64_t                    slice);
+// precomputed lookup tables (see sha1-cracker_table.c)
+extern int buildLookupTable(const char            *p_path,
+							const struct keyspace *p_keyspace,
+							unsigned int          numberOfThreads);
+extern int openLookupTable(struct lookupTable *p_table,
+						   const char         *p_path);
+extern int lookupHash(const struct lookupTable *p_table,
+					  struct hash              targetHash,
+					  char                     *p_result);
+extern void closeLookupTable(struct lookupTable *p_table);
+// checkpoint handling (see sha1-cracker_checkpoint.c)
+extern int initCheckpointState(struct checkpointState      *p_state,
+							   const struct checkpoint     *p_checkpoint,
+							   const struct keyspaceLayout *p_layout,
+							   const struct hash           *p_targets,
+							   size_t                      numberOfTargets,
+							   uint64_t                    numberOfSlices);
+extern int restoreCheckpoint(struct checkpointState *p_state,
+							 struct crackJob        *p_job);
+extern struct crackJob *getSliceJob(const struct checkpointState *p_state,
+									struct crackJob              *p_job,
+									uint64_t                     slice);
+extern int completeSlice(struct crackJob *p_job,
+						 uint64_t        slice);
+extern void freeCheckpointState(struct checkpointState *p_state,
+								int                    isFinished);
 
 #endif
@@ -15,6 +15,8 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 #include "sha1-cracker.h"
+// compile this kernel for AVX2, it is only called if the CPU supports it
+#pragma GCC target("avx2")
 // AVX2 (and other) intrinsics
 #include <immintrin.h>
 
@@ -23,10 +25,13 @@
 #define XOR(x, y)                       (_mm256_xor_si256(x, y))
 #define AND(x, y)                       (_mm256_and_si256(x, y))
 #define ADD(x, y)                       (_mm256_add_epi32(x, y))
+#define SUB(x, y)                       (_mm256_sub_epi32(x, y))
 #define SET1INT(x)                      (_mm256_set1_epi32(x))
 #define SET8INT(s, t, u, v, w, x, y, z) (_mm256_setr_epi32(s, t, u, v, w, x, y, z))
 #define SETZERO                         (_mm256_setzero_si256())
 #define STORE(loc, x)                   (_mm256_storeu_si256(((__m256i *) loc), x))
+#define CMPEQ(x, y)                     (_mm256_cmpeq_epi32(x, y))
+#define MOVEMASK(x)                     (_mm256_movemask_ps(_mm256_castsi256_ps(x)))
 
 // constants for hash state initialisation
 #define SHA1_IV_0            UINT32_C(0x67452301)
@@ -34,8 +39,7 @@
 #define SHA1_IV_2            UINT32_C(0x98BADCFE)
 #define SHA1_IV_3            UINT32_C(0x10325476)
 #define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
-// length of preimage (always 6 bytes)
-#define PREIMAGE_LENGTH_BYTE                          6
+// length of preimage in bits (always 6 bytes)
 #define PREIMAGE_LENGTH_BIT         UINT32_C(0x00000030)
 #define PREIMAGE_LENGTH_BIT_LROT1   UINT32_C(0x00000060)
 #define PREIMAGE_LENGTH_BIT_LROT2   UINT32_C(0x000000C0)
@@ -51,61 +55,160 @@
 // macros for circular left-shift (adapted from RFC 3174)
 #define U32_LEFT_ROTATE(word, bits) (((word) << (bits)) | ((word) >> (32 - (bits))))
 #define VEC_LEFT_ROTATE(word, bits) (OR((_mm256_slli_epi32((word), (bits))), (_mm256_srli_epi32((word), (32 - (bits))))))
+// a single byte shifted by up to 24 bits never wraps around, so a shift is enough
+#define VEC_LEFT_SHIFT(word, bits)  (_mm256_slli_epi32((word), (bits)))
 
 // macros for the different round additions
-#define ROUND_ADDITION_00                           (ADD(ROUND_CONSTANT_00, p_blocks[0]))
-#define ROUND_ADDITION_01(mA)                       (ADD(ADD(ROUND_CONSTANT_01, VEC_LEFT_ROTATE(mA, 5)), p_blocks[1]))
-#define ROUND_ADDITION_02(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_02, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
-#define ROUND_ADDITION_03(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_03, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
-#define ROUND_ADDITION_04(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_04, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
-#define ROUND_ADDITION_05_14(mA, mB, mC, mD, mE)    (ADD(ADD(ADD(K_00_19, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
-#define ROUND_ADDITION_15(mA, mB, mC, mD, mE)       (ADD(ADD(ADD(ROUND_CONSTANT_15, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_00(mA, mB, mC, mD, mE, mW)    (ADD(ROUND_CONSTANT_00, mW[0]))
+#define ROUND_ADDITION_01(mA, mB, mC, mD, mE, mW)    (ADD(ADD(ROUND_CONSTANT_01, VEC_LEFT_ROTATE(mA, 5)), p_vecPrecomputedBlocks[1]))
+#define ROUND_ADDITION_02(mA, mB, mC, mD, mE, mW)    (ADD(ADD(ROUND_CONSTANT_02, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_03(mA, mB, mC, mD, mE, mW)    (ADD(ADD(ROUND_CONSTANT_03, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_04(mA, mB, mC, mD, mE, mW)    (ADD(ADD(ROUND_CONSTANT_04, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_05_14(mA, mB, mC, mD, mE, mW) (ADD(ADD(ADD(K_00_19, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_15(mA, mB, mC, mD, mE, mW)    (ADD(ADD(ADD(ROUND_CONSTANT_15, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
 
 // macros for setting state variables in each round
 #define ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition) \
     mE = mRoundAddition;                                   \
     mB = VEC_LEFT_ROTATE(mB, 30);
-#define ROUND_PROCESSING_END(mA, mB, mE, f, k, i)                             \
-    mE = ADD(ADD(ADD(k, mE), VEC_LEFT_ROTATE(mA, 5)), ADD(f, (p_blocks[i]))); \
+#define ROUND_PROCESSING_END(mA, mB, mE, mW, f, k, i)                  \
+    mE = ADD(ADD(ADD(k, mE), VEC_LEFT_ROTATE(mA, 5)), ADD(f, (mW[i]))); \
     mB = VEC_LEFT_ROTATE(mB, 30);
 
-// macros for the round functions
-#define ROUND_00_15(mA, mB, mC, mD, mE, mRoundAddition) \
-    ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition)
-#define ROUND_16_19(mA, mB, mC, mD, mE, i) \
-    ROUND_PROCESSING_END(mA, mB, mE, VF_00_19(mB, mC, mD), K_00_19, i)
-#define ROUND_20_39(mA, mB, mC, mD, mE, i) \
-    ROUND_PROCESSING_END(mA, mB, mE, VF_REST(mB, mC, mD), K_20_39, i)
-#define ROUND_40_59(mA, mB, mC, mD, mE, i) \
-    ROUND_PROCESSING_END(mA, mB, mE, VF_40_59(mB, mC, mD), K_40_59, i)
-#define ROUND_60_79(mA, mB, mC, mD, mE, i) \
-    ROUND_PROCESSING_END(mA, mB, mE, VF_REST(mB, mC, mD), K_60_79, i)
+// macros for the round functions (mW holds the word blocks of the candidates)
+#define ROUND_00_15(mA, mB, mC, mD, mE, mW, mRoundAddition) \
+    ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition(mA, mB, mC, mD, mE, mW))
+#define ROUND_16_19(mA, mB, mC, mD, mE, mW, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, mW, VF_00_19(mB, mC, mD), K_00_19, i)
+#define ROUND_20_39(mA, mB, mC, mD, mE, mW, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, mW, VF_REST(mB, mC, mD), K_20_39, i)
+#define ROUND_40_59(mA, mB, mC, mD, mE, mW, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, mW, VF_40_59(mB, mC, mD), K_40_59, i)
+#define ROUND_60_79(mA, mB, mC, mD, mE, mW, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, mW, VF_REST(mB, mC, mD), K_60_79, i)
+// macro for rewinding rounds 79 - 76 of a single target (see initTargetSet)
+#define REWIND_ROUNDS_79_76(m74, m73, m72, m71)                                      \
+    m74 = SUB(p_vecRewind[0], p_blocks[79]);                                         \
+    m73 = SUB(SUB(p_vecRewind[1], XOR(p_vecRewind[2], m74)), p_blocks[78]);          \
+    m72 = SUB(SUB(p_vecRewind[3], VF_REST(p_vecRewind[4], m74, m73)), p_blocks[77]); \
+    m71 = SUB(SUB(p_vecRewind[5], VF_REST(VEC_LEFT_ROTATE(m74, 2), m73, m72)), p_blocks[76]);
+// macros for probing the filter of a target set with all lanes at once (see TARGET_SET_MAY_CONTAIN)
+#define VEC_FILTER_BIT(mHash, bits) \
+    (_mm256_sllv_epi32(SET1INT(1), AND(_mm256_srli_epi32((mHash), (bits)), SET1INT(31))))
+#define PROBE_FILTER(p_set, mKey, mBits, passed)                                                        \
+    mBits  = _mm256_mullo_epi32((mKey), SET1INT(TARGET_FILTER_MULTIPLIER));                             \
+    mBits  = OR(OR(VEC_FILTER_BIT(mBits, 27), VEC_FILTER_BIT(mBits, 22)), VEC_FILTER_BIT(mBits, 17));   \
+    passed = MOVEMASK(CMPEQ(AND(_mm256_i32gather_epi32((const int *) (p_set)->p_filter,                 \
+                                                       AND((mKey), SET1INT((p_set)->filterMask)), 4),   \
+                                mBits),                                                                 \
+                            mBits));
+
+/*
+ *  The rounds of CRACK_STREAMS independent candidate vectors (streams) are
+ *  interleaved, so the out-of-order core fills the latency of one round chain
+ *  with the others. Stream s sweeps input byte 0 plus s, its variables are the
+ *  names below with s appended.
+ */
+#if CRACK_STREAMS == 1
+#define FOR_STREAMS(m, ...) m(0, __VA_ARGS__)
+#elif CRACK_STREAMS == 2
+#define FOR_STREAMS(m, ...) m(0, __VA_ARGS__) m(1, __VA_ARGS__)
+#elif CRACK_STREAMS == 3
+#define FOR_STREAMS(m, ...) m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__)
+#else
+#error "CRACK_STREAMS must be 1, 2 or 3"
+#endif
+#define STREAM_VARIABLES(s, type)                    \
+    type a##s, b##s, c##s, d##s, e##s, vecPrefix##s, \
+         p_prefixBlocks##s[80], p_blocks##s[80];
+#define STREAM_PADDING(s, unused) \
+    memcpy(p_blocks##s, p_vecPrecomputedBlocks, 16 * sizeof(__m256i));
+#define STREAM_INIT_STATE(s, unused) \
+    a##s = SET1INT(SHA1_IV_0);       \
+    b##s = SET1INT(SHA1_IV_1);       \
+    c##s = SET1INT(SHA1_IV_2);       \
+    d##s = SET1INT(SHA1_IV_3);       \
+    e##s = SET1INT(SHA1_IV_4);
+#define STREAM_PREFIX(s, unused)                                             \
+    vecPrefix##s = ADD(SET1INT(  ((p_currInput[0] + s) << 24)                \
+                               | (p_currInput[1] << 16)                      \
+                               | (p_currInput[2] << 8)),                     \
+                       PREFIX_OFFSETS);                                      \
+    rotatePrefix(vecPrefix##s, p_w0);                                        \
+    precomputeInnerLoop(p_vecPrecomputedBlocks, p_w0, p_prefixBlocks##s);    \
+    precomputeBlocks72To75(p_vecPrecomputedBlocks, p_w0, p_prefixBlocks##s); \
+    precomputeBlocks76To79(p_vecPrecomputedBlocks, p_w0, p_prefixBlocks##s);
+#define STREAM_BLOCKS(s, unused)               \
+    p_blocks##s[0] = OR(vecPrefix##s, vecLow); \
+    precomputeInnerLoop(p_prefixBlocks##s, p_w0, p_blocks##s);
+#define STREAM_ROUND(s, round, mA, mB, mC, mD, mE, x) \
+    round(mA##s, mB##s, mC##s, mD##s, mE##s, p_blocks##s, x)
+#define STREAMS_ROUND(round, mA, mB, mC, mD, mE, x) \
+    FOR_STREAMS(STREAM_ROUND, round, mA, mB, mC, mD, mE, x)
+// streams beyond 'z' (if CRACK_STREAMS does not divide 26) are swept but never reported
+#define STREAM_FINISH(s, unused)                                      \
+    if(p_currInput[0] + s <= 'z')                                     \
+    {                                                                 \
+        COUNT(candidates, 8);                                         \
+        reported |= finishStream(p_job, a##s, b##s, c##s, d##s, e##s, \
+                                 p_prefixBlocks##s, p_w0, p_blocks##s,\
+                                 p_vecRewind, p_currInput, s);        \
+    }
 
 // function prototypes
 static inline void precomputeOuterLoop(__m256i  *p_vecPrecomputedBlocks);
+// always inlined, a call would clobber the vector registers of the other streams
+static inline int  finishStream(struct crackJob *p_job,
+                                __m256i         a,
+                                __m256i         b,
+                                __m256i         c,
+                                __m256i         d,
+                                __m256i         e,
+                                __m256i         *p_prefixBlocks,
+                                __m256i         *p_w0,
+                                __m256i         *p_blocks,
+                                const __m256i   *p_vecRewind,
+                                const char      *p_currInput,
+                                int             stream) __attribute__((always_inline));
+static inline void rotatePrefix(__m256i vecPrefix,
+                                __m256i *p_w0);
+static inline void shiftLowByte(__m256i vecLow,
+                                __m256i *p_w0);
 static inline void precomputeInnerLoop(__m256i  *p_vecPrecomputedBlocks,
                                        __m256i  *p_w0,
                                        __m256i  *p_blocks);
+static inline void precomputeBlocks72To75(__m256i  *p_vecPrecomputedBlocks,
+                                          __m256i  *p_w0,
+                                          __m256i  *p_blocks);
+static inline void precomputeBlocks76To79(__m256i  *p_vecPrecomputedBlocks,
+                                          __m256i  *p_w0,
+                                          __m256i  *p_blocks);
 
 /**
- * Function: crackHash
+ * Function: crackSliceAvx2
  */
-int crackHash
+int crackSliceAvx2
 (
-    struct hash targetHash,
-    char        *p_result
+    struct crackJob *p_job,
+    uint64_t        slice
 )
 {
-    int      index;
-    __m256i  a, b, c, d, e, vecTemp;
-    char     p_currInput[6];
-    uint32_t p_earlyExit[5],
-             p_tempSave[8];
-    __m256i  p_vecPrecomputedBlocks[80],
-             p_w0[21],
-             p_blocks[80];
+    int                    index,
+                           reported;
+    char                   p_currInput[6];
+    __m256i                p_vecRewind[6],
+                           p_vecPrecomputedBlocks[80],
+                           p_w0[23];
+    // byte 3 of all lanes, the same in every stream
+    __m256i                vecLow;
+    // state, prefix and word blocks of every stream (see FOR_STREAMS)
+    FOR_STREAMS(STREAM_VARIABLES, __m256i)
+    const struct targetSet *p_targets = p_job->p_targets;
     // constant vectors
-    const __m256i   K_00_19 = SET1INT(0x5A827999),
+    const __m256i   PREFIX_OFFSETS = SET8INT(0, 0, 0x100, 0x100, 0x10000, 0x10000, 0x10100, 0x10100),
+                    LOW_OFFSETS = SET8INT(0, 1, 0, 1, 0, 1, 0, 1),
+                    LOW_STRIDE = SET1INT(2),
+                    K_00_19 = SET1INT(0x5A827999),
                     K_20_39 = SET1INT(0x6ED9EBA1),
                     K_40_59 = SET1INT(0x8F1BBCDC),
                     K_60_79 = SET1INT(0xCA62C1D6),
@@ -124,276 +227,282 @@ int crackHash
     p_vecPrecomputedBlocks[12] = SETZERO; p_vecPrecomputedBlocks[13] = SETZERO;
     p_vecPrecomputedBlocks[14] = SETZERO;
     p_vecPrecomputedBlocks[15] = SET1INT(PREIMAGE_LENGTH_BIT);
+    // only word block 0 contributes to these (see precomputeOuterLoop)
+    p_vecPrecomputedBlocks[16] = SETZERO;
+    p_vecPrecomputedBlocks[19] = SETZERO;
+    p_vecPrecomputedBlocks[22] = SETZERO;
     // the following values are only dependent on the preimage length
     p_vecPrecomputedBlocks[18] = SET1INT(PREIMAGE_LENGTH_BIT_LROT1);
     p_vecPrecomputedBlocks[21] = SET1INT(PREIMAGE_LENGTH_BIT_LROT2);
     p_vecPrecomputedBlocks[24] = SET1INT(PREIMAGE_LENGTH_BIT_LROT3);
     p_vecPrecomputedBlocks[27] = SET1INT(PREIMAGE_LENGTH_BIT_LROT4);
     p_vecPrecomputedBlocks[30] = SET1INT(PREIMAGE_LENGTH_BIT_LROT5);
-    // initialize p_blocks with padding too
-    memcpy( p_blocks,
-            p_vecPrecomputedBlocks,
-            16 * sizeof(__m256i));
     /**************************************************************/
     /*************** PRECOMPUTE EARLY EXIT VALUES ****************/
-    p_earlyExit[0] = targetHash.a - SHA1_IV_0;
-    p_earlyExit[1] = targetHash.b - SHA1_IV_1;
-    p_earlyExit[2] = targetHash.c - SHA1_IV_2;
-    p_earlyExit[3] = targetHash.d - SHA1_IV_3;
-    p_earlyExit[4] = targetHash.e - SHA1_IV_4;
-    // values c, d, e are rotated by 30 - rotate by 2 more to undo
-    p_earlyExit[2] = U32_LEFT_ROTATE(p_earlyExit[2], 2);
-    p_earlyExit[3] = U32_LEFT_ROTATE(p_earlyExit[3], 2);
-    p_earlyExit[4] = U32_LEFT_ROTATE(p_earlyExit[4], 2);
+    // only used if there is a single target (see initTargetSet)
+    for(index = 0; index < 6; index++)
+        p_vecRewind[index] = SET1INT(p_targets->p_rewind[index]);
     /**************************************************************/
-    // outer loop through all two letter combinations from 'a' to 'z'
-    for (p_currInput[4] = 'a'; p_currInput[4] <= 'z'; p_currInput[4]++)
-        for (p_currInput[5] = 'a'; p_currInput[5] <= 'z'; p_currInput[5]++)
-        {
-            // set second word block based on input ('1'-bit == 0x8000)
-            p_vecPrecomputedBlocks[1] = SET1INT(  UINT32_C(0x8000)
-                                                | (p_currInput[4] << 24)
-                                                | (p_currInput[5] << 16));
-            p_blocks[1] = p_vecPrecomputedBlocks[1];
-            // precompute word blocks for outer loop
-            precomputeOuterLoop(p_vecPrecomputedBlocks);
-            // inner loop through all four letter combinations from 'a' to 'z'
-            for (p_currInput[0] = 'a'; p_currInput[0] <= 'z'; p_currInput[0]++)
-                for (p_currInput[1] = 'a'; p_currInput[1] <= 'z'; p_currInput[1] += 2)
-                    for (p_currInput[2] = 'a'; p_currInput[2] <= 'z'; p_currInput[2] += 2)
-                        for (p_currInput[3] = 'a'; p_currInput[3] <= 'z'; p_currInput[3] += 2)
-                        {
-                            // generate (missing) first word blocks based on new input
-                            p_tempSave[0] = (p_currInput[0] << 24)
-                                          | (p_currInput[1] << 16)
-                                          | (p_currInput[2] << 8)
-                                          | (p_currInput[3]);
-                            p_tempSave[1] = (p_currInput[0] << 24)
-                                          | (p_currInput[1] << 16)
-                                          | (p_currInput[2] << 8)
-                                          | ((p_currInput[3] + 1));
-                            p_tempSave[2] = (p_currInput[0] << 24)
-                                          | (p_currInput[1] << 16)
-                                          | ((p_currInput[2] + 1) << 8)
-                                          | (p_currInput[3]);
-                            p_tempSave[3] = (p_currInput[0] << 24)
-                                          | (p_currInput[1] << 16)
-                                          | ((p_currInput[2] + 1) << 8)
-                                          | ((p_currInput[3] + 1));
-                            p_tempSave[4] = (p_currInput[0] << 24)
-                                          | ((p_currInput[1] + 1) << 16)
-                                          | (p_currInput[2] << 8)
-                                          | (p_currInput[3]);
-                            p_tempSave[5] = (p_currInput[0] << 24)
-                                          | ((p_currInput[1] + 1) << 16)
-                                          | (p_currInput[2] << 8)
-                                          | ((p_currInput[3] + 1));
-                            p_tempSave[6] = (p_currInput[0] << 24)
-                                          | ((p_currInput[1] + 1) << 16)
-                                          | ((p_currInput[2] + 1) << 8)
-                                          | (p_currInput[3]);
-                            p_tempSave[7] = (p_currInput[0] << 24)
-                                          | ((p_currInput[1] + 1) << 16)
-                                          | ((p_currInput[2] + 1) << 8)
-                                          | ((p_currInput[3] + 1));
-                            p_blocks[0] = SET8INT(p_tempSave[0],
-                                                  p_tempSave[1],
-                                                  p_tempSave[2],
-                                                  p_tempSave[3],
-                                                  p_tempSave[4],
-                                                  p_tempSave[5],
-                                                  p_tempSave[6],
-                                                  p_tempSave[7]);
-                            // precompute word blocks for inner loop
-                            precomputeInnerLoop(p_vecPrecomputedBlocks,
-                                                p_w0,
-                                                p_blocks);
-                            // initialize state variables with constants
-                            a = SET1INT(SHA1_IV_0);
-                            b = SET1INT(SHA1_IV_1);
-                            c = SET1INT(SHA1_IV_2);
-                            d = SET1INT(SHA1_IV_3);
-                            e = SET1INT(SHA1_IV_4);
-                            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
-                            // round 00
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
-                            // round 01
-                            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
-                            // round 02
-                            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
-                            // round 03
-                            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
-                            // round 04
-                            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
-                            // rounds 05 - 14
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
-                            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
-                            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
-                            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
-                            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
-                            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
-                            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
-                            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
-                            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
-                            // round 15
-                            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
-                            // rounds 16 - 19
-                            ROUND_16_19(e, a, b, c, d, 16)
-                            ROUND_16_19(d, e, a, b, c, 17)
-                            ROUND_16_19(c, d, e, a, b, 18)
-                            ROUND_16_19(b, c, d, e, a, 19)
-                            // rounds 20 - 39
-                            ROUND_20_39(a, b, c, d, e, 20)
-                            ROUND_20_39(e, a, b, c, d, 21)
-                            ROUND_20_39(d, e, a, b, c, 22)
-                            ROUND_20_39(c, d, e, a, b, 23)
-                            ROUND_20_39(b, c, d, e, a, 24)
-                            ROUND_20_39(a, b, c, d, e, 25)
-                            ROUND_20_39(e, a, b, c, d, 26)
-                            ROUND_20_39(d, e, a, b, c, 27)
-                            ROUND_20_39(c, d, e, a, b, 28)
-                            ROUND_20_39(b, c, d, e, a, 29)
-                            ROUND_20_39(a, b, c, d, e, 30)
-                            ROUND_20_39(e, a, b, c, d, 31)
-                            ROUND_20_39(d, e, a, b, c, 32)
-                            ROUND_20_39(c, d, e, a, b, 33)
-                            ROUND_20_39(b, c, d, e, a, 34)
-                            ROUND_20_39(a, b, c, d, e, 35)
-                            ROUND_20_39(e, a, b, c, d, 36)
-                            ROUND_20_39(d, e, a, b, c, 37)
-                            ROUND_20_39(c, d, e, a, b, 38)
-                            ROUND_20_39(b, c, d, e, a, 39)
-                            // rounds 40 - 59
-                            ROUND_40_59(a, b, c, d, e, 40)
-                            ROUND_40_59(e, a, b, c, d, 41)
-                            ROUND_40_59(d, e, a, b, c, 42)
-                            ROUND_40_59(c, d, e, a, b, 43)
-                            ROUND_40_59(b, c, d, e, a, 44)
-                            ROUND_40_59(a, b, c, d, e, 45)
-                            ROUND_40_59(e, a, b, c, d, 46)
-                            ROUND_40_59(d, e, a, b, c, 47)
-                            ROUND_40_59(c, d, e, a, b, 48)
-                            ROUND_40_59(b, c, d, e, a, 49)
-                            ROUND_40_59(a, b, c, d, e, 50)
-                            ROUND_40_59(e, a, b, c, d, 51)
-                            ROUND_40_59(d, e, a, b, c, 52)
-                            ROUND_40_59(c, d, e, a, b, 53)
-                            ROUND_40_59(b, c, d, e, a, 54)
-                            ROUND_40_59(a, b, c, d, e, 55)
-                            ROUND_40_59(e, a, b, c, d, 56)
-                            ROUND_40_59(d, e, a, b, c, 57)
-                            ROUND_40_59(c, d, e, a, b, 58)
-                            ROUND_40_59(b, c, d, e, a, 59)
-                            // rounds 60 - 79
-                            ROUND_60_79(a, b, c, d, e, 60)
-                            ROUND_60_79(e, a, b, c, d, 61)
-                            ROUND_60_79(d, e, a, b, c, 62)
-                            ROUND_60_79(c, d, e, a, b, 63)
-                            ROUND_60_79(b, c, d, e, a, 64)
-                            ROUND_60_79(a, b, c, d, e, 65)
-                            ROUND_60_79(e, a, b, c, d, 66)
-                            ROUND_60_79(d, e, a, b, c, 67)
-                            ROUND_60_79(c, d, e, a, b, 68)
-                            ROUND_60_79(b, c, d, e, a, 69)
-                            ROUND_60_79(a, b, c, d, e, 70)
-                            ROUND_60_79(e, a, b, c, d, 71)
-                            ROUND_60_79(d, e, a, b, c, 72)
-                            ROUND_60_79(c, d, e, a, b, 73)
-                            ROUND_60_79(b, c, d, e, a, 74)
-                            /**************************************************************/
-                            /***************** EARLY EXIT OPTIMIZATION *******************/
-                            // round 75
-                            ROUND_60_79(a, b, c, d, e, 75)
-                            STORE(p_tempSave, e);
-                            /*  
-                             *  In our way of iterating over the searchspace, there are never two            
-                             *  values in a vector that are the same in this step. Therefore, the following  
-                             *  comparisons can yield at most one match. That said, we can set "index"       
-                             *  to whatever match we find and check only that specific value going forward.
-                             */
-                            index = -1;
-                            if((p_tempSave[0]) == p_earlyExit[4]) index = 0;
-                            if((p_tempSave[1]) == p_earlyExit[4]) index = 1;
-                            if((p_tempSave[2]) == p_earlyExit[4]) index = 2;
-                            if((p_tempSave[3]) == p_earlyExit[4]) index = 3;
-                            if((p_tempSave[4]) == p_earlyExit[4]) index = 4;
-                            if((p_tempSave[5]) == p_earlyExit[4]) index = 5;
-                            if((p_tempSave[6]) == p_earlyExit[4]) index = 6;
-                            if((p_tempSave[7]) == p_earlyExit[4]) index = 7;
-                            if(index == -1) 
-                                continue;
-                            /*
-                             *  The word blocks have only been precomputed up until round 75, 
-                             *  because that's the earliest we can exit. If we go beyond round 
-                             *  75, compute missing blocks when required.
-                             */ 
-                            // round 76
-                            vecTemp = XOR(XOR(p_blocks[73], p_blocks[68]), XOR(p_blocks[62], p_blocks[60]));
-                            p_blocks[76] = VEC_LEFT_ROTATE(vecTemp, 1);
-                            ROUND_60_79(e, a, b, c, d, 76)
-                            STORE(p_tempSave, d);
-                            if(p_tempSave[index] != p_earlyExit[3]) 
-                                continue;
-                            // round 77
-                            vecTemp = XOR(XOR(p_blocks[74], p_blocks[69]), XOR(p_blocks[63], p_blocks[61]));
-                            p_blocks[77] = VEC_LEFT_ROTATE(vecTemp, 1);
-                            ROUND_60_79(d, e, a, b, c, 77)
-                            STORE(p_tempSave, c);
-                            if(p_tempSave[index] != p_earlyExit[2])
-                                continue;
-                            // round 78
-                            vecTemp = XOR(XOR(p_blocks[75], p_blocks[70]), XOR(p_blocks[64], p_blocks[62]));
-                            p_blocks[78] = VEC_LEFT_ROTATE(vecTemp, 1);
-                            ROUND_60_79(c, d, e, a, b, 78)
-                            STORE(p_tempSave, b);
-                            if(p_tempSave[index] != p_earlyExit[1])
-                                continue;
-                            // round 79
-                            vecTemp = XOR(XOR(p_blocks[76], p_blocks[71]), XOR(p_blocks[65], p_blocks[63]));
-                            p_blocks[79] = VEC_LEFT_ROTATE(vecTemp, 1);
-                            ROUND_60_79(b, c, d, e, a, 79)
-                            STORE(p_tempSave, a);
-                            if(p_tempSave[index] != p_earlyExit[0])
-                                continue;
-                            /**************************************************************/
-                            // set correct preimage (no changes needed for index == 0)
-                            switch(index)
-                            {
-                                case 1: p_currInput[3]++;
-                                        break;
-                                case 2: p_currInput[2]++;
-                                        break;
-                                case 3: p_currInput[2]++;
-                                        p_currInput[3]++;
-                                        break;
-                                case 4: p_currInput[1]++;
-                                        break;
-                                case 5: p_currInput[1]++;
-                                        p_currInput[3]++;
-                                        break;
-                                case 6: p_currInput[1]++;
-                                        p_currInput[2]++;
-                                        break;
-                                case 7: p_currInput[1]++;
-                                        p_currInput[2]++;
-                                        p_currInput[3]++;
-                                        break;
-                            }
-
-                            goto success;
-                        }
-        }
-    // if we end up here, no preimage was found
+    // the slice selects one of the two letter combinations of the outer loop
+    p_currInput[4] = 'a' + slice / 26;
+    p_currInput[5] = 'a' + slice % 26;
+    // set second word block based on input ('1'-bit == 0x8000)
+    p_vecPrecomputedBlocks[1] = SET1INT(  UINT32_C(0x8000)
+                                        | (p_currInput[4] << 24)
+                                        | (p_currInput[5] << 16));
+    // precompute word blocks for outer loop
+    CYCLES_START(outerStart);
+    precomputeOuterLoop(p_vecPrecomputedBlocks);
+    CYCLES_STOP(outerCycles, outerStart);
+    COUNT(outerPrecomputes, 1);
+    // initialize word blocks 0 - 15 of every stream with padding too
+    FOR_STREAMS(STREAM_PADDING, 0)
+    // inner loop through all four letter combinations from 'a' to 'z'
+    for (p_currInput[0] = 'a'; p_currInput[0] <= 'z'; p_currInput[0] += CRACK_STREAMS)
+    {
+        for (p_currInput[1] = 'a'; p_currInput[1] <= 'z'; p_currInput[1] += 2)
+            for (p_currInput[2] = 'a'; p_currInput[2] <= 'z'; p_currInput[2] += 2)
+            {
+                /*
+                 *  Lane i adds bits 2, 1 and 0 of i to input bytes 1, 2 and 3. Rotating
+                 *  word block 0 equals rotating bytes 0 - 2 and byte 3 separately, so
+                 *  the word blocks with bytes 0 - 2 folded in are precomputed here and
+                 *  the innermost loop only adds the shifted byte 3 of every lane.
+                 */
+                CYCLES_START(prefixStart);
+                FOR_STREAMS(STREAM_PREFIX, 0)
+                CYCLES_STOP(innerCycles, prefixStart);
+                // byte 3 of all lanes is a counter with a stride of two letters
+                vecLow = ADD(SET1INT('a'),
+                             LOW_OFFSETS);
+                for (p_currInput[3] = 'a'; p_currInput[3] <= 'z'; p_currInput[3] += 2, vecLow = ADD(vecLow, LOW_STRIDE))
+                {
+                    // generate (missing) first word blocks and precompute the word blocks
+                    // for inner loop, the shifted byte 3 is shared by all streams
+                    CYCLES_START(innerStart);
+                    shiftLowByte(vecLow,
+                                 p_w0);
+                    FOR_STREAMS(STREAM_BLOCKS, 0)
+                    CYCLES_STOP(innerCycles, innerStart);
+                    COUNT(innerPrecomputes, CRACK_STREAMS);
+                    // initialize state variables with constants
+                    FOR_STREAMS(STREAM_INIT_STATE, 0)
+                    /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+                    // round 00
+                    STREAMS_ROUND(ROUND_00_15, a, b, c, d, e, ROUND_ADDITION_00)
+                    // round 01
+                    STREAMS_ROUND(ROUND_00_15, e, a, b, c, d, ROUND_ADDITION_01)
+                    // round 02
+                    STREAMS_ROUND(ROUND_00_15, d, e, a, b, c, ROUND_ADDITION_02)
+                    // round 03
+                    STREAMS_ROUND(ROUND_00_15, c, d, e, a, b, ROUND_ADDITION_03)
+                    // round 04
+                    STREAMS_ROUND(ROUND_00_15, b, c, d, e, a, ROUND_ADDITION_04)
+                    // rounds 05 - 14
+                    STREAMS_ROUND(ROUND_00_15, a, b, c, d, e, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, e, a, b, c, d, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, d, e, a, b, c, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, c, d, e, a, b, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, b, c, d, e, a, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, a, b, c, d, e, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, e, a, b, c, d, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, d, e, a, b, c, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, c, d, e, a, b, ROUND_ADDITION_05_14)
+                    STREAMS_ROUND(ROUND_00_15, b, c, d, e, a, ROUND_ADDITION_05_14)
+                    // round 15
+                    STREAMS_ROUND(ROUND_00_15, a, b, c, d, e, ROUND_ADDITION_15)
+                    // rounds 16 - 19
+                    STREAMS_ROUND(ROUND_16_19, e, a, b, c, d, 16)
+                    STREAMS_ROUND(ROUND_16_19, d, e, a, b, c, 17)
+                    STREAMS_ROUND(ROUND_16_19, c, d, e, a, b, 18)
+                    STREAMS_ROUND(ROUND_16_19, b, c, d, e, a, 19)
+                    // rounds 20 - 39
+                    STREAMS_ROUND(ROUND_20_39, a, b, c, d, e, 20)
+                    STREAMS_ROUND(ROUND_20_39, e, a, b, c, d, 21)
+                    STREAMS_ROUND(ROUND_20_39, d, e, a, b, c, 22)
+                    STREAMS_ROUND(ROUND_20_39, c, d, e, a, b, 23)
+                    STREAMS_ROUND(ROUND_20_39, b, c, d, e, a, 24)
+                    STREAMS_ROUND(ROUND_20_39, a, b, c, d, e, 25)
+                    STREAMS_ROUND(ROUND_20_39, e, a, b, c, d, 26)
+                    STREAMS_ROUND(ROUND_20_39, d, e, a, b, c, 27)
+                    STREAMS_ROUND(ROUND_20_39, c, d, e, a, b, 28)
+                    STREAMS_ROUND(ROUND_20_39, b, c, d, e, a, 29)
+                    STREAMS_ROUND(ROUND_20_39, a, b, c, d, e, 30)
+                    STREAMS_ROUND(ROUND_20_39, e, a, b, c, d, 31)
+                    STREAMS_ROUND(ROUND_20_39, d, e, a, b, c, 32)
+                    STREAMS_ROUND(ROUND_20_39, c, d, e, a, b, 33)
+                    STREAMS_ROUND(ROUND_20_39, b, c, d, e, a, 34)
+                    STREAMS_ROUND(ROUND_20_39, a, b, c, d, e, 35)
+                    STREAMS_ROUND(ROUND_20_39, e, a, b, c, d, 36)
+                    STREAMS_ROUND(ROUND_20_39, d, e, a, b, c, 37)
+                    STREAMS_ROUND(ROUND_20_39, c, d, e, a, b, 38)
+                    STREAMS_ROUND(ROUND_20_39, b, c, d, e, a, 39)
+                    // rounds 40 - 59
+                    STREAMS_ROUND(ROUND_40_59, a, b, c, d, e, 40)
+                    STREAMS_ROUND(ROUND_40_59, e, a, b, c, d, 41)
+                    STREAMS_ROUND(ROUND_40_59, d, e, a, b, c, 42)
+                    STREAMS_ROUND(ROUND_40_59, c, d, e, a, b, 43)
+                    STREAMS_ROUND(ROUND_40_59, b, c, d, e, a, 44)
+                    STREAMS_ROUND(ROUND_40_59, a, b, c, d, e, 45)
+                    STREAMS_ROUND(ROUND_40_59, e, a, b, c, d, 46)
+                    STREAMS_ROUND(ROUND_40_59, d, e, a, b, c, 47)
+                    STREAMS_ROUND(ROUND_40_59, c, d, e, a, b, 48)
+                    STREAMS_ROUND(ROUND_40_59, b, c, d, e, a, 49)
+                    STREAMS_ROUND(ROUND_40_59, a, b, c, d, e, 50)
+                    STREAMS_ROUND(ROUND_40_59, e, a, b, c, d, 51)
+                    STREAMS_ROUND(ROUND_40_59, d, e, a, b, c, 52)
+                    STREAMS_ROUND(ROUND_40_59, c, d, e, a, b, 53)
+                    STREAMS_ROUND(ROUND_40_59, b, c, d, e, a, 54)
+                    STREAMS_ROUND(ROUND_40_59, a, b, c, d, e, 55)
+                    STREAMS_ROUND(ROUND_40_59, e, a, b, c, d, 56)
+                    STREAMS_ROUND(ROUND_40_59, d, e, a, b, c, 57)
+                    STREAMS_ROUND(ROUND_40_59, c, d, e, a, b, 58)
+                    STREAMS_ROUND(ROUND_40_59, b, c, d, e, a, 59)
+                    // rounds 60 - 71
+                    STREAMS_ROUND(ROUND_60_79, a, b, c, d, e, 60)
+                    STREAMS_ROUND(ROUND_60_79, e, a, b, c, d, 61)
+                    STREAMS_ROUND(ROUND_60_79, d, e, a, b, c, 62)
+                    STREAMS_ROUND(ROUND_60_79, c, d, e, a, b, 63)
+                    STREAMS_ROUND(ROUND_60_79, b, c, d, e, a, 64)
+                    STREAMS_ROUND(ROUND_60_79, a, b, c, d, e, 65)
+                    STREAMS_ROUND(ROUND_60_79, e, a, b, c, d, 66)
+                    STREAMS_ROUND(ROUND_60_79, d, e, a, b, c, 67)
+                    STREAMS_ROUND(ROUND_60_79, c, d, e, a, b, 68)
+                    STREAMS_ROUND(ROUND_60_79, b, c, d, e, a, 69)
+                    STREAMS_ROUND(ROUND_60_79, a, b, c, d, e, 70)
+                    STREAMS_ROUND(ROUND_60_79, e, a, b, c, d, 71)
+                    /**************************************************************/
+                    // early exit and the remaining rounds, one stream after the other
+                    reported = 0;
+                    FOR_STREAMS(STREAM_FINISH, 0)
+                    // stop early once every target has been found
+                    if(reported && atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                        return 0;
+                }
+            }
+    }
+    // if we end up here, targets are left after this slice
     return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: finishStream
+ */
+static inline int finishStream
+(
+    struct crackJob *p_job,
+    __m256i         a,
+    __m256i         b,
+    __m256i         c,
+    __m256i         d,
+    __m256i         e,
+    __m256i         *p_prefixBlocks,
+    __m256i         *p_w0,
+    __m256i         *p_blocks,
+    const __m256i   *p_vecRewind,
+    const char      *p_currInput,
+    int             stream
+)
+{
+    int                    index,
+                           mask,
+                           passed;
+    __m256i                vecTemp,
+                           vecBits;
+    // rewound results of rounds 74 - 71 (single target)
+    __m256i                r74, r73, r72, r71;
+    char                   p_candidate[6];
+    uint32_t               p_tempSave[8],
+                           p_stateSave[5][8],
+                           p_state[5];
+    const struct targetSet *p_targets = p_job->p_targets;
+    const __m256i          K_60_79 = SET1INT(0xCA62C1D6);
+    /***************** EARLY EXIT OPTIMIZATION *******************/
+    /*
+     *  For a single target, rounds 79 - 76 are rewound from the target, which
+     *  only needs word blocks 76 - 79, and compared against the result of round
+     *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+     *  block 79 (the target with round 79 undone) probes the filter of all
+     *  lanes with one gather first and, only for the lanes that pass, the sorted
+     *  keys to rule out false positives.
+     */
+    if(p_targets->numberOfTargets == 1)
+    {
+        precomputeBlocks76To79(p_prefixBlocks,
+                               p_w0,
+                               p_blocks);
+        REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+        mask = MOVEMASK(CMPEQ(VEC_LEFT_ROTATE(d, 30), r71));
+        if(LIKELY(mask == 0))
+            return 0;
+        COUNT(earlyExitPassed, __builtin_popcount(mask));
+        precomputeBlocks72To75(p_prefixBlocks,
+                               p_w0,
+                               p_blocks);
+        ROUND_60_79(d, e, a, b, c, p_blocks, 72)
+        ROUND_60_79(c, d, e, a, b, p_blocks, 73)
+        ROUND_60_79(b, c, d, e, a, p_blocks, 74)
+    }
+    else
+    {
+        precomputeBlocks72To75(p_prefixBlocks,
+                               p_w0,
+                               p_blocks);
+        p_blocks[79] = XOR(XOR(p_prefixBlocks[79], p_w0[8]), p_w0[22]);
+        ROUND_60_79(d, e, a, b, c, p_blocks, 72)
+        ROUND_60_79(c, d, e, a, b, p_blocks, 73)
+        ROUND_60_79(b, c, d, e, a, p_blocks, 74)
+        vecTemp = ADD(VEC_LEFT_ROTATE(a, 30), p_blocks[79]);
+        PROBE_FILTER(p_targets, vecTemp, vecBits, passed)
+        if(LIKELY(passed == 0))
+            return 0;
+        STORE(p_tempSave, vecTemp);
+        mask = 0;
+        for(index = 0; index < 8; index++)
+            if((passed & (1 << index)) && targetSetContainsKey(p_targets, p_tempSave[index]))
+                mask |= 1 << index;
+        if(LIKELY(mask == 0))
+            return 0;
+        precomputeBlocks76To79(p_prefixBlocks,
+                               p_w0,
+                               p_blocks);
+    }
+    // rounds 75 - 79
+    ROUND_60_79(a, b, c, d, e, p_blocks, 75)
+    ROUND_60_79(e, a, b, c, d, p_blocks, 76)
+    ROUND_60_79(d, e, a, b, c, p_blocks, 77)
+    ROUND_60_79(c, d, e, a, b, p_blocks, 78)
+    ROUND_60_79(b, c, d, e, a, p_blocks, 79)
+    STORE(p_stateSave[0], a);
+    STORE(p_stateSave[1], b);
+    STORE(p_stateSave[2], c);
+    STORE(p_stateSave[3], d);
+    STORE(p_stateSave[4], e);
+    /**************************************************************/
+    // compare the full state of every remaining lane against the targets
+    for(index = 0; index < 8; index++)
+    {
+        if(!(mask & (1 << index)))
+            continue;
+        p_state[0] = p_stateSave[0][index];
+        p_state[1] = p_stateSave[1][index];
+        p_state[2] = p_stateSave[2][index];
+        p_state[3] = p_stateSave[3][index];
+        p_state[4] = p_stateSave[4][index];
+        // set correct preimage of the lane (see p_tempSave above)
+        memcpy(p_candidate,
+               p_currInput,
+               PREIMAGE_LENGTH_BYTE);
+        p_candidate[0] += stream;
+        p_candidate[3] += (index & 1);
+        p_candidate[2] += (index & 2) >> 1;
+        p_candidate[1] += (index & 4) >> 2;
+        reportCandidate(p_job,
+                        p_state,
+                        p_candidate,
+                        PREIMAGE_LENGTH_BYTE);
+    }
 
-success:
-    // a preimage was found, copy it into p_result
-    memcpy(p_result,
-           p_currInput,
-           PREIMAGE_LENGTH_BYTE);
-
-    return 0;
+    return 1;
 }
 /**
  * Function: precomputeOuterLoop
@@ -515,6 +624,80 @@ static inline void precomputeOuterLoop
     p_vecPrecomputedBlocks[74] = VEC_LEFT_ROTATE(p_vecPrecomputedBlocks[74], 1);
     p_vecPrecomputedBlocks[75] = XOR(XOR(p_vecPrecomputedBlocks[72], p_vecPrecomputedBlocks[67]), XOR(p_vecPrecomputedBlocks[61], p_vecPrecomputedBlocks[59]));
     p_vecPrecomputedBlocks[75] = VEC_LEFT_ROTATE(p_vecPrecomputedBlocks[75], 1);
+    p_vecPrecomputedBlocks[76] = XOR(XOR(p_vecPrecomputedBlocks[73], p_vecPrecomputedBlocks[68]), XOR(p_vecPrecomputedBlocks[62], p_vecPrecomputedBlocks[60]));
+    p_vecPrecomputedBlocks[76] = VEC_LEFT_ROTATE(p_vecPrecomputedBlocks[76], 1);
+    p_vecPrecomputedBlocks[77] = XOR(XOR(p_vecPrecomputedBlocks[74], p_vecPrecomputedBlocks[69]), XOR(p_vecPrecomputedBlocks[63], p_vecPrecomputedBlocks[61]));
+    p_vecPrecomputedBlocks[77] = VEC_LEFT_ROTATE(p_vecPrecomputedBlocks[77], 1);
+    p_vecPrecomputedBlocks[78] = XOR(XOR(p_vecPrecomputedBlocks[75], p_vecPrecomputedBlocks[70]), XOR(p_vecPrecomputedBlocks[64], p_vecPrecomputedBlocks[62]));
+    p_vecPrecomputedBlocks[78] = VEC_LEFT_ROTATE(p_vecPrecomputedBlocks[78], 1);
+    p_vecPrecomputedBlocks[79] = XOR(XOR(p_vecPrecomputedBlocks[76], p_vecPrecomputedBlocks[71]), XOR(p_vecPrecomputedBlocks[65], p_vecPrecomputedBlocks[63]));
+    p_vecPrecomputedBlocks[79] = VEC_LEFT_ROTATE(p_vecPrecomputedBlocks[79], 1);
+}
+/**
+ * Function: rotatePrefix
+ */
+static inline void rotatePrefix
+(
+    __m256i vecPrefix,
+    __m256i *p_w0
+)
+{
+    // rotate the part of w0 that stays the same in the innermost loop
+    p_w0[ 1] = VEC_LEFT_ROTATE(vecPrefix,  1);
+    p_w0[ 2] = VEC_LEFT_ROTATE(vecPrefix,  2);
+    p_w0[ 3] = VEC_LEFT_ROTATE(vecPrefix,  3);
+    p_w0[ 4] = VEC_LEFT_ROTATE(vecPrefix,  4);
+    p_w0[ 5] = VEC_LEFT_ROTATE(vecPrefix,  5);
+    p_w0[ 6] = VEC_LEFT_ROTATE(vecPrefix,  6);
+    p_w0[ 7] = VEC_LEFT_ROTATE(vecPrefix,  7);
+    p_w0[ 8] = VEC_LEFT_ROTATE(vecPrefix,  8);
+    p_w0[ 9] = VEC_LEFT_ROTATE(vecPrefix,  9);
+    p_w0[10] = VEC_LEFT_ROTATE(vecPrefix, 10);
+    p_w0[11] = VEC_LEFT_ROTATE(vecPrefix, 11);
+    p_w0[12] = VEC_LEFT_ROTATE(vecPrefix, 12);
+    p_w0[13] = VEC_LEFT_ROTATE(vecPrefix, 13);
+    p_w0[14] = VEC_LEFT_ROTATE(vecPrefix, 14);
+    p_w0[15] = VEC_LEFT_ROTATE(vecPrefix, 15);
+    p_w0[16] = VEC_LEFT_ROTATE(vecPrefix, 16);
+    p_w0[17] = VEC_LEFT_ROTATE(vecPrefix, 17);
+    p_w0[18] = VEC_LEFT_ROTATE(vecPrefix, 18);
+    p_w0[19] = VEC_LEFT_ROTATE(vecPrefix, 19);
+    p_w0[20] = VEC_LEFT_ROTATE(vecPrefix, 20);
+    p_w0[21] = VEC_LEFT_ROTATE(vecPrefix, 21);
+    p_w0[22] = VEC_LEFT_ROTATE(vecPrefix, 22);
+}
+/**
+ * Function: shiftLowByte
+ */
+static inline void shiftLowByte
+(
+    __m256i vecLow,
+    __m256i *p_w0
+)
+{
+    // rotate byte 3 of w0, which only takes a shift (see VEC_LEFT_SHIFT)
+    p_w0[ 1] = VEC_LEFT_SHIFT(vecLow,  1);
+    p_w0[ 2] = VEC_LEFT_SHIFT(vecLow,  2);
+    p_w0[ 3] = VEC_LEFT_SHIFT(vecLow,  3);
+    p_w0[ 4] = VEC_LEFT_SHIFT(vecLow,  4);
+    p_w0[ 5] = VEC_LEFT_SHIFT(vecLow,  5);
+    p_w0[ 6] = VEC_LEFT_SHIFT(vecLow,  6);
+    p_w0[ 7] = VEC_LEFT_SHIFT(vecLow,  7);
+    p_w0[ 8] = VEC_LEFT_SHIFT(vecLow,  8);
+    p_w0[ 9] = VEC_LEFT_SHIFT(vecLow,  9);
+    p_w0[10] = VEC_LEFT_SHIFT(vecLow, 10);
+    p_w0[11] = VEC_LEFT_SHIFT(vecLow, 11);
+    p_w0[12] = VEC_LEFT_SHIFT(vecLow, 12);
+    p_w0[13] = VEC_LEFT_SHIFT(vecLow, 13);
+    p_w0[14] = VEC_LEFT_SHIFT(vecLow, 14);
+    p_w0[15] = VEC_LEFT_SHIFT(vecLow, 15);
+    p_w0[16] = VEC_LEFT_SHIFT(vecLow, 16);
+    p_w0[17] = VEC_LEFT_SHIFT(vecLow, 17);
+    p_w0[18] = VEC_LEFT_SHIFT(vecLow, 18);
+    p_w0[19] = VEC_LEFT_SHIFT(vecLow, 19);
+    p_w0[20] = VEC_LEFT_SHIFT(vecLow, 20);
+    p_w0[21] = VEC_LEFT_SHIFT(vecLow, 21);
+    p_w0[22] = VEC_LEFT_SHIFT(vecLow, 22);
 }
 /**
  * Function: precomputeInnerLoop
@@ -526,36 +709,20 @@ static inline void precomputeInnerLoop
     __m256i *p_blocks
 )
 {
-    // rotate w0
-    p_w0[ 1] = VEC_LEFT_ROTATE(p_blocks[0],  1);
-    p_w0[ 2] = VEC_LEFT_ROTATE(p_blocks[0],  2);
-    p_w0[ 3] = VEC_LEFT_ROTATE(p_blocks[0],  3);
-    p_w0[ 4] = VEC_LEFT_ROTATE(p_blocks[0],  4);
-    p_w0[ 5] = VEC_LEFT_ROTATE(p_blocks[0],  5);
-    p_w0[ 6] = VEC_LEFT_ROTATE(p_blocks[0],  6);
-    p_w0[ 7] = VEC_LEFT_ROTATE(p_blocks[0],  7);
-    p_w0[ 8] = VEC_LEFT_ROTATE(p_blocks[0],  8);
-    p_w0[ 9] = VEC_LEFT_ROTATE(p_blocks[0],  9);
-    p_w0[10] = VEC_LEFT_ROTATE(p_blocks[0], 10);
-    p_w0[11] = VEC_LEFT_ROTATE(p_blocks[0], 11);
-    p_w0[12] = VEC_LEFT_ROTATE(p_blocks[0], 12);
-    p_w0[13] = VEC_LEFT_ROTATE(p_blocks[0], 13);
-    p_w0[14] = VEC_LEFT_ROTATE(p_blocks[0], 14);
-    p_w0[15] = VEC_LEFT_ROTATE(p_blocks[0], 15);
-    p_w0[16] = VEC_LEFT_ROTATE(p_blocks[0], 16);
-    p_w0[17] = VEC_LEFT_ROTATE(p_blocks[0], 17);
-    p_w0[18] = VEC_LEFT_ROTATE(p_blocks[0], 18);
-    p_w0[19] = VEC_LEFT_ROTATE(p_blocks[0], 19);
-    p_w0[20] = VEC_LEFT_ROTATE(p_blocks[0], 20);
+    /*
+     *  Word blocks 16 - 71 are the precomputed blocks XOR the rotations of w0 in
+     *  p_w0. Called once with the rotated prefix (bytes 0 - 2) and then, on top
+     *  of those blocks, with the shifted byte 3 (see crackSliceAvx2).
+     */
     // precompute word blocks for inner loop (basis by Jens Steube)
     // note: slightly optimized for our special case of sha1-cracking
-    p_blocks[16] = p_w0[1];
+    p_blocks[16] = XOR(p_vecPrecomputedBlocks[16], p_w0[1]);
     p_blocks[17] = p_vecPrecomputedBlocks[17];
     p_blocks[18] = p_vecPrecomputedBlocks[18];
-    p_blocks[19] = p_w0[2];
+    p_blocks[19] = XOR(p_vecPrecomputedBlocks[19], p_w0[2]);
     p_blocks[20] = p_vecPrecomputedBlocks[20];
     p_blocks[21] = p_vecPrecomputedBlocks[21];
-    p_blocks[22] = p_w0[3];
+    p_blocks[22] = XOR(p_vecPrecomputedBlocks[22], p_w0[3]);
     p_blocks[23] = p_vecPrecomputedBlocks[23];
     p_blocks[24] = XOR(p_vecPrecomputedBlocks[24], p_w0[2]);
     p_blocks[25] = XOR(p_vecPrecomputedBlocks[25], p_w0[4]);
@@ -605,8 +772,36 @@ static inline void precomputeInnerLoop
     p_blocks[69] = p_vecPrecomputedBlocks[69];
     p_blocks[70] = XOR(XOR(p_vecPrecomputedBlocks[70], p_w0[12]), p_w0[19]);
     p_blocks[71] = XOR(XOR(p_vecPrecomputedBlocks[71], p_w0[12]), p_w0[16]);
+}
+/**
+ * Function: precomputeBlocks72To75
+ */
+static inline void precomputeBlocks72To75
+(
+    __m256i *p_vecPrecomputedBlocks,
+    __m256i *p_w0,
+    __m256i *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoop)
     p_blocks[72] = XOR(XOR(XOR(XOR(p_vecPrecomputedBlocks[72], p_w0[11]), XOR(p_w0[12], p_w0[18])), XOR(p_w0[13], p_w0[16])), p_w0[5]);
     p_blocks[73] = XOR(p_vecPrecomputedBlocks[73], p_w0[20]);
     p_blocks[74] = XOR(XOR(p_vecPrecomputedBlocks[74], p_w0[8]), p_w0[16]);
     p_blocks[75] = XOR(XOR(p_vecPrecomputedBlocks[75], p_w0[6]), XOR(p_w0[12], p_w0[14]));
 }
+/**
+ * Function: precomputeBlocks76To79
+ */
+static inline void precomputeBlocks76To79
+(
+    __m256i *p_vecPrecomputedBlocks,
+    __m256i *p_w0,
+    __m256i *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79, word block 77 does not depend on word block 0
+    p_blocks[76] = XOR(XOR(XOR(p_vecPrecomputedBlocks[76], p_w0[7]), XOR(p_w0[8], p_w0[12])), XOR(p_w0[16], p_w0[21]));
+    p_blocks[77] = p_vecPrecomputedBlocks[77];
+    p_blocks[78] = XOR(XOR(XOR(p_vecPrecomputedBlocks[78], p_w0[7]), XOR(p_w0[8], p_w0[15])), XOR(p_w0[18], p_w0[20]));
+    p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+}
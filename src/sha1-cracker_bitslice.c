@@ -0,0 +1,523 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// compile this kernel for AVX2, it is only called if the CPU supports it
+#pragma GCC target("avx2")
+// AVX2 (and other) intrinsics
+#include <immintrin.h>
+
+// macros for AVX2 intrinsics
+#define OR(x, y)          (_mm256_or_si256(x, y))
+#define XOR(x, y)         (_mm256_xor_si256(x, y))
+#define AND(x, y)         (_mm256_and_si256(x, y))
+#define ANDNOT(x, y)      (_mm256_andnot_si256(x, y))
+#define SET1INT(x)        (_mm256_set1_epi32(x))
+#define SETZERO           (_mm256_setzero_si256())
+#define SETONES           (_mm256_set1_epi32(-1))
+#define LOAD(loc)         (_mm256_loadu_si256((const __m256i *) (loc)))
+#define STORE(loc, x)     (_mm256_storeu_si256(((__m256i *) loc), x))
+#define SHIFT_LEFT(x, n)  (_mm256_slli_epi32(x, n))
+#define SHIFT_RIGHT(x, n) (_mm256_srli_epi32(x, n))
+#define IS_ZERO(x)        (_mm256_testz_si256(x, x))
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+// round constants
+#define K_00_19              UINT32_C(0x5A827999)
+#define K_20_39              UINT32_C(0x6ED9EBA1)
+#define K_40_59              UINT32_C(0x8F1BBCDC)
+#define K_60_79              UINT32_C(0xCA62C1D6)
+// length of preimage in bits (always 6 bytes)
+#define PREIMAGE_LENGTH_BIT  UINT32_C(0x00000030)
+// candidates per batch, one per bit of a register
+#define BITSLICE_LANES       256
+// candidates of a slice (four letters from 'a' to 'z')
+#define INNER_CANDIDATES     (26 * 26 * 26 * 26)
+
+// macros for f-functions
+#define VF_00_19(mB, mC, mD) (XOR(mD, (AND(mB, (XOR(mC, mD))))))
+#define VF_40_59(mB, mC, mD) (XOR(AND(mB, mC), (AND(mD, (XOR(mB, mC))))))
+#define VF_REST(mB, mC, mD)  (XOR((XOR(mB, mC)), mD))
+
+// macro for circular left-shift (adapted from RFC 3174)
+#define U32_LEFT_ROTATE(word, bits) (((word) << (bits)) | ((word) >> (32 - (bits))))
+/*
+ *  A word in bitsliced form is an array of 32 registers, register i holding
+ *  bit i of the word for each of the 256 candidates. Rotating a word only
+ *  renames its registers, and a bit shared by all candidates is a register of
+ *  all zeros or all ones.
+ */
+#define ROTATED_BIT(p_word, bits, i) ((p_word)[((i) - (bits)) & 31])
+#define UNIFORM_BIT(word, i)         (SET1INT(-(int32_t) (((word) >> (i)) & 1)))
+// one bit of a ripple-carry adder (a subtraction adds the complement with a carry of one)
+#define FULL_ADD(mSum, mX, mY, mCarry)                        \
+    vecAddend = (mY);                                         \
+    vecTemp   = XOR(mX, vecAddend);                           \
+    vecCarry  = OR(AND(mX, vecAddend), AND(vecTemp, mCarry)); \
+    mSum      = XOR(vecTemp, mCarry);                         \
+    mCarry    = vecCarry;
+#define FULL_SUB(mDifference, mX, mY, mCarry) \
+    FULL_ADD(mDifference, mX, XOR(mY, SETONES), mCarry)
+
+// function prototypes
+static void precomputeOuterLoop(const char *p_currInput,
+                                uint32_t   *p_uniform,
+                                uint32_t   *p_dependencies,
+                                int32_t    p_constants[80][32]);
+static inline void precomputeInnerLoop(__m256i  *p_w0,
+                                       uint32_t first);
+static inline void expandBlock(__m256i       *p_block,
+                               const __m256i *p_w0,
+                               uint32_t      uniform,
+                               uint32_t      dependencies);
+static inline void runRound(__m256i        p_history[6][32],
+                            __m256i        *p_block,
+                            const __m256i  *p_w0,
+                            const uint32_t *p_uniform,
+                            const uint32_t *p_dependencies,
+                            const int32_t  p_constants[80][32],
+                            unsigned int   round);
+static inline void runRoundFunction(__m256i       *p_result,
+                                    const __m256i *p_a,
+                                    const __m256i *p_b,
+                                    const __m256i *p_c,
+                                    const __m256i *p_d,
+                                    const __m256i *p_e,
+                                    const __m256i *p_block,
+                                    const int32_t *p_constant,
+                                    unsigned int  function) __attribute__((always_inline));
+static inline void transposeBitslices(__m256i *p_words);
+static void reportLanes(struct crackJob *p_job,
+                        const char      *p_currInput,
+                        uint32_t        first,
+                        const uint64_t  *p_lanes);
+
+/**
+ * Function: crackSliceBitslice
+ */
+int crackSliceBitslice
+(
+    struct crackJob *p_job,
+    uint64_t        slice
+)
+{
+    unsigned int           round,
+                           numberOfLanes;
+    uint32_t               first,
+                           p_uniform[80],
+                           p_dependencies[80],
+                           p_keys[32][8];
+    // round constants in bitsliced form (see precomputeOuterLoop)
+    int32_t                p_constants[80][32];
+    uint64_t               p_lanes[4];
+    char                   p_currInput[6];
+    __m256i                vecTemp, vecAddend, vecCarry, equal,
+                           carry0, carry1, carry2, carry3, carry4, carry5, carry6,
+                           m73, m72, m71, difference;
+    // results of the last six rounds (see runRound), bitsliced word block 0, word blocks
+    __m256i                p_history[6][32],
+                           p_w0[32],
+                           p_block[32],
+                           p_blocks76To79[4][32],
+                           p_m74[32];
+    const struct targetSet *p_targets = p_job->p_targets;
+    // the slice selects one of the two letter combinations of the outer loop
+    p_currInput[4] = 'a' + slice / 26;
+    p_currInput[5] = 'a' + slice % 26;
+    // split every word block into its part shared by the slice and the rotations of word block 0
+    CYCLES_START(outerStart);
+    precomputeOuterLoop(p_currInput,
+                        p_uniform,
+                        p_dependencies,
+                        p_constants);
+    CYCLES_STOP(outerCycles, outerStart);
+    COUNT(outerPrecomputes, 1);
+    // the four letters of the inner loop are numbered like in the other kernels, 256 at a time
+    for(first = 0; first < INNER_CANDIDATES; first += BITSLICE_LANES)
+    {
+        numberOfLanes = (INNER_CANDIDATES - first < BITSLICE_LANES) ? INNER_CANDIDATES - first : BITSLICE_LANES;
+        CYCLES_START(innerStart);
+        precomputeInnerLoop(p_w0,
+                            first);
+        CYCLES_STOP(innerCycles, innerStart);
+        COUNT(innerPrecomputes, 1);
+        COUNT(candidates, BITSLICE_LANES);
+        // the initial hash state as the results of rounds -1 to -5
+        for(unsigned int i = 0; i < 32; i++)
+        {
+            p_history[5][i] = UNIFORM_BIT(SHA1_IV_0, i);
+            p_history[4][i] = UNIFORM_BIT(SHA1_IV_1, i);
+            p_history[3][i] = UNIFORM_BIT(U32_LEFT_ROTATE(SHA1_IV_2, 2), i);
+            p_history[2][i] = UNIFORM_BIT(U32_LEFT_ROTATE(SHA1_IV_3, 2), i);
+            p_history[1][i] = UNIFORM_BIT(U32_LEFT_ROTATE(SHA1_IV_4, 2), i);
+        }
+        for(round = 0; round < 72; round++)
+            runRound(p_history,
+                     p_block,
+                     p_w0,
+                     p_uniform,
+                     p_dependencies,
+                     p_constants,
+                     round);
+        /***************** EARLY EXIT OPTIMIZATION *******************/
+        for(unsigned int i = 0; i < 4; i++)
+            expandBlock(p_blocks76To79[i],
+                        p_w0,
+                        p_uniform[76 + i],
+                        p_dependencies[76 + i]);
+        if(p_targets->numberOfTargets == 1)
+        {
+            /*
+             *  Rounds 79 - 76 are rewound from the target like in the other
+             *  kernels (see initTargetSet). The result of round 74 is needed in
+             *  full, the others are compared against the rotated result of round
+             *  71 bit by bit: usually no candidate is left after a few bits.
+             */
+            carry0 = SETONES;
+            for(unsigned int i = 0; i < 32; i++)
+            {
+                FULL_SUB(p_m74[i], UNIFORM_BIT(p_targets->p_rewind[0], i), p_blocks76To79[3][i], carry0)
+            }
+            carry1 = carry2 = carry3 = carry4 = carry5 = carry6 = SETONES;
+            equal  = SETONES;
+            for(unsigned int i = 0; i < 32 && !IS_ZERO(equal); i++)
+            {
+                FULL_SUB(m73, UNIFORM_BIT(p_targets->p_rewind[1], i),
+                         XOR(UNIFORM_BIT(p_targets->p_rewind[2], i), p_m74[i]), carry1)
+                FULL_SUB(m73, m73, p_blocks76To79[2][i], carry2)
+                FULL_SUB(m72, UNIFORM_BIT(p_targets->p_rewind[3], i),
+                         VF_REST(UNIFORM_BIT(p_targets->p_rewind[4], i), p_m74[i], m73), carry3)
+                FULL_SUB(m72, m72, p_blocks76To79[1][i], carry4)
+                FULL_SUB(m71, UNIFORM_BIT(p_targets->p_rewind[5], i),
+                         VF_REST(ROTATED_BIT(p_m74, 2, i), m73, m72), carry5)
+                FULL_SUB(m71, m71, p_blocks76To79[0][i], carry6)
+                // round 71 wrote history slot 71 % 6
+                difference = XOR(m71, ROTATED_BIT(p_history[5], 30, i));
+                equal      = ANDNOT(difference, equal);
+            }
+            if(LIKELY(IS_ZERO(equal)))
+                continue;
+            STORE(p_lanes, equal);
+        }
+        else
+        {
+            // rounds 72 - 74, then the rotated result of round 74 plus word block 79 probes the targets
+            for(round = 72; round < 75; round++)
+                runRound(p_history,
+                         p_block,
+                         p_w0,
+                         p_uniform,
+                         p_dependencies,
+                         p_constants,
+                         round);
+            carry0 = SETZERO;
+            for(unsigned int i = 0; i < 32; i++)
+            {
+                FULL_ADD(p_block[i], ROTATED_BIT(p_history[74 % 6], 30, i), p_blocks76To79[3][i], carry0)
+            }
+            // back to one word per candidate: p_block[k] holds candidates k, k + 32, ...
+            transposeBitslices(p_block);
+            for(unsigned int i = 0; i < 32; i++)
+                STORE(p_keys[i], p_block[i]);
+            p_lanes[0] = p_lanes[1] = p_lanes[2] = p_lanes[3] = 0;
+            for(unsigned int lane = 0; lane < numberOfLanes; lane++)
+                if(TARGET_SET_MAY_CONTAIN(p_targets, p_keys[lane % 32][lane / 32])
+                   && targetSetContainsKey(p_targets, p_keys[lane % 32][lane / 32]))
+                    p_lanes[lane / 64] |= UINT64_C(1) << (lane % 64);
+            if(LIKELY((p_lanes[0] | p_lanes[1] | p_lanes[2] | p_lanes[3]) == 0))
+                continue;
+        }
+        /**************************************************************/
+        // the lanes after the last candidate of the slice hold no candidate
+        for(unsigned int lane = numberOfLanes; lane < BITSLICE_LANES; lane++)
+            p_lanes[lane / 64] &= ~(UINT64_C(1) << (lane % 64));
+        reportLanes(p_job,
+                    p_currInput,
+                    first,
+                    p_lanes);
+        // stop early once every target has been found
+        if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+            return 0;
+    }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: precomputeOuterLoop
+ */
+static void precomputeOuterLoop
+(
+    const char *p_currInput,
+    uint32_t   *p_uniform,
+    uint32_t   *p_dependencies,
+    int32_t    p_constants[80][32]
+)
+{
+    uint32_t constant;
+    /*
+     *  Word block t is p_uniform[t] XOR the rotations of word block 0 by every
+     *  bit set in p_dependencies[t]. Word blocks 2 - 14 are zero and block 15
+     *  is the length, so most XORs of the expansion drop out here instead of
+     *  being repeated for every batch of candidates.
+     */
+    memset(p_uniform,
+           0,
+           16 * sizeof(uint32_t));
+    memset(p_dependencies,
+           0,
+           16 * sizeof(uint32_t));
+    // set second word block based on input ('1'-bit == 0x8000)
+    p_uniform[1]      = UINT32_C(0x8000)
+                      | ((uint32_t) p_currInput[4] << 24)
+                      | ((uint32_t) p_currInput[5] << 16);
+    p_uniform[15]     = PREIMAGE_LENGTH_BIT;
+    p_dependencies[0] = 1;
+    for(unsigned int t = 16; t < 80; t++)
+    {
+        p_uniform[t]      = p_uniform[t - 3] ^ p_uniform[t - 8] ^ p_uniform[t - 14] ^ p_uniform[t - 16];
+        p_uniform[t]      = U32_LEFT_ROTATE(p_uniform[t], 1);
+        p_dependencies[t] = p_dependencies[t - 3] ^ p_dependencies[t - 8]
+                          ^ p_dependencies[t - 14] ^ p_dependencies[t - 16];
+        p_dependencies[t] = U32_LEFT_ROTATE(p_dependencies[t], 1);
+    }
+    // a word block shared by all candidates is folded into the round constant
+    for(unsigned int t = 0; t < 80; t++)
+    {
+        constant = (t < 20) ? K_00_19 : (t < 40) ? K_20_39 : (t < 60) ? K_40_59 : K_60_79;
+        if(p_dependencies[t] == 0)
+            constant += p_uniform[t];
+        for(unsigned int i = 0; i < 32; i++)
+            p_constants[t][i] = -(int32_t) ((constant >> i) & 1);
+    }
+}
+/**
+ * Function: precomputeInnerLoop
+ */
+static inline void precomputeInnerLoop
+(
+    __m256i  *p_w0,
+    uint32_t first
+)
+{
+    uint32_t p_words[32][8],
+             p_letters[4];
+    // candidate i of the batch starts at p_words[i % 32][i / 32] (see transposeBitslices)
+    for(int i = 3; i >= 0; i--)
+    {
+        p_letters[i] = 'a' + first % 26;
+        first       /= 26;
+    }
+    for(unsigned int lane = 0; lane < BITSLICE_LANES; lane++)
+    {
+        p_words[lane % 32][lane / 32] = (p_letters[0] << 24)
+                                      | (p_letters[1] << 16)
+                                      | (p_letters[2] << 8)
+                                      | (p_letters[3]);
+        // lanes after the last candidate of a slice get letters past 'z'
+        for(int i = 3; i > 0 && ++p_letters[i] > 'z'; i--)
+        {
+            p_letters[i] = 'a';
+            if(i == 1)
+                p_letters[0]++;
+        }
+    }
+    for(unsigned int i = 0; i < 32; i++)
+        p_w0[i] = LOAD(p_words[i]);
+    transposeBitslices(p_w0);
+}
+/**
+ * Function: expandBlock
+ */
+static inline void expandBlock
+(
+    __m256i       *p_block,
+    const __m256i *p_w0,
+    uint32_t      uniform,
+    uint32_t      dependencies
+)
+{
+    unsigned int bits;
+    for(unsigned int i = 0; i < 32; i++)
+        p_block[i] = UNIFORM_BIT(uniform, i);
+    // rotating word block 0 is free, every rotation costs one XOR per bit
+    while(dependencies != 0)
+    {
+        bits          = (unsigned int) __builtin_ctz(dependencies);
+        dependencies &= dependencies - 1;
+        for(unsigned int i = 0; i < 32; i++)
+            p_block[i] = XOR(p_block[i], ROTATED_BIT(p_w0, bits, i));
+    }
+}
+/**
+ * Function: runRound
+ */
+static inline void runRound
+(
+    __m256i        p_history[6][32],
+    __m256i        *p_block,
+    const __m256i  *p_w0,
+    const uint32_t *p_uniform,
+    const uint32_t *p_dependencies,
+    const int32_t  p_constants[80][32],
+    unsigned int   round
+)
+{
+    /*
+     *  Round t writes its result to slot t % 6 and reads the results of rounds
+     *  t - 1 to t - 5 from the other slots: B is the result of round t - 2, C,
+     *  D and E the ones of rounds t - 3 to t - 5 rotated by 30.
+     */
+    const __m256i *p_a         = p_history[(round + 5) % 6],
+                  *p_b         = p_history[(round + 4) % 6],
+                  *p_c         = p_history[(round + 3) % 6],
+                  *p_d         = p_history[(round + 2) % 6],
+                  *p_e         = p_history[(round + 1) % 6];
+    __m256i       *p_result    = p_history[round % 6];
+    // word blocks shared by all candidates are part of the round constant
+    if(p_dependencies[round] != 0)
+        expandBlock(p_block,
+                    p_w0,
+                    p_uniform[round],
+                    p_dependencies[round]);
+    else
+        p_block = NULL;
+    if(round < 20)
+        runRoundFunction(p_result, p_a, p_b, p_c, p_d, p_e, p_block, p_constants[round], 0);
+    else if(round >= 40 && round < 60)
+        runRoundFunction(p_result, p_a, p_b, p_c, p_d, p_e, p_block, p_constants[round], 2);
+    else
+        runRoundFunction(p_result, p_a, p_b, p_c, p_d, p_e, p_block, p_constants[round], 1);
+}
+/**
+ * Function: runRoundFunction
+ */
+static inline void runRoundFunction
+(
+    __m256i       *p_result,
+    const __m256i *p_a,
+    const __m256i *p_b,
+    const __m256i *p_c,
+    const __m256i *p_d,
+    const __m256i *p_e,
+    const __m256i *p_block,
+    const int32_t *p_constant,
+    unsigned int  function
+)
+{
+    __m256i vecTemp, vecAddend, vecCarry, f, sum,
+            carry0 = SETZERO,
+            carry1 = SETZERO,
+            carry2 = SETZERO,
+            carry3 = SETZERO;
+    // all additions of the round run side by side, from the lowest bit to the highest one
+    #pragma GCC unroll 32
+    for(unsigned int i = 0; i < 32; i++)
+    {
+        if(function == 0)
+            f = VF_00_19(p_b[i], ROTATED_BIT(p_c, 30, i), ROTATED_BIT(p_d, 30, i));
+        else if(function == 2)
+            f = VF_40_59(p_b[i], ROTATED_BIT(p_c, 30, i), ROTATED_BIT(p_d, 30, i));
+        else
+            f = VF_REST(p_b[i], ROTATED_BIT(p_c, 30, i), ROTATED_BIT(p_d, 30, i));
+        FULL_ADD(sum, ROTATED_BIT(p_e, 30, i), f, carry0)
+        FULL_ADD(sum, sum, ROTATED_BIT(p_a, 5, i), carry1)
+        if(p_block != NULL)
+        {
+            FULL_ADD(sum, sum, p_block[i], carry2)
+        }
+        FULL_ADD(sum, sum, SET1INT(p_constant[i]), carry3)
+        p_result[i] = sum;
+    }
+}
+/**
+ * Function: transposeBitslices
+ */
+static inline void transposeBitslices
+(
+    __m256i *p_words
+)
+{
+    const uint32_t p_masks[5] = { UINT32_C(0x0000FFFF), UINT32_C(0x00FF00FF), UINT32_C(0x0F0F0F0F),
+                                  UINT32_C(0x33333333), UINT32_C(0x55555555) };
+    __m256i        mask,
+                   swapped;
+    /*
+     *  Transposes the eight 32x32 bit matrices held by the 32-bit elements of
+     *  p_words: bit k of element g of p_words[i] swaps with bit i of element g
+     *  of p_words[k]. Each step swaps the off-diagonal blocks of half the size.
+     */
+    for(unsigned int step = 0, width = 16; width > 0; step++, width >>= 1)
+    {
+        mask = SET1INT((int32_t) p_masks[step]);
+        for(unsigned int i = 0; i < 32; i++)
+        {
+            if(i & width)
+                continue;
+            swapped            = AND(XOR(SHIFT_RIGHT(p_words[i], width), p_words[i + width]), mask);
+            p_words[i]         = XOR(p_words[i], SHIFT_LEFT(swapped, width));
+            p_words[i + width] = XOR(p_words[i + width], swapped);
+        }
+    }
+}
+/**
+ * Function: reportLanes
+ */
+static void reportLanes
+(
+    struct crackJob *p_job,
+    const char      *p_currInput,
+    uint32_t        first,
+    const uint64_t  *p_lanes
+)
+{
+    uint32_t    candidate,
+                p_state[5];
+    char        p_candidate[6];
+    struct hash digest;
+    COUNT(earlyExitPassed, __builtin_popcountll(p_lanes[0]) + __builtin_popcountll(p_lanes[1])
+                           + __builtin_popcountll(p_lanes[2]) + __builtin_popcountll(p_lanes[3]));
+    // rare enough to hash the remaining candidates one by one instead of transposing the state
+    for(unsigned int lane = 0; lane < BITSLICE_LANES; lane++)
+    {
+        if(!(p_lanes[lane / 64] & (UINT64_C(1) << (lane % 64))))
+            continue;
+        candidate = first + lane;
+        for(int i = 3; i >= 0; i--)
+        {
+            p_candidate[i] = 'a' + candidate % 26;
+            candidate     /= 26;
+        }
+        p_candidate[4] = p_currInput[4];
+        p_candidate[5] = p_currInput[5];
+        sha1(p_candidate,
+             PREIMAGE_LENGTH_BYTE,
+             &digest);
+        p_state[0] = digest.a - SHA1_IV_0;
+        p_state[1] = digest.b - SHA1_IV_1;
+        p_state[2] = digest.c - SHA1_IV_2;
+        p_state[3] = digest.d - SHA1_IV_3;
+        p_state[4] = digest.e - SHA1_IV_4;
+        reportCandidate(p_job,
+                        p_state,
+                        p_candidate,
+                        PREIMAGE_LENGTH_BYTE);
+    }
+}
@@ -0,0 +1,751 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// fopen, fread, fwrite, fclose, ftell, fileno, rename, remove, snprintf
+#include <stdio.h>
+// malloc, realloc, calloc, free, qsort
+#include <stdlib.h>
+// fstat, struct stat
+#include <sys/stat.h>
+// clock_gettime
+#include <time.h>
+
+#define CHECKPOINT_MAGIC     "SHA1CKP"
+#define CHECKPOINT_VERSION   2
+// suffix of the file a checkpoint is written to before it replaces the old one
+#define CHECKPOINT_SUFFIX    ".tmp"
+// bytes of a target in the file: hash, found flag, result and class
+#define CHECKPOINT_TARGET_SIZE (sizeof(struct hash) + 1 + CRACK_RESULT_SIZE + sizeof(uint32_t))
+
+/*
+ *  File header (native byte order), followed by the targets, their results,
+ *  the class of every target and the completed slices of every class.
+ */
+struct checkpointHeader
+{
+	char     p_magic[8];
+	uint32_t version;
+	uint32_t minLength;
+	uint32_t maxLength;
+	uint32_t p_charsetLengths[CRACK_MAX_PREIMAGE_LENGTH];
+	char     p_charsets[CRACK_MAX_PREIMAGE_LENGTH][256];
+	uint64_t numberOfSlices;
+	uint64_t numberOfTargets;
+	uint64_t numberOfClasses;
+};
+
+// a target of the checkpoint file, sorted by hash to find the targets of the resumed sweep
+struct fileTarget
+{
+	struct hash target;
+	uint64_t    index;
+};
+
+// function prototypes
+static int readCheckpoint(struct checkpointState *p_state,
+                          FILE                   *p_file);
+static int readClass(const struct checkpointState *p_state,
+                     struct checkpointClass       *p_class,
+                     FILE                         *p_file);
+static int mapClasses(struct checkpointState *p_state);
+static int writeCheckpoint(struct crackJob *p_job);
+static int writeClass(const struct checkpointState *p_state,
+                      const struct checkpointClass *p_class,
+                      FILE                         *p_file);
+static void fillHeader(const struct checkpointState *p_state,
+                       struct checkpointHeader      *p_header);
+static void freeClasses(struct checkpointState *p_state);
+static int isClassCompleted(const struct checkpointClass *p_class,
+                            uint64_t                     slice);
+static int isSliceCompleted(const struct checkpointState *p_state,
+                            uint64_t                     slice);
+static time_t getSeconds(void);
+static int compareSlices(const void *p_left,
+                         const void *p_right);
+static int compareFileTargets(const void *p_left,
+                              const void *p_right);
+
+/**
+ * Function: initCheckpointState
+ */
+int initCheckpointState
+(
+    struct checkpointState      *p_state,
+    const struct checkpoint     *p_checkpoint,
+    const struct keyspaceLayout *p_layout,
+    const struct hash           *p_targets,
+    size_t                      numberOfTargets,
+    uint64_t                    numberOfSlices
+)
+{
+    int  result = 0;
+    FILE *p_file;
+    memset(p_state,
+           0,
+           sizeof(struct checkpointState));
+    p_state->p_checkpoint    = p_checkpoint;
+    p_state->p_layout        = p_layout;
+    p_state->p_targets       = p_targets;
+    p_state->numberOfTargets = numberOfTargets;
+    p_state->numberOfSlices  = numberOfSlices;
+    p_state->lastWrite       = getSeconds();
+    // without a checkpoint file the sweep starts from scratch: one class, no slices completed
+    if((p_file = fopen(p_checkpoint->p_path, "rb")) != NULL)
+    {
+        result = readCheckpoint(p_state,
+                                p_file);
+        fclose(p_file);
+    }
+    else
+    {
+        p_state->p_targetClasses = calloc(numberOfTargets + 1, sizeof(uint32_t));
+        p_state->p_classes       = calloc(1, sizeof(struct checkpointClass));
+        p_state->numberOfClasses = (p_state->p_classes != NULL);
+        if(p_state->p_targetClasses == NULL || p_state->p_classes == NULL)
+            result = E_CRACK_OUT_OF_MEMORY;
+    }
+    if(result == 0 && pthread_mutex_init(&p_state->mutex, NULL) != 0)
+        result = E_CRACK_OUT_OF_MEMORY;
+    if(result != 0)
+    {
+        freeClasses(p_state);
+        free(p_state->p_restoredFound);
+        free(p_state->p_restoredResults);
+        p_state->p_restoredFound   = NULL;
+        p_state->p_restoredResults = NULL;
+        return result;
+    }
+
+    return 0;
+}
+/**
+ * Function: restoreCheckpoint
+ */
+int restoreCheckpoint
+(
+    struct checkpointState *p_state,
+    struct crackJob        *p_job
+)
+{
+    size_t      numberOfTargets;
+    size_t      *p_indices;
+    struct hash *p_hashes;
+    // resolved targets keep their preimage
+    for(size_t i = 0; i < p_state->numberOfTargets && p_state->p_restoredFound != NULL; i++)
+    {
+        if(!p_state->p_restoredFound[i])
+            continue;
+        memcpy(p_job->p_results + i * CRACK_RESULT_SIZE,
+               p_state->p_restoredResults + i * CRACK_RESULT_SIZE,
+               CRACK_RESULT_SIZE);
+        atomic_store(&p_job->p_found[i],
+                     CRACK_FOUND_WRITTEN);
+        atomic_fetch_add(&p_job->numberOfFound,
+                         1);
+    }
+    /*
+     *  Every later class gets a job for the slices the earlier ones are done
+     *  with. It shares found flags and results with the job itself, so its
+     *  entries point to the targets' positions in the caller's array.
+     */
+    p_hashes  = malloc((p_state->numberOfTargets + 1) * sizeof(struct hash));
+    p_indices = malloc((p_state->numberOfTargets + 1) * sizeof(size_t));
+    if(p_hashes == NULL || p_indices == NULL)
+    {
+        free(p_hashes);
+        free(p_indices);
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    for(uint32_t i = 1; i < p_state->numberOfClasses; i++)
+    {
+        numberOfTargets = 0;
+        for(size_t j = 0; j < p_state->numberOfTargets; j++)
+        {
+            if(p_state->p_targetClasses[j] < i)
+                continue;
+            p_hashes[numberOfTargets]    = p_state->p_targets[j];
+            p_indices[numberOfTargets++] = j;
+        }
+        p_state->p_classes[i].p_job = malloc(sizeof(struct crackJob));
+        if(p_state->p_classes[i].p_job == NULL
+           || initTargetSet(&p_state->p_classes[i].targets, p_hashes, numberOfTargets) != 0)
+        {
+            free(p_state->p_classes[i].p_job);
+            p_state->p_classes[i].p_job = NULL;
+            free(p_hashes);
+            free(p_indices);
+            return E_CRACK_OUT_OF_MEMORY;
+        }
+        for(size_t j = 0; j < numberOfTargets; j++)
+            p_state->p_classes[i].targets.p_entries[j].index = p_indices[p_state->p_classes[i].targets.p_entries[j].index];
+        *p_state->p_classes[i].p_job              = *p_job;
+        p_state->p_classes[i].p_job->p_targets    = &p_state->p_classes[i].targets;
+        p_state->p_classes[i].p_job->p_checkpoint = NULL;
+        p_state->p_classes[i].p_job->p_progress   = NULL;
+        atomic_init(&p_state->p_classes[i].p_job->numberOfFound, 0);
+    }
+    free(p_hashes);
+    free(p_indices);
+    // the sweep continues after the slices every class is done with
+    atomic_store(&p_job->nextSlice,
+                 p_state->completedBelow);
+
+    return 0;
+}
+/**
+ * Function: getSliceJob
+ */
+struct crackJob *getSliceJob
+(
+    const struct checkpointState *p_state,
+    struct crackJob              *p_job,
+    uint64_t                     slice
+)
+{
+    // the first class that has not seen the slice sweeps it together with all later ones
+    for(uint32_t i = 0; i < p_state->numberOfClasses; i++)
+        if(!isClassCompleted(&p_state->p_classes[i], slice))
+            return (i == 0) ? p_job : p_state->p_classes[i].p_job;
+
+    return NULL;
+}
+/**
+ * Function: completeSlice
+ */
+int completeSlice
+(
+    struct crackJob *p_job,
+    uint64_t        slice
+)
+{
+    struct checkpointState *p_state = p_job->p_checkpoint;
+    uint64_t               *p_completed;
+    int                    result   = 0;
+    time_t                 now;
+    pthread_mutex_lock(&p_state->mutex);
+    // slices finish out of order, only the ones above completedBelow are listed
+    if(slice == p_state->completedBelow)
+    {
+        p_state->completedBelow++;
+        while(isSliceCompleted(p_state, p_state->completedBelow))
+        {
+            for(size_t i = 0; i < p_state->numberOfCompleted; i++)
+            {
+                if(p_state->p_completed[i] == p_state->completedBelow)
+                {
+                    p_state->p_completed[i] = p_state->p_completed[--p_state->numberOfCompleted];
+                    break;
+                }
+            }
+            p_state->completedBelow++;
+        }
+    }
+    else
+    {
+        if(p_state->numberOfCompleted == p_state->capacity)
+        {
+            p_completed = realloc(p_state->p_completed,
+                                  (2 * p_state->capacity + 16) * sizeof(uint64_t));
+            if(p_completed == NULL)
+            {
+                pthread_mutex_unlock(&p_state->mutex);
+                return E_CRACK_OUT_OF_MEMORY;
+            }
+            p_state->p_completed = p_completed;
+            p_state->capacity    = 2 * p_state->capacity + 16;
+        }
+        p_state->p_completed[p_state->numberOfCompleted++] = slice;
+    }
+    now = getSeconds();
+    if(now - p_state->lastWrite >= (time_t) p_state->p_checkpoint->interval)
+    {
+        result             = writeCheckpoint(p_job);
+        p_state->lastWrite = now;
+    }
+    pthread_mutex_unlock(&p_state->mutex);
+
+    return result;
+}
+/**
+ * Function: freeCheckpointState
+ */
+void freeCheckpointState
+(
+    struct checkpointState *p_state,
+    int                    isFinished
+)
+{
+    char p_temp[4096];
+    // a finished sweep has nothing left to resume
+    if(isFinished)
+    {
+        remove(p_state->p_checkpoint->p_path);
+        if(snprintf(p_temp, sizeof(p_temp), "%s" CHECKPOINT_SUFFIX, p_state->p_checkpoint->p_path)
+           < (int) sizeof(p_temp))
+            remove(p_temp);
+    }
+    pthread_mutex_destroy(&p_state->mutex);
+    freeClasses(p_state);
+    free(p_state->p_completed);
+    free(p_state->p_restoredFound);
+    free(p_state->p_restoredResults);
+    p_state->p_completed       = NULL;
+    p_state->p_restoredFound   = NULL;
+    p_state->p_restoredResults = NULL;
+}
+/**
+ * Function: readCheckpoint
+ */
+static int readCheckpoint
+(
+    struct checkpointState *p_state,
+    FILE                   *p_file
+)
+{
+    int                     result          = 0;
+    size_t                  numberOfTargets = p_state->numberOfTargets;
+    uint32_t                *p_fileClasses  = NULL;
+    unsigned char           *p_fileFound    = NULL;
+    char                    *p_fileResults  = NULL;
+    struct fileTarget       *p_fileTargets  = NULL,
+                            *p_match,
+                            key;
+    struct checkpointHeader header,
+                            expected;
+    struct stat             status;
+    long                    position;
+    if(fread(&header, sizeof(header), 1, p_file) != 1)
+        return E_CRACK_BAD_CHECKPOINT;
+    // the targets must fit into the rest of the file, so a corrupt count can't overflow the sizes below
+    if(fstat(fileno(p_file), &status) != 0
+       || (position = ftell(p_file)) < 0
+       || status.st_size < position
+       || header.numberOfTargets > (uint64_t) (status.st_size - position) / CHECKPOINT_TARGET_SIZE)
+        return E_CRACK_BAD_CHECKPOINT;
+    // a checkpoint only resumes a sweep of the same keyspace, the targets may change
+    fillHeader(p_state,
+               &expected);
+    if(memcmp(header.p_magic, expected.p_magic, sizeof(header.p_magic)) != 0
+       || header.version != expected.version
+       || header.minLength != expected.minLength
+       || header.maxLength != expected.maxLength
+       || memcmp(header.p_charsetLengths, expected.p_charsetLengths, sizeof(header.p_charsetLengths)) != 0
+       || memcmp(header.p_charsets, expected.p_charsets, sizeof(header.p_charsets)) != 0
+       || header.numberOfSlices != expected.numberOfSlices
+       || header.numberOfClasses > header.numberOfTargets + 1)
+        return E_CRACK_BAD_CHECKPOINT;
+    p_fileTargets              = malloc((header.numberOfTargets + 1) * sizeof(struct fileTarget));
+    p_fileFound                = malloc(header.numberOfTargets + 1);
+    p_fileResults              = malloc((header.numberOfTargets + 1) * CRACK_RESULT_SIZE);
+    p_fileClasses              = malloc((header.numberOfTargets + 1) * sizeof(uint32_t));
+    p_state->p_restoredFound   = calloc(numberOfTargets + 1, sizeof(unsigned char));
+    p_state->p_restoredResults = calloc(numberOfTargets + 1, CRACK_RESULT_SIZE);
+    p_state->p_targetClasses   = malloc((numberOfTargets + 1) * sizeof(uint32_t));
+    // one more class for the targets that are not in the file
+    p_state->p_classes         = calloc(header.numberOfClasses + 1, sizeof(struct checkpointClass));
+    if(p_fileTargets == NULL || p_fileFound == NULL || p_fileResults == NULL || p_fileClasses == NULL
+       || p_state->p_restoredFound == NULL || p_state->p_restoredResults == NULL
+       || p_state->p_targetClasses == NULL || p_state->p_classes == NULL)
+        result = E_CRACK_OUT_OF_MEMORY;
+    for(uint64_t i = 0; i < header.numberOfTargets && result == 0; i++)
+    {
+        if(fread(&p_fileTargets[i].target, sizeof(struct hash), 1, p_file) != 1)
+            result = E_CRACK_BAD_CHECKPOINT;
+        else
+            p_fileTargets[i].index = i;
+    }
+    if(result == 0
+       && (fread(p_fileFound, sizeof(unsigned char), header.numberOfTargets, p_file) != header.numberOfTargets
+           || fread(p_fileResults, CRACK_RESULT_SIZE, header.numberOfTargets, p_file) != header.numberOfTargets
+           || fread(p_fileClasses, sizeof(uint32_t), header.numberOfTargets, p_file) != header.numberOfTargets))
+        result = E_CRACK_BAD_CHECKPOINT;
+    while(result == 0 && p_state->numberOfClasses < header.numberOfClasses)
+        result = readClass(p_state,
+                           &p_state->p_classes[p_state->numberOfClasses++],
+                           p_file);
+    for(uint64_t i = 0; i < header.numberOfTargets && result == 0; i++)
+        if(p_fileClasses[i] >= header.numberOfClasses)
+            result = E_CRACK_BAD_CHECKPOINT;
+    // targets of the resumed sweep take over class and result of the same target in the file
+    if(result == 0)
+        qsort(p_fileTargets,
+              header.numberOfTargets,
+              sizeof(struct fileTarget),
+              compareFileTargets);
+    for(size_t i = 0; i < numberOfTargets && result == 0; i++)
+    {
+        key.target = p_state->p_targets[i];
+        p_match    = bsearch(&key,
+                             p_fileTargets,
+                             header.numberOfTargets,
+                             sizeof(struct fileTarget),
+                             compareFileTargets);
+        if(p_match == NULL)
+        {
+            p_state->p_targetClasses[i] = header.numberOfClasses;
+            continue;
+        }
+        p_state->p_targetClasses[i] = p_fileClasses[p_match->index];
+        p_state->p_restoredFound[i] = (p_fileFound[p_match->index] != 0);
+        memcpy(p_state->p_restoredResults + i * CRACK_RESULT_SIZE,
+               p_fileResults + p_match->index * CRACK_RESULT_SIZE,
+               CRACK_RESULT_SIZE);
+        p_state->p_restoredResults[i * CRACK_RESULT_SIZE + CRACK_MAX_PREIMAGE_LENGTH] = '\0';
+    }
+    if(result == 0)
+        result = mapClasses(p_state);
+    free(p_fileTargets);
+    free(p_fileFound);
+    free(p_fileResults);
+    free(p_fileClasses);
+
+    return result;
+}
+/**
+ * Function: readClass
+ */
+static int readClass
+(
+    const struct checkpointState *p_state,
+    struct checkpointClass       *p_class,
+    FILE                         *p_file
+)
+{
+    uint64_t numberOfCompleted;
+    if(fread(&p_class->completedBelow, sizeof(uint64_t), 1, p_file) != 1
+       || fread(&numberOfCompleted, sizeof(uint64_t), 1, p_file) != 1
+       || p_class->completedBelow > p_state->numberOfSlices
+       || numberOfCompleted > p_state->numberOfSlices - p_class->completedBelow)
+        return E_CRACK_BAD_CHECKPOINT;
+    p_class->p_completed = malloc((numberOfCompleted + 1) * sizeof(uint64_t));
+    if(p_class->p_completed == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    if(fread(p_class->p_completed, sizeof(uint64_t), numberOfCompleted, p_file) != numberOfCompleted)
+        return E_CRACK_BAD_CHECKPOINT;
+    for(uint64_t i = 0; i < numberOfCompleted; i++)
+        if(p_class->p_completed[i] < p_class->completedBelow || p_class->p_completed[i] >= p_state->numberOfSlices)
+            return E_CRACK_BAD_CHECKPOINT;
+    qsort(p_class->p_completed,
+          numberOfCompleted,
+          sizeof(uint64_t),
+          compareSlices);
+    p_class->numberOfCompleted = numberOfCompleted;
+
+    return 0;
+}
+/**
+ * Function: mapClasses
+ */
+static int mapClasses
+(
+    struct checkpointState *p_state
+)
+{
+    uint32_t numberOfClasses = 0,
+             numberOfRead    = p_state->numberOfClasses,
+             *p_newClasses;
+    p_newClasses = malloc((numberOfRead + 1) * sizeof(uint32_t));
+    if(p_newClasses == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    // the targets of the resumed sweep that are not in the file form the last class
+    for(uint32_t i = 0; i <= numberOfRead; i++)
+        p_newClasses[i] = UINT32_MAX;
+    for(size_t i = 0; i < p_state->numberOfTargets; i++)
+        p_newClasses[p_state->p_targetClasses[i]] = 0;
+    /*
+     *  Classes without targets are dropped. A class that has seen the same
+     *  slices as the one before (both are written from the same sweep) joins
+     *  it, so the number of classes does not grow with every resumed sweep.
+     */
+    for(uint32_t i = 0; i <= numberOfRead; i++)
+    {
+        if(p_newClasses[i] == UINT32_MAX)
+        {
+            free(p_state->p_classes[i].p_completed);
+            p_state->p_classes[i].p_completed = NULL;
+            continue;
+        }
+        if(numberOfClasses > 0
+           && p_state->p_classes[i].completedBelow == p_state->p_classes[numberOfClasses - 1].completedBelow
+           && p_state->p_classes[i].numberOfCompleted == p_state->p_classes[numberOfClasses - 1].numberOfCompleted
+           && (p_state->p_classes[i].numberOfCompleted == 0
+               || memcmp(p_state->p_classes[i].p_completed,
+                         p_state->p_classes[numberOfClasses - 1].p_completed,
+                         p_state->p_classes[i].numberOfCompleted * sizeof(uint64_t)) == 0))
+        {
+            free(p_state->p_classes[i].p_completed);
+            p_state->p_classes[i].p_completed = NULL;
+            p_newClasses[i]                   = numberOfClasses - 1;
+            continue;
+        }
+        p_state->p_classes[numberOfClasses] = p_state->p_classes[i];
+        if(i != numberOfClasses)
+            p_state->p_classes[i].p_completed = NULL;
+        p_newClasses[i] = numberOfClasses++;
+    }
+    for(size_t i = 0; i < p_state->numberOfTargets; i++)
+        p_state->p_targetClasses[i] = p_newClasses[p_state->p_targetClasses[i]];
+    free(p_newClasses);
+    p_state->numberOfClasses = numberOfClasses;
+    // the sweep starts at the first slice a class has not seen
+    p_state->completedBelow = p_state->numberOfSlices;
+    for(uint32_t i = 0; i < numberOfClasses; i++)
+        if(p_state->p_classes[i].completedBelow < p_state->completedBelow)
+            p_state->completedBelow = p_state->p_classes[i].completedBelow;
+
+    return 0;
+}
+/**
+ * Function: writeCheckpoint
+ */
+static int writeCheckpoint
+(
+    struct crackJob *p_job
+)
+{
+    struct checkpointState  *p_state = p_job->p_checkpoint;
+    struct checkpointHeader header;
+    unsigned char           found;
+    char                    p_temp[4096],
+                            p_empty[CRACK_RESULT_SIZE] = { 0 };
+    int                     result   = 0;
+    FILE                    *p_file;
+    fillHeader(p_state,
+               &header);
+    header.numberOfClasses = p_state->numberOfClasses;
+    /*
+     *  The new state goes to a temporary file first and replaces the old one
+     *  in a single rename, so a process killed while writing still leaves a
+     *  complete checkpoint behind.
+     */
+    if(snprintf(p_temp, sizeof(p_temp), "%s" CHECKPOINT_SUFFIX, p_state->p_checkpoint->p_path)
+       >= (int) sizeof(p_temp))
+        return E_CRACK_IO;
+    if((p_file = fopen(p_temp, "wb")) == NULL)
+        return E_CRACK_IO;
+    if(fwrite(&header, sizeof(header), 1, p_file) != 1
+       || fwrite(p_state->p_targets, sizeof(struct hash), p_state->numberOfTargets, p_file)
+          != p_state->numberOfTargets)
+        result = E_CRACK_IO;
+    // a preimage still being written by another worker is left for the next checkpoint
+    for(size_t i = 0; i < p_state->numberOfTargets && result == 0; i++)
+    {
+        found = atomic_load(&p_job->p_found[i]) == CRACK_FOUND_WRITTEN;
+        if(fwrite(&found, sizeof(found), 1, p_file) != 1)
+            result = E_CRACK_IO;
+    }
+    for(size_t i = 0; i < p_state->numberOfTargets && result == 0; i++)
+        if(fwrite((atomic_load(&p_job->p_found[i]) == CRACK_FOUND_WRITTEN)
+                  ? p_job->p_results + i * CRACK_RESULT_SIZE : p_empty,
+                  CRACK_RESULT_SIZE,
+                  1,
+                  p_file) != 1)
+            result = E_CRACK_IO;
+    if(result == 0
+       && fwrite(p_state->p_targetClasses, sizeof(uint32_t), p_state->numberOfTargets, p_file)
+          != p_state->numberOfTargets)
+        result = E_CRACK_IO;
+    for(uint32_t i = 0; i < p_state->numberOfClasses && result == 0; i++)
+        result = writeClass(p_state,
+                            &p_state->p_classes[i],
+                            p_file);
+    if(fclose(p_file) != 0)
+        result = E_CRACK_IO;
+    if(result == 0 && rename(p_temp, p_state->p_checkpoint->p_path) != 0)
+        result = E_CRACK_IO;
+    if(result != 0)
+        remove(p_temp);
+
+    return result;
+}
+/**
+ * Function: writeClass
+ */
+static int writeClass
+(
+    const struct checkpointState *p_state,
+    const struct checkpointClass *p_class,
+    FILE                         *p_file
+)
+{
+    int      result            = 0;
+    size_t   numberOfCompleted = 0,
+             first             = 0;
+    uint64_t completedBelow    = p_class->completedBelow,
+             *p_completed;
+    // a class has seen its own slices and every one completed since the sweep was resumed
+    if(p_state->completedBelow > completedBelow)
+        completedBelow = p_state->completedBelow;
+    p_completed = malloc((p_class->numberOfCompleted + p_state->numberOfCompleted + 1) * sizeof(uint64_t));
+    if(p_completed == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    for(size_t i = 0; i < p_class->numberOfCompleted; i++)
+        if(p_class->p_completed[i] >= completedBelow)
+            p_completed[numberOfCompleted++] = p_class->p_completed[i];
+    for(size_t i = 0; i < p_state->numberOfCompleted; i++)
+        if(p_state->p_completed[i] >= completedBelow)
+            p_completed[numberOfCompleted++] = p_state->p_completed[i];
+    qsort(p_completed,
+          numberOfCompleted,
+          sizeof(uint64_t),
+          compareSlices);
+    // the same slices are always written the same way, so equal classes are merged on reading
+    for(size_t i = 0; i < numberOfCompleted; i++)
+        if(first == 0 || p_completed[i] != p_completed[first - 1])
+            p_completed[first++] = p_completed[i];
+    numberOfCompleted = first;
+    for(first = 0; first < numberOfCompleted && p_completed[first] == completedBelow; first++)
+        completedBelow++;
+    numberOfCompleted -= first;
+    if(fwrite(&completedBelow, sizeof(uint64_t), 1, p_file) != 1
+       || fwrite(&numberOfCompleted, sizeof(uint64_t), 1, p_file) != 1
+       || fwrite(p_completed + first, sizeof(uint64_t), numberOfCompleted, p_file) != numberOfCompleted)
+        result = E_CRACK_IO;
+    free(p_completed);
+
+    return result;
+}
+/**
+ * Function: fillHeader
+ */
+static void fillHeader
+(
+    const struct checkpointState *p_state,
+    struct checkpointHeader      *p_header
+)
+{
+    memset(p_header,
+           0,
+           sizeof(struct checkpointHeader));
+    memcpy(p_header->p_magic,
+           CHECKPOINT_MAGIC,
+           sizeof(CHECKPOINT_MAGIC));
+    p_header->version         = CHECKPOINT_VERSION;
+    p_header->minLength       = p_state->p_layout->minLength;
+    p_header->maxLength       = p_state->p_layout->maxLength;
+    p_header->numberOfSlices  = p_state->numberOfSlices;
+    p_header->numberOfTargets = p_state->numberOfTargets;
+    for(unsigned int i = 0; i < CRACK_MAX_PREIMAGE_LENGTH; i++)
+    {
+        p_header->p_charsetLengths[i] = p_state->p_layout->p_charsetLengths[i];
+        memcpy(p_header->p_charsets[i],
+               p_state->p_layout->p_charsets[i],
+               p_state->p_layout->p_charsetLengths[i]);
+    }
+}
+/**
+ * Function: freeClasses
+ */
+static void freeClasses
+(
+    struct checkpointState *p_state
+)
+{
+    for(uint32_t i = 0; i < p_state->numberOfClasses; i++)
+    {
+        free(p_state->p_classes[i].p_completed);
+        if(p_state->p_classes[i].p_job != NULL)
+        {
+            freeTargetSet(&p_state->p_classes[i].targets);
+            free(p_state->p_classes[i].p_job);
+        }
+    }
+    free(p_state->p_classes);
+    free(p_state->p_targetClasses);
+    p_state->p_classes       = NULL;
+    p_state->p_targetClasses = NULL;
+    p_state->numberOfClasses = 0;
+}
+/**
+ * Function: isClassCompleted
+ */
+static int isClassCompleted
+(
+    const struct checkpointClass *p_class,
+    uint64_t                     slice
+)
+{
+    // a class without completed slices above completedBelow has no list to search
+    return slice < p_class->completedBelow
+           || (p_class->numberOfCompleted > 0
+               && bsearch(&slice,
+                          p_class->p_completed,
+                          p_class->numberOfCompleted,
+                          sizeof(uint64_t),
+                          compareSlices) != NULL);
+}
+/**
+ * Function: isSliceCompleted
+ */
+static int isSliceCompleted
+(
+    const struct checkpointState *p_state,
+    uint64_t                     slice
+)
+{
+    for(size_t i = 0; i < p_state->numberOfCompleted; i++)
+        if(p_state->p_completed[i] == slice)
+            return 1;
+
+    for(uint32_t i = 0; i < p_state->numberOfClasses; i++)
+        if(!isClassCompleted(&p_state->p_classes[i], slice))
+            return 0;
+
+    return 1;
+}
+/**
+ * Function: getSeconds
+ */
+static time_t getSeconds
+(
+    void
+)
+{
+    struct timespec now;
+    // monotonic, so adjusting the wall clock does not delay or flood checkpoints
+    clock_gettime(CLOCK_MONOTONIC,
+                  &now);
+
+    return now.tv_sec;
+}
+/**
+ * Function: compareSlices
+ */
+static int compareSlices
+(
+    const void *p_left,
+    const void *p_right
+)
+{
+    uint64_t left  = *(const uint64_t *) p_left,
+             right = *(const uint64_t *) p_right;
+
+    return (left > right) - (left < right);
+}
+/**
+ * Function: compareFileTargets
+ */
+static int compareFileTargets
+(
+    const void *p_left,
+    const void *p_right
+)
+{
+    return memcmp(&((const struct fileTarget *) p_left)->target,
+                  &((const struct fileTarget *) p_right)->target,
+                  sizeof(struct hash));
+}
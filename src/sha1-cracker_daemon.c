@@ -0,0 +1,1103 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// errno, EINTR
+#include <errno.h>
+// fcntl, O_NONBLOCK
+#include <fcntl.h>
+// poll, struct pollfd
+#include <poll.h>
+// snprintf
+#include <stdio.h>
+// malloc, realloc, calloc, free
+#include <stdlib.h>
+// socket, bind, listen, accept, send, MSG_NOSIGNAL
+#include <sys/socket.h>
+// struct sockaddr_un
+#include <sys/un.h>
+// read, write, close, pipe, unlink, sysconf
+#include <unistd.h>
+
+// a byte repeated in every byte of a 64-bit word
+#define BYTES(x)      (UINT64_C(0x0101010101010101) * (x))
+// position of a worker waiting for targets
+#define IDLE_POSITION UINT64_MAX
+// digits of a hex digest
+#define HEX_DIGEST_LENGTH 40
+
+// a target and where the cyclic sweep was when it joined
+struct daemonTarget
+{
+	struct hash  target;
+	// every position from here on is swept by a generation holding the target
+	uint64_t     joined;
+	unsigned int client;
+	// set once the target is found, its sweep is done or its client is gone
+	int          isDone;
+	// index in the generation that is being built (SIZE_MAX if it is dropped)
+	size_t       nextIndex;
+};
+
+// targets, found flags and results the workers share until the next targets arrive
+struct daemonGeneration
+{
+	struct targetSet targets;
+	struct crackJob  job;
+	// copies of the target tables on the nodes of the workers and jobs probing them (none on a single node)
+	struct targetSet p_nodeTargets[CRACK_MAX_NODES];
+	struct crackJob  p_nodeJobs[CRACK_MAX_NODES];
+	unsigned int     numberOfReplicas;
+};
+
+struct daemonClient
+{
+	int    inputFd;
+	int    outputFd;
+	// the descriptors of runCrackDaemon belong to the caller
+	int    isOwned;
+	int    isSocket;
+	// the client is closed once its input ended and its targets are done
+	int    isInputClosed;
+	// set if writing a result failed
+	int    isBroken;
+	// the rest of a line longer than the buffer is skipped
+	int    isSkipping;
+	size_t length;
+	char   p_buffer[CRACK_DAEMON_BUFFER_SIZE];
+};
+
+struct daemonWorker
+{
+	struct crackDaemon   *p_daemon;
+	// lower bound of the position the worker sweeps (IDLE_POSITION while it waits)
+	atomic_uint_fast64_t lowestPosition;
+	// node job of a generation the worker sweeps
+	unsigned int         replica;
+	pthread_t            thread;
+	struct placedThread  placed;
+};
+
+struct crackDaemon
+{
+	struct keyspaceLayout            layout;
+	// the hand-tuned kernels cover the default keyspace, the generic ones the rest
+	const struct keyspaceLayout      *p_kernelLayout;
+	int                              (*crackSlice)(struct crackJob *p_job,
+												   uint64_t        slice);
+	uint64_t                         numberOfSlices;
+	// the workers sweep position after position, position p is slice p % numberOfSlices
+	atomic_uint_fast64_t             nextPosition;
+	struct daemonGeneration *_Atomic p_generation;
+	// bumped with every generation, idle workers wait for it to change
+	atomic_uint_fast64_t             generationNumber;
+	atomic_int                       isStopped;
+	pthread_mutex_t                  mutex;
+	pthread_cond_t                   wakeUp;
+	struct daemonWorker              p_workers[CRACK_MAX_THREADS];
+	unsigned int                     numberOfWorkers;
+	// workers are pinned to the cores of the topology while the daemon holds the placement
+	int                              isPlaced;
+	struct crackTopology             topology;
+	// core of the topology every node copy of the target tables is made on
+	unsigned int                     p_replicaCores[CRACK_MAX_NODES];
+	unsigned int                     numberOfReplicas;
+	// the workers write to it once they found a target
+	int                              p_wakePipe[2];
+	// targets of the current generation (in the same order) and the ones of the next
+	struct daemonTarget              *p_targets;
+	size_t                           numberOfTargets;
+	// set until every worker is past publishedAt, the position the current generation was published at
+	int                              isRetiring;
+	uint64_t                         publishedAt;
+	// the generation it replaced and its targets (in the same order)
+	struct daemonGeneration          *p_retiring;
+	struct daemonTarget              *p_retiringTargets;
+	size_t                           numberOfRetiringTargets;
+	// the targets from here on joined with the current generation
+	size_t                           firstJoined;
+	struct daemonTarget              *p_incoming;
+	size_t                           numberOfIncoming;
+	size_t                           incomingCapacity;
+	int                              isRebuildNeeded;
+	int                              listenFd;
+	struct daemonClient              *pp_clients[CRACK_DAEMON_MAX_CLIENTS];
+};
+
+// function prototypes
+static int serveDaemon(const struct keyspace *p_keyspace,
+                       unsigned int          numberOfThreads,
+                       int                   listenFd,
+                       int                   inputFd,
+                       int                   outputFd);
+static int startDaemon(struct crackDaemon    *p_daemon,
+                       const struct keyspace *p_keyspace,
+                       unsigned int          numberOfThreads);
+static void stopDaemon(struct crackDaemon *p_daemon);
+static void *daemonWorker(void *p_arg);
+static int addClient(struct crackDaemon *p_daemon,
+                     int                inputFd,
+                     int                outputFd,
+                     int                isOwned,
+                     int                isSocket);
+static void closeClient(struct crackDaemon *p_daemon,
+                        unsigned int       client);
+static int readClient(struct crackDaemon *p_daemon,
+                      unsigned int       client);
+static void collectFound(struct crackDaemon            *p_daemon,
+                         const struct daemonGeneration *p_generation,
+                         struct daemonTarget           *p_targets,
+                         size_t                        numberOfTargets,
+                         struct daemonGeneration       *p_next,
+                         struct daemonTarget           *p_nextTargets);
+static int retireTargets(struct crackDaemon *p_daemon,
+                         uint64_t           lowestPosition);
+static int publishGeneration(struct crackDaemon *p_daemon);
+static void retireGeneration(struct crackDaemon *p_daemon);
+static void freeGeneration(struct daemonGeneration *p_generation);
+static uint64_t getLowestPosition(struct crackDaemon *p_daemon);
+static void writeResult(struct crackDaemon        *p_daemon,
+                        const struct daemonTarget *p_target,
+                        const char                *p_preimage);
+static inline uint32_t parseHexWord(const char *p_hex,
+                                    uint64_t   *p_isInvalid);
+
+/**
+ * Function: parseHashes
+ */
+size_t parseHashes
+(
+    const char  *p_text,
+    size_t      length,
+    struct hash *p_hashes,
+    size_t      maxHashes,
+    size_t      *p_numberOfHashes
+)
+{
+    size_t     consumed       = 0,
+               numberOfHashes = 0,
+               lineLength;
+    uint64_t   isInvalid;
+    uint32_t   p_words[5];
+    const char *p_line,
+               *p_lineEnd;
+    // only complete lines are parsed, the rest is left to the caller
+    while(numberOfHashes < maxHashes
+          && (p_lineEnd = memchr(p_text + consumed, '\n', length - consumed)) != NULL)
+    {
+        p_line     = p_text + consumed;
+        lineLength = (size_t) (p_lineEnd - p_line);
+        consumed  += lineLength + 1;
+        // lines may end in \r\n, anything but 40 hex digits is skipped
+        if(lineLength > 0 && p_line[lineLength - 1] == '\r')
+            lineLength--;
+        if(lineLength != HEX_DIGEST_LENGTH)
+            continue;
+        isInvalid = 0;
+        for(int i = 0; i < 5; i++)
+            p_words[i] = parseHexWord(p_line + 8 * i,
+                                      &isInvalid);
+        if(isInvalid != 0)
+            continue;
+        p_hashes[numberOfHashes].a = p_words[0];
+        p_hashes[numberOfHashes].b = p_words[1];
+        p_hashes[numberOfHashes].c = p_words[2];
+        p_hashes[numberOfHashes].d = p_words[3];
+        p_hashes[numberOfHashes].e = p_words[4];
+        numberOfHashes++;
+    }
+    *p_numberOfHashes = numberOfHashes;
+
+    return consumed;
+}
+/**
+ * Function: runCrackDaemon
+ */
+int runCrackDaemon
+(
+    int                   inputFd,
+    int                   outputFd,
+    const struct keyspace *p_keyspace,
+    unsigned int          numberOfThreads
+)
+{
+    return serveDaemon(p_keyspace,
+                       numberOfThreads,
+                       -1,
+                       inputFd,
+                       outputFd);
+}
+/**
+ * Function: listenCrackDaemon
+ */
+int listenCrackDaemon
+(
+    const char            *p_path,
+    const struct keyspace *p_keyspace,
+    unsigned int          numberOfThreads
+)
+{
+    int                err,
+                       listenFd;
+    struct sockaddr_un address;
+    if(strlen(p_path) >= sizeof(address.sun_path))
+        return E_CRACK_IO;
+    memset(&address,
+           0,
+           sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path,
+           p_path,
+           strlen(p_path));
+    if((listenFd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+        return E_CRACK_IO;
+    // a socket left behind by an earlier daemon is replaced
+    unlink(p_path);
+    if(bind(listenFd, (struct sockaddr *) &address, sizeof(address)) != 0
+       || listen(listenFd, CRACK_DAEMON_MAX_CLIENTS) != 0)
+    {
+        close(listenFd);
+        return E_CRACK_IO;
+    }
+    err = serveDaemon(p_keyspace,
+                      numberOfThreads,
+                      listenFd,
+                      -1,
+                      -1);
+    close(listenFd);
+    unlink(p_path);
+
+    return err;
+}
+/**
+ * Function: serveDaemon
+ */
+static int serveDaemon
+(
+    const struct keyspace *p_keyspace,
+    unsigned int          numberOfThreads,
+    int                   listenFd,
+    int                   inputFd,
+    int                   outputFd
+)
+{
+    int                err,
+                       numberOfPolls;
+    char               p_drain[64];
+    unsigned int       p_pollClients[CRACK_DAEMON_MAX_CLIENTS + 2];
+    uint64_t           lowestPosition;
+    struct pollfd      p_polls[CRACK_DAEMON_MAX_CLIENTS + 2];
+    struct crackDaemon *p_daemon;
+    p_daemon = calloc(1, sizeof(struct crackDaemon));
+    if(p_daemon == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    if((err = startDaemon(p_daemon, p_keyspace, numberOfThreads)) != 0)
+    {
+        free(p_daemon);
+        return err;
+    }
+    p_daemon->listenFd = listenFd;
+    if(inputFd >= 0)
+        err = addClient(p_daemon,
+                        inputFd,
+                        outputFd,
+                        0,
+                        0);
+    while(err == 0)
+    {
+        // without a socket, the daemon is done once its only client is
+        if(listenFd < 0 && p_daemon->pp_clients[0] == NULL)
+            break;
+        numberOfPolls = 0;
+        p_polls[numberOfPolls].fd       = p_daemon->p_wakePipe[0];
+        p_polls[numberOfPolls++].events = POLLIN;
+        if(listenFd >= 0)
+        {
+            p_polls[numberOfPolls].fd       = listenFd;
+            p_polls[numberOfPolls++].events = POLLIN;
+        }
+        for(unsigned int i = 0; i < CRACK_DAEMON_MAX_CLIENTS; i++)
+        {
+            if(p_daemon->pp_clients[i] == NULL || p_daemon->pp_clients[i]->isInputClosed)
+                continue;
+            p_pollClients[numberOfPolls]    = i;
+            p_polls[numberOfPolls].fd       = p_daemon->pp_clients[i]->inputFd;
+            p_polls[numberOfPolls++].events = POLLIN;
+        }
+        // targets whose sweep is done and workers leaving a replaced generation are only noticed by polling
+        if(poll(p_polls,
+                (nfds_t) numberOfPolls,
+                p_daemon->isRetiring ? CRACK_DAEMON_RETIRE_INTERVAL
+                                     : (p_daemon->numberOfTargets > 0) ? CRACK_DAEMON_POLL_INTERVAL : -1) < 0)
+        {
+            if(errno != EINTR)
+                err = E_CRACK_IO;
+            continue;
+        }
+        while(read(p_daemon->p_wakePipe[0], p_drain, sizeof(p_drain)) > 0)
+            ;
+        for(int i = 1; i < numberOfPolls; i++)
+        {
+            if(p_polls[i].revents == 0)
+                continue;
+            if(p_polls[i].fd == listenFd)
+            {
+                if((inputFd = accept(listenFd, NULL, NULL)) >= 0
+                   && addClient(p_daemon, inputFd, inputFd, 1, 1) != 0)
+                    close(inputFd);
+            }
+            else if((err = readClient(p_daemon, p_pollClients[i])) != 0)
+                break;
+        }
+        /*
+         *  Every position below the lowest one is swept completely, so the
+         *  found flags read afterwards are final for the targets it retires.
+         */
+        lowestPosition = getLowestPosition(p_daemon);
+        if(p_daemon->isRetiring)
+            retireGeneration(p_daemon);
+        /*
+         *  The current generation is only collected once the one it replaced
+         *  retired, and digests that arrive in the meantime are coalesced into
+         *  a single next generation.
+         */
+        if(p_daemon->isRetiring)
+            continue;
+        if(p_daemon->numberOfTargets > 0)
+            collectFound(p_daemon,
+                         atomic_load(&p_daemon->p_generation),
+                         p_daemon->p_targets,
+                         p_daemon->numberOfTargets,
+                         NULL,
+                         NULL);
+        if(err == 0)
+            err = retireTargets(p_daemon,
+                                lowestPosition);
+        if(err == 0 && p_daemon->isRebuildNeeded)
+            err = publishGeneration(p_daemon);
+    }
+    stopDaemon(p_daemon);
+    free(p_daemon);
+
+    return err;
+}
+/**
+ * Function: startDaemon
+ */
+static int startDaemon
+(
+    struct crackDaemon    *p_daemon,
+    const struct keyspace *p_keyspace,
+    unsigned int          numberOfThreads
+)
+{
+    int                 err;
+    unsigned int        numberOfCores,
+                        p_coreReplicas[CRACK_MAX_THREADS];
+    struct daemonWorker *p_worker;
+    if((err = initKeyspaceLayout(&p_daemon->layout, p_keyspace)) != 0)
+        return err;
+    if(p_daemon->layout.isDefault)
+    {
+        p_daemon->p_kernelLayout = NULL;
+        p_daemon->crackSlice     = crackSlice;
+        p_daemon->numberOfSlices = CRACK_NUMBER_OF_SLICES;
+    }
+    else
+    {
+        p_daemon->p_kernelLayout = &p_daemon->layout;
+        p_daemon->crackSlice     = crackSliceGeneric;
+        p_daemon->numberOfSlices = p_daemon->layout.p_firstSlice[p_daemon->layout.maxLength + 1];
+    }
+    // the workers must never block on a full pipe, the coordinator drains it
+    if(pipe(p_daemon->p_wakePipe) != 0)
+    {
+        freeKeyspaceLayout(&p_daemon->layout);
+        return E_CRACK_IO;
+    }
+    fcntl(p_daemon->p_wakePipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(p_daemon->p_wakePipe[1], F_SETFL, O_NONBLOCK);
+    atomic_init(&p_daemon->nextPosition, 0);
+    atomic_init(&p_daemon->p_generation, NULL);
+    atomic_init(&p_daemon->generationNumber, 0);
+    atomic_init(&p_daemon->isStopped, 0);
+    pthread_mutex_init(&p_daemon->mutex,
+                       NULL);
+    pthread_cond_init(&p_daemon->wakeUp,
+                      NULL);
+    // workers are pinned to one physical core each, as those of a sweep (see runCrackJob)
+    p_daemon->isPlaced = (claimCrackPlacement() == 0);
+    if(p_daemon->isPlaced && getCrackTopology(&p_daemon->topology) != 0)
+    {
+        releaseCrackPlacement();
+        p_daemon->isPlaced = 0;
+    }
+    // zero threads means one thread per physical core (per online core without placement)
+    if(numberOfThreads == 0)
+        numberOfThreads = p_daemon->isPlaced ? p_daemon->topology.numberOfCores : (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+    if(numberOfThreads == 0)
+        numberOfThreads = 1;
+    if(numberOfThreads > CRACK_MAX_THREADS)
+        numberOfThreads = CRACK_MAX_THREADS;
+    /*
+     *  Once the cores of the workers span more than one node, every generation
+     *  gets a copy of its target tables per node (see publishGeneration), made
+     *  on the first core of the node.
+     */
+    numberOfCores = 0;
+    if(p_daemon->isPlaced)
+        numberOfCores = (numberOfThreads < p_daemon->topology.numberOfCores) ? numberOfThreads : p_daemon->topology.numberOfCores;
+    if(numberOfCores > 0 && p_daemon->topology.p_nodes[0] != p_daemon->topology.p_nodes[numberOfCores - 1])
+    {
+        for(unsigned int i = 0; i < numberOfCores; i++)
+        {
+            if(i == 0 || p_daemon->topology.p_nodes[i] != p_daemon->topology.p_nodes[i - 1])
+                p_daemon->p_replicaCores[p_daemon->numberOfReplicas++] = i;
+            p_coreReplicas[i] = p_daemon->numberOfReplicas - 1;
+        }
+    }
+    // the workers stay until the daemon stops, so no request pays for starting them
+    while(p_daemon->numberOfWorkers < numberOfThreads)
+    {
+        p_worker           = &p_daemon->p_workers[p_daemon->numberOfWorkers];
+        p_worker->p_daemon = p_daemon;
+        p_worker->replica  = (p_daemon->numberOfReplicas > 0) ? p_coreReplicas[p_daemon->numberOfWorkers % numberOfCores] : 0;
+        atomic_init(&p_worker->lowestPosition, IDLE_POSITION);
+        if(p_daemon->isPlaced)
+            err = startPlacedThread(&p_worker->placed,
+                                    daemonWorker,
+                                    p_worker,
+                                    p_daemon->topology.p_cpus[p_daemon->numberOfWorkers % p_daemon->topology.numberOfCores],
+                                    p_daemon->topology.p_nodes[p_daemon->numberOfWorkers % p_daemon->topology.numberOfCores]);
+        else
+            err = pthread_create(&p_worker->thread,
+                                 NULL,
+                                 daemonWorker,
+                                 p_worker);
+        if(err != 0)
+            break;
+        p_daemon->numberOfWorkers++;
+    }
+    if(p_daemon->numberOfWorkers == 0)
+    {
+        stopDaemon(p_daemon);
+        return E_CRACK_IO;
+    }
+
+    return 0;
+}
+/**
+ * Function: stopDaemon
+ */
+static void stopDaemon
+(
+    struct crackDaemon *p_daemon
+)
+{
+    // a worker in the middle of a slice stops after it
+    pthread_mutex_lock(&p_daemon->mutex);
+    atomic_store(&p_daemon->isStopped, 1);
+    pthread_cond_broadcast(&p_daemon->wakeUp);
+    pthread_mutex_unlock(&p_daemon->mutex);
+    for(unsigned int i = 0; i < p_daemon->numberOfWorkers; i++)
+    {
+        if(p_daemon->isPlaced)
+            joinPlacedThread(&p_daemon->p_workers[i].placed);
+        else
+            pthread_join(p_daemon->p_workers[i].thread,
+                         NULL);
+    }
+    if(p_daemon->isPlaced)
+        releaseCrackPlacement();
+    for(unsigned int i = 0; i < CRACK_DAEMON_MAX_CLIENTS; i++)
+        if(p_daemon->pp_clients[i] != NULL)
+            closeClient(p_daemon,
+                        i);
+    if(atomic_load(&p_daemon->p_generation) != NULL)
+        freeGeneration(atomic_load(&p_daemon->p_generation));
+    if(p_daemon->p_retiring != NULL)
+        freeGeneration(p_daemon->p_retiring);
+    free(p_daemon->p_retiringTargets);
+    free(p_daemon->p_targets);
+    free(p_daemon->p_incoming);
+    close(p_daemon->p_wakePipe[0]);
+    close(p_daemon->p_wakePipe[1]);
+    pthread_cond_destroy(&p_daemon->wakeUp);
+    pthread_mutex_destroy(&p_daemon->mutex);
+    freeKeyspaceLayout(&p_daemon->layout);
+}
+/**
+ * Function: daemonWorker
+ */
+static void *daemonWorker
+(
+    void *p_arg
+)
+{
+    size_t                  numberOfFound;
+    uint64_t                position,
+                            generationNumber;
+    struct daemonWorker     *p_worker = p_arg;
+    struct crackDaemon      *p_daemon = p_worker->p_daemon;
+    struct daemonGeneration *p_generation;
+    struct crackJob         *p_sliceJob;
+    while(!atomic_load(&p_daemon->isStopped))
+    {
+        /*
+         *  The position is stored before the generation is loaded: once every
+         *  worker is past the position the generation was published at, none
+         *  of them sweeps an older one anymore (see publishGeneration).
+         */
+        atomic_store(&p_worker->lowestPosition, atomic_load(&p_daemon->nextPosition));
+        generationNumber = atomic_load(&p_daemon->generationNumber);
+        p_generation     = atomic_load(&p_daemon->p_generation);
+        if(p_generation == NULL
+           || atomic_load(&p_generation->job.numberOfFound) == p_generation->targets.numberOfTargets)
+        {
+            // wait for new targets
+            atomic_store(&p_worker->lowestPosition, IDLE_POSITION);
+            pthread_mutex_lock(&p_daemon->mutex);
+            while(!atomic_load(&p_daemon->isStopped)
+                  && atomic_load(&p_daemon->generationNumber) == generationNumber)
+                pthread_cond_wait(&p_daemon->wakeUp,
+                                  &p_daemon->mutex);
+            pthread_mutex_unlock(&p_daemon->mutex);
+            continue;
+        }
+        position      = atomic_fetch_add(&p_daemon->nextPosition, 1);
+        numberOfFound = atomic_load(&p_generation->job.numberOfFound);
+        // the targets are probed in the tables on this worker's node
+        p_sliceJob    = (p_generation->numberOfReplicas > 0) ? &p_generation->p_nodeJobs[p_worker->replica]
+                                                             : &p_generation->job;
+        p_sliceJob->crackSlice(p_sliceJob,
+                               position % p_daemon->numberOfSlices);
+        // found flags and results are shared, the targets found are counted by the job itself
+        if(p_sliceJob != &p_generation->job)
+            atomic_fetch_add(&p_generation->job.numberOfFound,
+                             atomic_exchange(&p_sliceJob->numberOfFound, 0));
+        // results stream out as soon as they are found, a full pipe already wakes the coordinator
+        if(atomic_load(&p_generation->job.numberOfFound) != numberOfFound
+           && write(p_daemon->p_wakePipe[1], "", 1) < 0)
+            continue;
+    }
+
+    return NULL;
+}
+/**
+ * Function: addClient
+ */
+static int addClient
+(
+    struct crackDaemon *p_daemon,
+    int                inputFd,
+    int                outputFd,
+    int                isOwned,
+    int                isSocket
+)
+{
+    struct daemonClient *p_client;
+    for(unsigned int i = 0; i < CRACK_DAEMON_MAX_CLIENTS; i++)
+    {
+        if(p_daemon->pp_clients[i] != NULL)
+            continue;
+        p_client = calloc(1, sizeof(struct daemonClient));
+        if(p_client == NULL)
+            return E_CRACK_OUT_OF_MEMORY;
+        p_client->inputFd       = inputFd;
+        p_client->outputFd      = outputFd;
+        p_client->isOwned       = isOwned;
+        p_client->isSocket      = isSocket;
+        p_daemon->pp_clients[i] = p_client;
+        return 0;
+    }
+
+    return E_CRACK_IO;
+}
+/**
+ * Function: closeClient
+ */
+static void closeClient
+(
+    struct crackDaemon *p_daemon,
+    unsigned int       client
+)
+{
+    size_t numberOfIncoming = 0;
+    // targets of a client that is gone are dropped with the next generation
+    for(size_t i = 0; i < p_daemon->numberOfTargets; i++)
+    {
+        if(p_daemon->p_targets[i].client == client && !p_daemon->p_targets[i].isDone)
+        {
+            p_daemon->p_targets[i].isDone = 1;
+            p_daemon->isRebuildNeeded     = 1;
+        }
+    }
+    // nor reported by a retiring generation to a client that takes over its slot
+    for(size_t i = 0; i < p_daemon->numberOfRetiringTargets; i++)
+        if(p_daemon->p_retiringTargets[i].client == client)
+            p_daemon->p_retiringTargets[i].isDone = 1;
+    for(size_t i = 0; i < p_daemon->numberOfIncoming; i++)
+        if(p_daemon->p_incoming[i].client != client)
+            p_daemon->p_incoming[numberOfIncoming++] = p_daemon->p_incoming[i];
+    p_daemon->numberOfIncoming = numberOfIncoming;
+    if(p_daemon->pp_clients[client]->isOwned)
+        close(p_daemon->pp_clients[client]->inputFd);
+    free(p_daemon->pp_clients[client]);
+    p_daemon->pp_clients[client] = NULL;
+}
+/**
+ * Function: readClient
+ */
+static int readClient
+(
+    struct crackDaemon *p_daemon,
+    unsigned int       client
+)
+{
+    ssize_t             received;
+    size_t              consumed,
+                        numberOfHashes,
+                        capacity;
+    char                *p_lineEnd;
+    struct daemonTarget *p_incoming;
+    struct daemonClient *p_client = p_daemon->pp_clients[client];
+    struct hash         p_hashes[CRACK_DAEMON_BATCH_SIZE];
+    received = read(p_client->inputFd,
+                    p_client->p_buffer + p_client->length,
+                    CRACK_DAEMON_BUFFER_SIZE - p_client->length);
+    if(received < 0 && errno == EINTR)
+        return 0;
+    if(received <= 0)
+    {
+        // the caller's input failing ends the daemon, a socket client is just done
+        if(received < 0 && !p_client->isOwned)
+            return E_CRACK_IO;
+        p_client->isInputClosed = 1;
+        // a last line without a line break counts as well
+        if(p_client->length > 0 && !p_client->isSkipping)
+            p_client->p_buffer[p_client->length++] = '\n';
+    }
+    else
+        p_client->length += (size_t) received;
+    // drop the rest of a line that did not fit into the buffer
+    if(p_client->isSkipping)
+    {
+        p_lineEnd = memchr(p_client->p_buffer, '\n', p_client->length);
+        consumed  = (p_lineEnd != NULL) ? (size_t) (p_lineEnd - p_client->p_buffer) + 1 : p_client->length;
+        memmove(p_client->p_buffer,
+                p_client->p_buffer + consumed,
+                p_client->length - consumed);
+        p_client->length    -= consumed;
+        p_client->isSkipping = (p_lineEnd == NULL);
+    }
+    // parse the complete lines in batches, the targets join with the next generation
+    do
+    {
+        consumed = parseHashes(p_client->p_buffer,
+                               p_client->length,
+                               p_hashes,
+                               CRACK_DAEMON_BATCH_SIZE,
+                               &numberOfHashes);
+        memmove(p_client->p_buffer,
+                p_client->p_buffer + consumed,
+                p_client->length - consumed);
+        p_client->length -= consumed;
+        // the capacity doubles, so loading a long hash list copies every target only a few times
+        if(p_daemon->numberOfIncoming + numberOfHashes > p_daemon->incomingCapacity)
+        {
+            capacity = 2 * p_daemon->incomingCapacity;
+            if(capacity < p_daemon->numberOfIncoming + CRACK_DAEMON_BATCH_SIZE)
+                capacity = p_daemon->numberOfIncoming + CRACK_DAEMON_BATCH_SIZE;
+            p_incoming = realloc(p_daemon->p_incoming,
+                                 capacity * sizeof(struct daemonTarget));
+            if(p_incoming == NULL)
+                return E_CRACK_OUT_OF_MEMORY;
+            p_daemon->p_incoming       = p_incoming;
+            p_daemon->incomingCapacity = capacity;
+        }
+        for(size_t i = 0; i < numberOfHashes; i++)
+        {
+            p_incoming         = &p_daemon->p_incoming[p_daemon->numberOfIncoming++];
+            p_incoming->target = p_hashes[i];
+            p_incoming->client = client;
+            p_incoming->isDone = 0;
+        }
+        if(numberOfHashes > 0)
+            p_daemon->isRebuildNeeded = 1;
+    }
+    while(numberOfHashes == CRACK_DAEMON_BATCH_SIZE);
+    if(p_client->length == CRACK_DAEMON_BUFFER_SIZE)
+    {
+        p_client->length     = 0;
+        p_client->isSkipping = 1;
+    }
+
+    return 0;
+}
+/**
+ * Function: collectFound
+ */
+static void collectFound
+(
+    struct crackDaemon            *p_daemon,
+    const struct daemonGeneration *p_generation,
+    struct daemonTarget           *p_targets,
+    size_t                        numberOfTargets,
+    struct daemonGeneration       *p_next,
+    struct daemonTarget           *p_nextTargets
+)
+{
+    unsigned char expected;
+    size_t        next;
+    for(size_t i = 0; i < numberOfTargets; i++)
+    {
+        if(p_targets[i].isDone
+           || atomic_load(&p_generation->job.p_found[i]) != CRACK_FOUND_WRITTEN)
+            continue;
+        writeResult(p_daemon,
+                    &p_targets[i],
+                    p_generation->job.p_results + i * CRACK_RESULT_SIZE);
+        p_targets[i].isDone       = 1;
+        p_daemon->isRebuildNeeded = 1;
+        // found by a retired generation, so the next one must not report it again
+        if(p_next != NULL && (next = p_targets[i].nextIndex) != SIZE_MAX)
+        {
+            p_nextTargets[next].isDone = 1;
+            expected = 0;
+            if(atomic_compare_exchange_strong(&p_next->job.p_found[next],
+                                              &expected,
+                                              CRACK_FOUND_WRITTEN))
+                atomic_fetch_add(&p_next->job.numberOfFound,
+                                 1);
+        }
+    }
+}
+/**
+ * Function: retireTargets
+ */
+static int retireTargets
+(
+    struct crackDaemon *p_daemon,
+    uint64_t           lowestPosition
+)
+{
+    int    err = 0;
+    size_t p_numberOfPending[CRACK_DAEMON_MAX_CLIENTS] = { 0 };
+    // a target that saw every slice since it joined is not part of the keyspace
+    for(size_t i = 0; i < p_daemon->numberOfTargets; i++)
+    {
+        if(p_daemon->p_targets[i].isDone)
+            continue;
+        if(p_daemon->p_targets[i].joined + p_daemon->numberOfSlices <= lowestPosition)
+        {
+            writeResult(p_daemon,
+                        &p_daemon->p_targets[i],
+                        NULL);
+            p_daemon->p_targets[i].isDone = 1;
+            p_daemon->isRebuildNeeded     = 1;
+        }
+        else
+            p_numberOfPending[p_daemon->p_targets[i].client]++;
+    }
+    for(size_t i = 0; i < p_daemon->numberOfIncoming; i++)
+        p_numberOfPending[p_daemon->p_incoming[i].client]++;
+    // clients are done once their input ended and every target of theirs is answered
+    for(unsigned int i = 0; i < CRACK_DAEMON_MAX_CLIENTS; i++)
+    {
+        if(p_daemon->pp_clients[i] == NULL)
+            continue;
+        if(p_daemon->pp_clients[i]->isBroken && !p_daemon->pp_clients[i]->isOwned)
+            err = E_CRACK_IO;
+        if(p_daemon->pp_clients[i]->isBroken
+           || (p_daemon->pp_clients[i]->isInputClosed && p_numberOfPending[i] == 0))
+            closeClient(p_daemon,
+                        i);
+    }
+
+    return err;
+}
+/**
+ * Function: publishGeneration
+ */
+static int publishGeneration
+(
+    struct crackDaemon *p_daemon
+)
+{
+    size_t                  numberOfTargets = 0;
+    struct hash             *p_hashes;
+    struct daemonTarget     *p_targets;
+    struct daemonGeneration *p_old          = atomic_load(&p_daemon->p_generation),
+                            *p_new          = NULL;
+    // targets that are not done keep their place in the sweep, new ones are appended
+    for(size_t i = 0; i < p_daemon->numberOfTargets; i++)
+        if(!p_daemon->p_targets[i].isDone)
+            numberOfTargets++;
+    numberOfTargets += p_daemon->numberOfIncoming;
+    p_targets = malloc((numberOfTargets + 1) * sizeof(struct daemonTarget));
+    p_hashes  = malloc((numberOfTargets + 1) * sizeof(struct hash));
+    if(p_targets == NULL || p_hashes == NULL)
+    {
+        free(p_targets);
+        free(p_hashes);
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    numberOfTargets = 0;
+    for(size_t i = 0; i < p_daemon->numberOfTargets; i++)
+    {
+        p_daemon->p_targets[i].nextIndex = SIZE_MAX;
+        if(p_daemon->p_targets[i].isDone)
+            continue;
+        p_daemon->p_targets[i].nextIndex = numberOfTargets;
+        p_targets[numberOfTargets++]     = p_daemon->p_targets[i];
+    }
+    memcpy(p_targets + numberOfTargets,
+           p_daemon->p_incoming,
+           p_daemon->numberOfIncoming * sizeof(struct daemonTarget));
+    for(size_t i = 0; i < numberOfTargets + p_daemon->numberOfIncoming; i++)
+        p_hashes[i] = p_targets[i].target;
+    if(numberOfTargets + p_daemon->numberOfIncoming > 0)
+    {
+        p_new = calloc(1, sizeof(struct daemonGeneration));
+        if(p_new == NULL
+           || initTargetSet(&p_new->targets, p_hashes, numberOfTargets + p_daemon->numberOfIncoming) != 0)
+        {
+            free(p_new);
+            free(p_targets);
+            free(p_hashes);
+            return E_CRACK_OUT_OF_MEMORY;
+        }
+        p_new->job.p_targets      = &p_new->targets;
+        p_new->job.p_layout       = p_daemon->p_kernelLayout;
+        p_new->job.crackSlice     = p_daemon->crackSlice;
+        p_new->job.numberOfSlices = p_daemon->numberOfSlices;
+        p_new->job.resultSize     = CRACK_RESULT_SIZE;
+        p_new->job.p_sweptLayout  = &p_daemon->layout;
+        p_new->job.endCandidate   = getNumberOfCandidates(&p_daemon->layout);
+        p_new->job.p_results      = calloc(p_new->targets.numberOfTargets + 1, CRACK_RESULT_SIZE);
+        p_new->job.p_found        = calloc(p_new->targets.numberOfTargets + 1, sizeof(atomic_uchar));
+        atomic_init(&p_new->job.numberOfFound, 0);
+        if(p_new->job.p_results == NULL || p_new->job.p_found == NULL)
+        {
+            freeGeneration(p_new);
+            free(p_targets);
+            free(p_hashes);
+            return E_CRACK_OUT_OF_MEMORY;
+        }
+        // if a copy fails, all workers simply probe the tables of the job
+        for(unsigned int i = 0; i < p_daemon->numberOfReplicas; i++)
+        {
+            if(initNodeTargetSet(&p_new->p_nodeTargets[i], &p_new->targets,
+                                 p_daemon->topology.p_cpus[p_daemon->p_replicaCores[i]],
+                                 p_daemon->topology.p_nodes[p_daemon->p_replicaCores[i]]) != 0)
+            {
+                while(p_new->numberOfReplicas > 0)
+                    freeNodeTargetSet(&p_new->p_nodeTargets[--p_new->numberOfReplicas]);
+                break;
+            }
+            p_new->p_nodeJobs[i]           = p_new->job;
+            p_new->p_nodeJobs[i].p_targets = &p_new->p_nodeTargets[i];
+            atomic_init(&p_new->p_nodeJobs[i].numberOfFound, 0);
+            p_new->numberOfReplicas++;
+        }
+    }
+    free(p_hashes);
+    // the workers pick up the new generation with their next slice
+    pthread_mutex_lock(&p_daemon->mutex);
+    atomic_store(&p_daemon->p_generation, p_new);
+    atomic_fetch_add(&p_daemon->generationNumber, 1);
+    pthread_cond_broadcast(&p_daemon->wakeUp);
+    pthread_mutex_unlock(&p_daemon->mutex);
+    /*
+     *  A worker still sweeping the old generation stored a position up to the
+     *  one read here. The old generation retires once every worker is beyond
+     *  it (see retireGeneration), the clients are served in the meantime.
+     */
+    p_daemon->publishedAt             = atomic_load(&p_daemon->nextPosition);
+    p_daemon->isRetiring              = 1;
+    p_daemon->p_retiring              = p_old;
+    p_daemon->p_retiringTargets       = p_daemon->p_targets;
+    p_daemon->numberOfRetiringTargets = p_daemon->numberOfTargets;
+    p_daemon->p_targets               = p_targets;
+    p_daemon->numberOfTargets         = numberOfTargets + p_daemon->numberOfIncoming;
+    p_daemon->firstJoined             = numberOfTargets;
+    p_daemon->numberOfIncoming        = 0;
+    p_daemon->isRebuildNeeded         = 0;
+
+    return 0;
+}
+/**
+ * Function: retireGeneration
+ */
+static void retireGeneration
+(
+    struct crackDaemon *p_daemon
+)
+{
+    uint64_t                joined;
+    struct daemonGeneration *p_current = atomic_load(&p_daemon->p_generation);
+    // targets the old generation found in the meantime are reported right away
+    if(p_daemon->p_retiring != NULL)
+        collectFound(p_daemon,
+                     p_daemon->p_retiring,
+                     p_daemon->p_retiringTargets,
+                     p_daemon->numberOfRetiringTargets,
+                     p_current,
+                     p_daemon->p_targets);
+    for(unsigned int i = 0; i < p_daemon->numberOfWorkers; i++)
+        if(atomic_load(&p_daemon->p_workers[i].lowestPosition) <= p_daemon->publishedAt)
+            return;
+    /*
+     *  Every worker is beyond the position the current generation was
+     *  published at, so all positions handed out from now on are swept by it
+     *  (or a later one). The found flags of the old one are final.
+     */
+    joined = atomic_load(&p_daemon->nextPosition);
+    for(size_t i = p_daemon->firstJoined; i < p_daemon->numberOfTargets; i++)
+        p_daemon->p_targets[i].joined = joined;
+    if(p_daemon->p_retiring != NULL)
+    {
+        collectFound(p_daemon,
+                     p_daemon->p_retiring,
+                     p_daemon->p_retiringTargets,
+                     p_daemon->numberOfRetiringTargets,
+                     p_current,
+                     p_daemon->p_targets);
+        freeGeneration(p_daemon->p_retiring);
+    }
+    free(p_daemon->p_retiringTargets);
+    p_daemon->p_retiring              = NULL;
+    p_daemon->p_retiringTargets       = NULL;
+    p_daemon->numberOfRetiringTargets = 0;
+    p_daemon->isRetiring              = 0;
+}
+/**
+ * Function: freeGeneration
+ */
+static void freeGeneration
+(
+    struct daemonGeneration *p_generation
+)
+{
+    while(p_generation->numberOfReplicas > 0)
+        freeNodeTargetSet(&p_generation->p_nodeTargets[--p_generation->numberOfReplicas]);
+    freeTargetSet(&p_generation->targets);
+    free(p_generation->job.p_results);
+    free(p_generation->job.p_found);
+    free(p_generation);
+}
+/**
+ * Function: getLowestPosition
+ */
+static uint64_t getLowestPosition
+(
+    struct crackDaemon *p_daemon
+)
+{
+    uint64_t lowest = atomic_load(&p_daemon->nextPosition),
+             position;
+    // read after the next position, so a position handed out in between is covered
+    for(unsigned int i = 0; i < p_daemon->numberOfWorkers; i++)
+    {
+        position = atomic_load(&p_daemon->p_workers[i].lowestPosition);
+        if(position < lowest)
+            lowest = position;
+    }
+
+    return lowest;
+}
+/**
+ * Function: writeResult
+ */
+static void writeResult
+(
+    struct crackDaemon        *p_daemon,
+    const struct daemonTarget *p_target,
+    const char                *p_preimage
+)
+{
+    int                 length;
+    ssize_t             written;
+    char                p_line[HEX_DIGEST_LENGTH + CRACK_RESULT_SIZE + 2];
+    struct daemonClient *p_client = p_daemon->pp_clients[p_target->client];
+    if(p_client == NULL || p_client->isBroken)
+        return;
+    // <hex digest>:<preimage> for a found target, the digest alone otherwise
+    length = snprintf(p_line,
+                      sizeof(p_line),
+                      (p_preimage != NULL) ? "%08x%08x%08x%08x%08x:%s\n" : "%08x%08x%08x%08x%08x\n",
+                      p_target->target.a,
+                      p_target->target.b,
+                      p_target->target.c,
+                      p_target->target.d,
+                      p_target->target.e,
+                      (p_preimage != NULL) ? p_preimage : "");
+    for(int sent = 0; sent < length; sent += (int) written)
+    {
+        // MSG_NOSIGNAL turns a closed peer into an error instead of SIGPIPE
+        if(p_client->isSocket)
+            written = send(p_client->outputFd,
+                           p_line + sent,
+                           (size_t) (length - sent),
+                           MSG_NOSIGNAL);
+        else
+            written = write(p_client->outputFd,
+                            p_line + sent,
+                            (size_t) (length - sent));
+        if(written < 0 && errno == EINTR)
+            written = 0;
+        else if(written <= 0)
+        {
+            p_client->isBroken = 1;
+            return;
+        }
+    }
+}
+/**
+ * Function: parseHexWord
+ */
+static inline uint32_t parseHexWord
+(
+    const char *p_hex,
+    uint64_t   *p_isInvalid
+)
+{
+    uint64_t chars,
+             lower,
+             isDigit,
+             isLetter;
+    /*
+     *  Eight hex digits at once, one per byte of a 64-bit word (SWAR). For
+     *  bytes below 0x80, adding 0x80 - first sets the top bit from the first
+     *  character of a range on, adding 0x7F - last from the one after it,
+     *  without carries between the bytes.
+     */
+    memcpy(&chars,
+           p_hex,
+           sizeof(chars));
+    lower        = chars | BYTES(0x20);
+    isDigit      = (chars + BYTES(0x80 - '0')) & ~(chars + BYTES(0x7F - '9')) & BYTES(0x80);
+    isLetter     = (lower + BYTES(0x80 - 'a')) & ~(lower + BYTES(0x7F - 'f')) & BYTES(0x80);
+    *p_isInvalid |= (chars & BYTES(0x80)) | ((isDigit | isLetter) ^ BYTES(0x80));
+    // value of every digit, letters add 9 to their lower four bits
+    chars = (chars & BYTES(0x0F)) + (isLetter >> 7) * 9;
+    // the first digit is the lowest byte: join pairs of digits, then pairs of bytes
+    chars = ((chars & UINT64_C(0x000F000F000F000F)) << 4) | ((chars >> 8) & UINT64_C(0x000F000F000F000F));
+    chars = (chars | (chars >> 8)) & UINT64_C(0x0000FFFF0000FFFF);
+    chars = chars | (chars >> 16);
+
+    return __builtin_bswap32((uint32_t) chars);
+}
@@ -0,0 +1,228 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ * 
+ * This program is free software: you can redistribute it and/or modify  
+ * it under the terms of the GNU General Public License as published by  
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// __get_cpuid_count, bit_SHA
+#include <cpuid.h>
+// getenv
+#include <stdlib.h>
+
+// number of kernels in the dispatch table
+#define NUMBER_OF_KERNELS      5
+// number of engines in the SHA-1 dispatch table
+#define NUMBER_OF_SHA1_ENGINES 5
+
+struct crackKernel
+{
+	const char *p_name;
+	int        (*crackSlice)(struct crackJob *p_job,
+							 uint64_t        slice);
+	// generic kernel used for configurable keyspaces on the same CPUs
+	int        (*crackSliceGeneric)(struct crackJob *p_job,
+									uint64_t        slice);
+};
+
+struct sha1Engine
+{
+	const char   *p_name;
+	void         (*sha1Blocks)(uint32_t            *p_state,
+							   const unsigned char *p_data,
+							   size_t              numberOfBlocks);
+	void         (*sha1MultiLanes)(const char *const       *pp_messages,
+								   const unsigned int      *p_lengths,
+								   const struct sha1Prefix *p_prefix,
+								   struct hash             *p_digests);
+	unsigned int numberOfLanes;
+};
+
+// function prototypes
+static void initCrackKernel(void) __attribute__((constructor));
+static int isKernelSupported(unsigned int kernel);
+static int isSha1EngineSupported(unsigned int engine);
+
+/*
+ *  Kernels ordered from slowest to fastest. The experimental bitsliced kernel
+ *  needs AVX2 as well and trails the avx2 kernel, so it is only ever bound on
+ *  request.
+ */
+static const struct crackKernel p_kernels[NUMBER_OF_KERNELS] = { { "scalar",   crackSliceScalar,   crackSliceGenericScalar },
+                                                                 { "bitslice", crackSliceBitslice, crackSliceGenericAvx2   },
+                                                                 { "sse2",     crackSliceSse2,     crackSliceGenericSse2   },
+                                                                 { "avx2",     crackSliceAvx2,     crackSliceGenericAvx2   },
+                                                                 { "avx512",   crackSliceAvx512,   crackSliceGenericAvx2   } };
+// currently bound kernel (the scalar one until the constructor ran)
+static unsigned int currentKernel = 0;
+
+int (*crackSlice)(struct crackJob *p_job,
+                  uint64_t        slice) = crackSliceScalar;
+int (*crackSliceGeneric)(struct crackJob *p_job,
+                         uint64_t        slice) = crackSliceGenericScalar;
+
+// SHA-1 engines ordered from slowest to fastest
+static const struct sha1Engine p_sha1Engines[NUMBER_OF_SHA1_ENGINES] = { { "scalar",      sha1BlocksScalar, sha1MultiScalar, 1 },
+                                                                         { "sse2",        sha1BlocksScalar, sha1MultiSse2,   4 },
+                                                                         { "avx2",        sha1BlocksScalar, sha1MultiAvx2,   8 },
+                                                                         { "sha-ni",      sha1BlocksShaNi,  sha1MultiShaNi,  2 },
+                                                                         { "sha-ni-avx2", sha1BlocksShaNi,  sha1MultiAvx2,   8 } };
+// currently bound SHA-1 engine (the scalar one until the constructor ran)
+static unsigned int currentSha1Engine = 0;
+
+void (*sha1Blocks)(uint32_t            *p_state,
+                   const unsigned char *p_data,
+                   size_t              numberOfBlocks) = sha1BlocksScalar;
+void (*sha1MultiLanes)(const char *const       *pp_messages,
+                       const unsigned int      *p_lengths,
+                       const struct sha1Prefix *p_prefix,
+                       struct hash             *p_digests) = sha1MultiScalar;
+unsigned int numberOfSha1Lanes = 1;
+
+/**
+ * Function: selectCrackKernel
+ */
+int selectCrackKernel
+(
+    const char *p_name
+)
+{
+    for(unsigned int i = 0; i < NUMBER_OF_KERNELS; i++)
+    {
+        if(strcmp(p_kernels[i].p_name, p_name) != 0)
+            continue;
+        // never bind a kernel the CPU can't run
+        if(!isKernelSupported(i))
+            return E_CRACK_NO_SUCH_KERNEL;
+        currentKernel     = i;
+        crackSlice        = p_kernels[i].crackSlice;
+        crackSliceGeneric = p_kernels[i].crackSliceGeneric;
+        return 0;
+    }
+
+    return E_CRACK_NO_SUCH_KERNEL;
+}
+/**
+ * Function: getCrackKernelName
+ */
+const char *getCrackKernelName
+(
+    void
+)
+{
+    return p_kernels[currentKernel].p_name;
+}
+/**
+ * Function: selectSha1Engine
+ */
+int selectSha1Engine
+(
+    const char *p_name
+)
+{
+    for(unsigned int i = 0; i < NUMBER_OF_SHA1_ENGINES; i++)
+    {
+        if(strcmp(p_sha1Engines[i].p_name, p_name) != 0)
+            continue;
+        if(!isSha1EngineSupported(i))
+            return E_CRACK_NO_SUCH_KERNEL;
+        currentSha1Engine = i;
+        sha1Blocks        = p_sha1Engines[i].sha1Blocks;
+        sha1MultiLanes    = p_sha1Engines[i].sha1MultiLanes;
+        numberOfSha1Lanes = p_sha1Engines[i].numberOfLanes;
+        return 0;
+    }
+
+    return E_CRACK_NO_SUCH_KERNEL;
+}
+/**
+ * Function: getSha1EngineName
+ */
+const char *getSha1EngineName
+(
+    void
+)
+{
+    return p_sha1Engines[currentSha1Engine].p_name;
+}
+/**
+ * Function: initCrackKernel
+ */
+static void initCrackKernel
+(
+    void
+)
+{
+    const char *p_override = getenv(CRACK_KERNEL_ENV);
+    // the fastest supported SHA-1 engine serves the full hashes
+    for(unsigned int i = NUMBER_OF_SHA1_ENGINES; i-- > 0;)
+        if(selectSha1Engine(p_sha1Engines[i].p_name) == 0)
+            break;
+    // an explicitly requested kernel wins if the CPU supports it
+    if(p_override != NULL && selectCrackKernel(p_override) == 0)
+        return;
+    // otherwise bind the fastest supported kernel
+    for(unsigned int i = NUMBER_OF_KERNELS; i-- > 0;)
+        if(selectCrackKernel(p_kernels[i].p_name) == 0)
+            return;
+}
+/**
+ * Function: isKernelSupported
+ */
+static int isKernelSupported
+(
+    unsigned int kernel
+)
+{
+    // probes CPUID (and XGETBV for the OS support of the wider registers)
+    __builtin_cpu_init();
+    switch(kernel)
+    {
+        case 0: return 1;
+        case 1: return __builtin_cpu_supports("avx2");
+        case 2: return __builtin_cpu_supports("sse2");
+        case 3: return __builtin_cpu_supports("avx2");
+        case 4: return __builtin_cpu_supports("avx512f");
+    }
+
+    return 0;
+}
+/**
+ * Function: isSha1EngineSupported
+ */
+static int isSha1EngineSupported
+(
+    unsigned int engine
+)
+{
+    unsigned int eax,
+                 ebx,
+                 ecx,
+                 edx;
+    __builtin_cpu_init();
+    switch(engine)
+    {
+        case 0: return 1;
+        case 1: return __builtin_cpu_supports("sse2");
+        case 2: return __builtin_cpu_supports("avx2");
+        // the SHA extensions are not known to __builtin_cpu_supports of every compiler
+        case 3: return __builtin_cpu_supports("sse4.1")
+                       && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+                       && (ebx & bit_SHA) != 0;
+        // whole messages on the SHA extensions, batches of short ones on eight AVX2 lanes
+        case 4: return isSha1EngineSupported(2)
+                       && isSha1EngineSupported(3);
+    }
+
+    return 0;
+}
@@ -0,0 +1,1460 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+/*
+ *  Generated by scripts/generate_kernels.py, do not edit.
+ *
+ *  Generic kernel for arbitrary keyspaces, specialized per preimage length:
+ *  - lengths 1 - 3: word blocks 17, 20, 26 are always zero, 13 only depend on word block 0, initial step constants 1, 2, 3, 4 are fixed
+ *  - lengths 4 - 7: no word block 16 - 79 is always zero, 5 only depend on word block 0, initial step constants 2, 3, 4 are fixed
+ *  - lengths 8 - 11: no word block 16 - 79 is always zero, initial step constants 3, 4 are fixed
+ *  - length 12: no word block 16 - 79 is always zero, initial step constant 4 is fixed
+ */
+#include "sha1-cracker.h"
+
+// constants for k-values
+#define K_00_19              UINT32_C(0x5A827999)
+#define K_20_39              UINT32_C(0x6ED9EBA1)
+#define K_40_59              UINT32_C(0x8F1BBCDC)
+#define K_60_79              UINT32_C(0xCA62C1D6)
+
+// macros for f-functions
+#define F_00_19(mB, mC, mD) (mD ^ (mB & (mC ^ mD)))
+#define F_40_59(mB, mC, mD) ((mB & mC) ^ (mD & (mB ^ mC)))
+#define F_REST(mB, mC, mD)  (mB ^ mC ^ mD)
+// macro for circular left-shift of a 32-bit word (taken from RFC 3174)
+#define LEFT_ROTATE(word, bits) (((word) << (bits)) | ((word) >> (32 - (bits))))
+// macros for the different round additions (word blocks 1 - 15 are part of the constants)
+#define ROUND_ADDITION_00                           (ROUND_CONSTANT_00 + p_blocks[0])
+#define ROUND_ADDITION_01(mA)                       (ROUND_CONSTANT_01 + LEFT_ROTATE(mA, 5))
+#define ROUND_ADDITION_02(mA, mB, mC, mD)           (ROUND_CONSTANT_02 + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_03(mA, mB, mC, mD)           (ROUND_CONSTANT_03 + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_04(mA, mB, mC, mD)           (ROUND_CONSTANT_04 + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_05_14(mA, mB, mC, mD, mE)    (K_00_19 + mE + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+#define ROUND_ADDITION_15(mA, mB, mC, mD, mE)       (ROUND_CONSTANT_15 + mE + LEFT_ROTATE(mA, 5) + F_00_19(mB, mC, mD))
+// macros for setting state variables in each round
+#define ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition) \
+    mE = mRoundAddition;                                   \
+    mB = LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_END(mA, mB, mE, f, k, i)         \
+    mE = k + mE + LEFT_ROTATE(mA, 5) + f + (p_blocks[i]); \
+    mB = LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_ZERO(mA, mB, mE, f, k) \
+    mE = k + mE + LEFT_ROTATE(mA, 5) + f;       \
+    mB = LEFT_ROTATE(mB, 30);
+// macros for the round functions
+#define ROUND_00_15(mA, mB, mC, mD, mE, mRoundAddition) \
+    ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition)
+#define ROUND_16_19(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, F_00_19(mB, mC, mD), K_00_19, i)
+#define ROUND_20_39(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, F_REST(mB, mC, mD), K_20_39, i)
+#define ROUND_40_59(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, F_40_59(mB, mC, mD), K_40_59, i)
+#define ROUND_60_79(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, F_REST(mB, mC, mD), K_60_79, i)
+// macros for rounds whose word block is always zero
+#define ROUND_16_19_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_00_19(mB, mC, mD), K_00_19)
+#define ROUND_20_39_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_REST(mB, mC, mD), K_20_39)
+#define ROUND_40_59_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_40_59(mB, mC, mD), K_40_59)
+#define ROUND_60_79_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, F_REST(mB, mC, mD), K_60_79)
+// macro for rewinding rounds 79 - 76 of a single target (see initTargetSet)
+#define REWIND_ROUNDS_79_76(m74, m73, m72, m71)                                             \
+    m74 = p_targets->p_rewind[0] - p_blocks[79];                                            \
+    m73 = p_targets->p_rewind[1] - (p_targets->p_rewind[2] ^ m74) - p_blocks[78];           \
+    m72 = p_targets->p_rewind[3] - F_REST(p_targets->p_rewind[4], m74, m73) - p_blocks[77]; \
+    m71 = p_targets->p_rewind[5] - F_REST(LEFT_ROTATE(m74, 2), m73, m72) - p_blocks[76];
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+
+// function prototypes
+static int crackSliceLength1To3(struct crackJob         *p_job,
+                                const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength1To3(const uint32_t *p_precomputedBlocks,
+                                                 uint32_t       *p_w0,
+                                                 uint32_t       *p_blocks);
+static inline void precomputeBlocks72To75Length1To3(const uint32_t *p_precomputedBlocks,
+                                                    uint32_t       *p_w0,
+                                                    uint32_t       *p_blocks);
+static inline void precomputeBlocks76To79Length1To3(const uint32_t *p_precomputedBlocks,
+                                                    uint32_t       *p_w0,
+                                                    uint32_t       *p_blocks);
+static int crackSliceLength4To7(struct crackJob         *p_job,
+                                const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength4To7(const uint32_t *p_precomputedBlocks,
+                                                 uint32_t       *p_w0,
+                                                 uint32_t       *p_blocks);
+static inline void precomputeBlocks72To75Length4To7(const uint32_t *p_precomputedBlocks,
+                                                    uint32_t       *p_w0,
+                                                    uint32_t       *p_blocks);
+static inline void precomputeBlocks76To79Length4To7(const uint32_t *p_precomputedBlocks,
+                                                    uint32_t       *p_w0,
+                                                    uint32_t       *p_blocks);
+static int crackSliceLength8To11(struct crackJob         *p_job,
+                                 const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength8To11(const uint32_t *p_precomputedBlocks,
+                                                  uint32_t       *p_w0,
+                                                  uint32_t       *p_blocks);
+static inline void precomputeBlocks72To75Length8To11(const uint32_t *p_precomputedBlocks,
+                                                     uint32_t       *p_w0,
+                                                     uint32_t       *p_blocks);
+static inline void precomputeBlocks76To79Length8To11(const uint32_t *p_precomputedBlocks,
+                                                     uint32_t       *p_w0,
+                                                     uint32_t       *p_blocks);
+static int crackSliceLength12(struct crackJob         *p_job,
+                              const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength12(const uint32_t *p_precomputedBlocks,
+                                               uint32_t       *p_w0,
+                                               uint32_t       *p_blocks);
+static inline void precomputeBlocks72To75Length12(const uint32_t *p_precomputedBlocks,
+                                                  uint32_t       *p_w0,
+                                                  uint32_t       *p_blocks);
+static inline void precomputeBlocks76To79Length12(const uint32_t *p_precomputedBlocks,
+                                                  uint32_t       *p_w0,
+                                                  uint32_t       *p_blocks);
+
+/**
+ * Function: crackSliceGenericScalar
+ */
+int crackSliceGenericScalar
+(
+    struct crackJob *p_job,
+    uint64_t        slice
+)
+{
+    struct sliceSetup setup;
+    // outer loop bytes, padding and initial step constants of the slice
+    CYCLES_START(outerStart);
+    setupSlice(p_job->p_layout,
+               slice,
+               &setup);
+    CYCLES_STOP(outerCycles, outerStart);
+    COUNT(outerPrecomputes, 1);
+    // every preimage length has its own kernel (lengths with the same schedule share one)
+    switch(setup.length)
+    {
+        case 1:
+        case 2:
+        case 3:
+            return crackSliceLength1To3(p_job,
+                                        &setup);
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+            return crackSliceLength4To7(p_job,
+                                        &setup);
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+            return crackSliceLength8To11(p_job,
+                                         &setup);
+        default:
+            return crackSliceLength12(p_job,
+                                      &setup);
+    }
+}
+/**
+ * Function: crackSliceLength1To3
+ */
+static int crackSliceLength1To3
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_w0[23],
+                           p_blocks[80],
+                           p_state[5];
+    uint32_t               a, b, c, d, e, temp;
+    // rewound results of rounds 74 - 71 (single target)
+    uint32_t               r74, r73, r72, r71;
+    const struct targetSet *p_targets = p_job->p_targets;
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const uint32_t   ROUND_CONSTANT_00 = UINT32_C(0x9FB498B3),
+                     ROUND_CONSTANT_01 = UINT32_C(0x66B0CD0D),
+                     ROUND_CONSTANT_02 = UINT32_C(0xF33D5697),
+                     ROUND_CONSTANT_03 = UINT32_C(0xD675E47B),
+                     ROUND_CONSTANT_04 = UINT32_C(0xB453C259),
+                     ROUND_CONSTANT_15 = p_setup->p_roundConstants[5];
+    // inner loop through all combinations of input bytes 0 - 3
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low++)
+        {
+            // generate (missing) first word block based on new input
+            p_blocks[0] = p_setup->p_innerHigh[high] | p_setup->p_innerLow[low];
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength1To3(p_setup->p_precomputedBlocks,
+                                          p_w0,
+                                          p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 1);
+            // initialize state variables with constants
+            a = SHA1_IV_0;
+            b = SHA1_IV_1;
+            c = SHA1_IV_2;
+            d = SHA1_IV_3;
+            e = SHA1_IV_4;
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19_ZERO(d, e, a, b, c)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39_ZERO(a, b, c, d, e)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39_ZERO(e, a, b, c, d)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length1To3(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                if(LIKELY(LEFT_ROTATE(d, 30) != r71))
+                    continue;
+                COUNT(earlyExitPassed, 1);
+                precomputeBlocks72To75Length1To3(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length1To3(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                p_blocks[79] = p_setup->p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                temp = LEFT_ROTATE(a, 30) + p_blocks[79];
+                if(LIKELY(!TARGET_SET_MAY_CONTAIN(p_targets, temp)))
+                    continue;
+                if(!targetSetContainsKey(p_targets, temp))
+                    continue;
+                precomputeBlocks76To79Length1To3(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            // compare the full state against all targets with this early exit value
+            p_state[0] = a;
+            p_state[1] = b;
+            p_state[2] = c;
+            p_state[3] = d;
+            p_state[4] = e;
+            getSlicePreimage(p_setup,
+                             (uint64_t) high * p_setup->numberOfInnerLow + low,
+                             p_preimage);
+            reportCandidate(p_job,
+                            p_state,
+                            p_preimage,
+                            p_setup->length);
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: crackSliceLength4To7
+ */
+static int crackSliceLength4To7
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_w0[23],
+                           p_blocks[80],
+                           p_state[5];
+    uint32_t               a, b, c, d, e, temp;
+    // rewound results of rounds 74 - 71 (single target)
+    uint32_t               r74, r73, r72, r71;
+    const struct targetSet *p_targets = p_job->p_targets;
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const uint32_t   ROUND_CONSTANT_00 = UINT32_C(0x9FB498B3),
+                     ROUND_CONSTANT_01 = p_setup->p_roundConstants[1],
+                     ROUND_CONSTANT_02 = UINT32_C(0xF33D5697),
+                     ROUND_CONSTANT_03 = UINT32_C(0xD675E47B),
+                     ROUND_CONSTANT_04 = UINT32_C(0xB453C259),
+                     ROUND_CONSTANT_15 = p_setup->p_roundConstants[5];
+    // inner loop through all combinations of input bytes 0 - 3
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low++)
+        {
+            // generate (missing) first word block based on new input
+            p_blocks[0] = p_setup->p_innerHigh[high] | p_setup->p_innerLow[low];
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength4To7(p_setup->p_precomputedBlocks,
+                                          p_w0,
+                                          p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 1);
+            // initialize state variables with constants
+            a = SHA1_IV_0;
+            b = SHA1_IV_1;
+            c = SHA1_IV_2;
+            d = SHA1_IV_3;
+            e = SHA1_IV_4;
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19(d, e, a, b, c, 17)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39(a, b, c, d, e, 20)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39(e, a, b, c, d, 26)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length4To7(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                if(LIKELY(LEFT_ROTATE(d, 30) != r71))
+                    continue;
+                COUNT(earlyExitPassed, 1);
+                precomputeBlocks72To75Length4To7(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length4To7(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                p_blocks[79] = p_setup->p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                temp = LEFT_ROTATE(a, 30) + p_blocks[79];
+                if(LIKELY(!TARGET_SET_MAY_CONTAIN(p_targets, temp)))
+                    continue;
+                if(!targetSetContainsKey(p_targets, temp))
+                    continue;
+                precomputeBlocks76To79Length4To7(p_setup->p_precomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            // compare the full state against all targets with this early exit value
+            p_state[0] = a;
+            p_state[1] = b;
+            p_state[2] = c;
+            p_state[3] = d;
+            p_state[4] = e;
+            getSlicePreimage(p_setup,
+                             (uint64_t) high * p_setup->numberOfInnerLow + low,
+                             p_preimage);
+            reportCandidate(p_job,
+                            p_state,
+                            p_preimage,
+                            p_setup->length);
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: crackSliceLength8To11
+ */
+static int crackSliceLength8To11
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_w0[23],
+                           p_blocks[80],
+                           p_state[5];
+    uint32_t               a, b, c, d, e, temp;
+    // rewound results of rounds 74 - 71 (single target)
+    uint32_t               r74, r73, r72, r71;
+    const struct targetSet *p_targets = p_job->p_targets;
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const uint32_t   ROUND_CONSTANT_00 = UINT32_C(0x9FB498B3),
+                     ROUND_CONSTANT_01 = p_setup->p_roundConstants[1],
+                     ROUND_CONSTANT_02 = p_setup->p_roundConstants[2],
+                     ROUND_CONSTANT_03 = UINT32_C(0xD675E47B),
+                     ROUND_CONSTANT_04 = UINT32_C(0xB453C259),
+                     ROUND_CONSTANT_15 = p_setup->p_roundConstants[5];
+    // inner loop through all combinations of input bytes 0 - 3
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low++)
+        {
+            // generate (missing) first word block based on new input
+            p_blocks[0] = p_setup->p_innerHigh[high] | p_setup->p_innerLow[low];
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength8To11(p_setup->p_precomputedBlocks,
+                                           p_w0,
+                                           p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 1);
+            // initialize state variables with constants
+            a = SHA1_IV_0;
+            b = SHA1_IV_1;
+            c = SHA1_IV_2;
+            d = SHA1_IV_3;
+            e = SHA1_IV_4;
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19(d, e, a, b, c, 17)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39(a, b, c, d, e, 20)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39(e, a, b, c, d, 26)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length8To11(p_setup->p_precomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                if(LIKELY(LEFT_ROTATE(d, 30) != r71))
+                    continue;
+                COUNT(earlyExitPassed, 1);
+                precomputeBlocks72To75Length8To11(p_setup->p_precomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length8To11(p_setup->p_precomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+                p_blocks[79] = p_setup->p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                temp = LEFT_ROTATE(a, 30) + p_blocks[79];
+                if(LIKELY(!TARGET_SET_MAY_CONTAIN(p_targets, temp)))
+                    continue;
+                if(!targetSetContainsKey(p_targets, temp))
+                    continue;
+                precomputeBlocks76To79Length8To11(p_setup->p_precomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            // compare the full state against all targets with this early exit value
+            p_state[0] = a;
+            p_state[1] = b;
+            p_state[2] = c;
+            p_state[3] = d;
+            p_state[4] = e;
+            getSlicePreimage(p_setup,
+                             (uint64_t) high * p_setup->numberOfInnerLow + low,
+                             p_preimage);
+            reportCandidate(p_job,
+                            p_state,
+                            p_preimage,
+                            p_setup->length);
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: crackSliceLength12
+ */
+static int crackSliceLength12
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_w0[23],
+                           p_blocks[80],
+                           p_state[5];
+    uint32_t               a, b, c, d, e, temp;
+    // rewound results of rounds 74 - 71 (single target)
+    uint32_t               r74, r73, r72, r71;
+    const struct targetSet *p_targets = p_job->p_targets;
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const uint32_t   ROUND_CONSTANT_00 = UINT32_C(0x9FB498B3),
+                     ROUND_CONSTANT_01 = p_setup->p_roundConstants[1],
+                     ROUND_CONSTANT_02 = p_setup->p_roundConstants[2],
+                     ROUND_CONSTANT_03 = p_setup->p_roundConstants[3],
+                     ROUND_CONSTANT_04 = UINT32_C(0xB453C259),
+                     ROUND_CONSTANT_15 = p_setup->p_roundConstants[5];
+    // inner loop through all combinations of input bytes 0 - 3
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low++)
+        {
+            // generate (missing) first word block based on new input
+            p_blocks[0] = p_setup->p_innerHigh[high] | p_setup->p_innerLow[low];
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength12(p_setup->p_precomputedBlocks,
+                                        p_w0,
+                                        p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 1);
+            // initialize state variables with constants
+            a = SHA1_IV_0;
+            b = SHA1_IV_1;
+            c = SHA1_IV_2;
+            d = SHA1_IV_3;
+            e = SHA1_IV_4;
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19(d, e, a, b, c, 17)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39(a, b, c, d, e, 20)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39(e, a, b, c, d, 26)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length12(p_setup->p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                if(LIKELY(LEFT_ROTATE(d, 30) != r71))
+                    continue;
+                COUNT(earlyExitPassed, 1);
+                precomputeBlocks72To75Length12(p_setup->p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length12(p_setup->p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                p_blocks[79] = p_setup->p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                temp = LEFT_ROTATE(a, 30) + p_blocks[79];
+                if(LIKELY(!TARGET_SET_MAY_CONTAIN(p_targets, temp)))
+                    continue;
+                if(!targetSetContainsKey(p_targets, temp))
+                    continue;
+                precomputeBlocks76To79Length12(p_setup->p_precomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            // compare the full state against all targets with this early exit value
+            p_state[0] = a;
+            p_state[1] = b;
+            p_state[2] = c;
+            p_state[3] = d;
+            p_state[4] = e;
+            getSlicePreimage(p_setup,
+                             (uint64_t) high * p_setup->numberOfInnerLow + low,
+                             p_preimage);
+            reportCandidate(p_job,
+                            p_state,
+                            p_preimage,
+                            p_setup->length);
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: precomputeInnerLoopLength1To3
+ */
+static inline void precomputeInnerLoopLength1To3
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = p_w0[1];
+    p_blocks[18] = p_precomputedBlocks[18];
+    p_blocks[19] = p_w0[2];
+    p_blocks[21] = p_precomputedBlocks[21];
+    p_blocks[22] = p_w0[3];
+    p_blocks[23] = p_precomputedBlocks[23];
+    p_blocks[24] = p_precomputedBlocks[24] ^ p_w0[2];
+    p_blocks[25] = p_w0[4];
+    p_blocks[27] = p_precomputedBlocks[27];
+    p_blocks[28] = p_w0[5];
+    p_blocks[29] = p_precomputedBlocks[29];
+    p_blocks[30] = p_precomputedBlocks[30] ^ p_w0[2] ^ p_w0[4];
+    p_blocks[31] = p_precomputedBlocks[31] ^ p_w0[6];
+    p_blocks[32] = p_w0[2] ^ p_w0[3];
+    p_blocks[33] = p_precomputedBlocks[33];
+    p_blocks[34] = p_precomputedBlocks[34] ^ p_w0[7];
+    p_blocks[35] = p_precomputedBlocks[35] ^ p_w0[4];
+    p_blocks[36] = p_precomputedBlocks[36] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[37] = p_precomputedBlocks[37] ^ p_w0[8];
+    p_blocks[38] = p_w0[4];
+    p_blocks[39] = p_precomputedBlocks[39];
+    p_blocks[40] = p_w0[4] ^ p_w0[9];
+    p_blocks[41] = p_precomputedBlocks[41];
+    p_blocks[42] = p_precomputedBlocks[42] ^ p_w0[6] ^ p_w0[8];
+    p_blocks[43] = p_precomputedBlocks[43] ^ p_w0[10];
+    p_blocks[44] = p_w0[3] ^ p_w0[6] ^ p_w0[7];
+    p_blocks[45] = p_precomputedBlocks[45];
+    p_blocks[46] = p_precomputedBlocks[46] ^ p_w0[4] ^ p_w0[11];
+    p_blocks[47] = p_precomputedBlocks[47] ^ p_w0[4] ^ p_w0[8];
+    p_blocks[48] = p_precomputedBlocks[48] ^ p_w0[3] ^ p_w0[4] ^ p_w0[5] ^ p_w0[8] ^ p_w0[10];
+    p_blocks[49] = p_precomputedBlocks[49] ^ p_w0[12];
+    p_blocks[50] = p_precomputedBlocks[50] ^ p_w0[8];
+    p_blocks[51] = p_precomputedBlocks[51] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[52] = p_w0[4] ^ p_w0[8] ^ p_w0[13];
+    p_blocks[53] = p_precomputedBlocks[53];
+    p_blocks[54] = p_precomputedBlocks[54] ^ p_w0[7] ^ p_w0[10] ^ p_w0[12];
+    p_blocks[55] = p_precomputedBlocks[55] ^ p_w0[14];
+    p_blocks[56] = p_precomputedBlocks[56] ^ p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[10] ^ p_w0[11];
+    p_blocks[57] = p_precomputedBlocks[57] ^ p_w0[8];
+    p_blocks[58] = p_precomputedBlocks[58] ^ p_w0[4] ^ p_w0[8] ^ p_w0[15];
+    p_blocks[59] = p_precomputedBlocks[59] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[60] = p_precomputedBlocks[60] ^ p_w0[4] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[14];
+    p_blocks[61] = p_precomputedBlocks[61] ^ p_w0[16];
+    p_blocks[62] = p_precomputedBlocks[62] ^ p_w0[4] ^ p_w0[6] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[63] = p_precomputedBlocks[63] ^ p_w0[8];
+    p_blocks[64] = p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[17];
+    p_blocks[65] = p_precomputedBlocks[65];
+    p_blocks[66] = p_precomputedBlocks[66] ^ p_w0[14] ^ p_w0[16];
+    p_blocks[67] = p_precomputedBlocks[67] ^ p_w0[8] ^ p_w0[18];
+    p_blocks[68] = p_w0[11] ^ p_w0[14] ^ p_w0[15];
+    p_blocks[69] = p_precomputedBlocks[69];
+    p_blocks[70] = p_precomputedBlocks[70] ^ p_w0[12] ^ p_w0[19];
+    p_blocks[71] = p_precomputedBlocks[71] ^ p_w0[12] ^ p_w0[16];
+}
+/**
+ * Function: precomputeBlocks72To75Length1To3
+ */
+static inline void precomputeBlocks72To75Length1To3
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength1To3)
+    p_blocks[72] = p_precomputedBlocks[72] ^ p_w0[5] ^ p_w0[11] ^ p_w0[12] ^ p_w0[13] ^ p_w0[16] ^ p_w0[18];
+    p_blocks[73] = p_precomputedBlocks[73] ^ p_w0[20];
+    p_blocks[74] = p_precomputedBlocks[74] ^ p_w0[8] ^ p_w0[16];
+    p_blocks[75] = p_precomputedBlocks[75] ^ p_w0[6] ^ p_w0[12] ^ p_w0[14];
+}
+/**
+ * Function: precomputeBlocks76To79Length1To3
+ */
+static inline void precomputeBlocks76To79Length1To3
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength1To3)
+    p_blocks[76] = p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[16] ^ p_w0[21];
+    p_blocks[77] = p_precomputedBlocks[77];
+    p_blocks[78] = p_precomputedBlocks[78] ^ p_w0[7] ^ p_w0[8] ^ p_w0[15] ^ p_w0[18] ^ p_w0[20];
+    p_blocks[79] = p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+}
+/**
+ * Function: precomputeInnerLoopLength4To7
+ */
+static inline void precomputeInnerLoopLength4To7
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = p_w0[1];
+    p_blocks[17] = p_precomputedBlocks[17];
+    p_blocks[18] = p_precomputedBlocks[18];
+    p_blocks[19] = p_w0[2];
+    p_blocks[20] = p_precomputedBlocks[20];
+    p_blocks[21] = p_precomputedBlocks[21];
+    p_blocks[22] = p_w0[3];
+    p_blocks[23] = p_precomputedBlocks[23];
+    p_blocks[24] = p_precomputedBlocks[24] ^ p_w0[2];
+    p_blocks[25] = p_precomputedBlocks[25] ^ p_w0[4];
+    p_blocks[26] = p_precomputedBlocks[26];
+    p_blocks[27] = p_precomputedBlocks[27];
+    p_blocks[28] = p_w0[5];
+    p_blocks[29] = p_precomputedBlocks[29];
+    p_blocks[30] = p_precomputedBlocks[30] ^ p_w0[2] ^ p_w0[4];
+    p_blocks[31] = p_precomputedBlocks[31] ^ p_w0[6];
+    p_blocks[32] = p_precomputedBlocks[32] ^ p_w0[2] ^ p_w0[3];
+    p_blocks[33] = p_precomputedBlocks[33];
+    p_blocks[34] = p_precomputedBlocks[34] ^ p_w0[7];
+    p_blocks[35] = p_precomputedBlocks[35] ^ p_w0[4];
+    p_blocks[36] = p_precomputedBlocks[36] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[37] = p_precomputedBlocks[37] ^ p_w0[8];
+    p_blocks[38] = p_precomputedBlocks[38] ^ p_w0[4];
+    p_blocks[39] = p_precomputedBlocks[39];
+    p_blocks[40] = p_w0[4] ^ p_w0[9];
+    p_blocks[41] = p_precomputedBlocks[41];
+    p_blocks[42] = p_precomputedBlocks[42] ^ p_w0[6] ^ p_w0[8];
+    p_blocks[43] = p_precomputedBlocks[43] ^ p_w0[10];
+    p_blocks[44] = p_precomputedBlocks[44] ^ p_w0[3] ^ p_w0[6] ^ p_w0[7];
+    p_blocks[45] = p_precomputedBlocks[45];
+    p_blocks[46] = p_precomputedBlocks[46] ^ p_w0[4] ^ p_w0[11];
+    p_blocks[47] = p_precomputedBlocks[47] ^ p_w0[4] ^ p_w0[8];
+    p_blocks[48] = p_precomputedBlocks[48] ^ p_w0[3] ^ p_w0[4] ^ p_w0[5] ^ p_w0[8] ^ p_w0[10];
+    p_blocks[49] = p_precomputedBlocks[49] ^ p_w0[12];
+    p_blocks[50] = p_precomputedBlocks[50] ^ p_w0[8];
+    p_blocks[51] = p_precomputedBlocks[51] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[52] = p_precomputedBlocks[52] ^ p_w0[4] ^ p_w0[8] ^ p_w0[13];
+    p_blocks[53] = p_precomputedBlocks[53];
+    p_blocks[54] = p_precomputedBlocks[54] ^ p_w0[7] ^ p_w0[10] ^ p_w0[12];
+    p_blocks[55] = p_precomputedBlocks[55] ^ p_w0[14];
+    p_blocks[56] = p_precomputedBlocks[56] ^ p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[10] ^ p_w0[11];
+    p_blocks[57] = p_precomputedBlocks[57] ^ p_w0[8];
+    p_blocks[58] = p_precomputedBlocks[58] ^ p_w0[4] ^ p_w0[8] ^ p_w0[15];
+    p_blocks[59] = p_precomputedBlocks[59] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[60] = p_precomputedBlocks[60] ^ p_w0[4] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[14];
+    p_blocks[61] = p_precomputedBlocks[61] ^ p_w0[16];
+    p_blocks[62] = p_precomputedBlocks[62] ^ p_w0[4] ^ p_w0[6] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[63] = p_precomputedBlocks[63] ^ p_w0[8];
+    p_blocks[64] = p_precomputedBlocks[64] ^ p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[17];
+    p_blocks[65] = p_precomputedBlocks[65];
+    p_blocks[66] = p_precomputedBlocks[66] ^ p_w0[14] ^ p_w0[16];
+    p_blocks[67] = p_precomputedBlocks[67] ^ p_w0[8] ^ p_w0[18];
+    p_blocks[68] = p_precomputedBlocks[68] ^ p_w0[11] ^ p_w0[14] ^ p_w0[15];
+    p_blocks[69] = p_precomputedBlocks[69];
+    p_blocks[70] = p_precomputedBlocks[70] ^ p_w0[12] ^ p_w0[19];
+    p_blocks[71] = p_precomputedBlocks[71] ^ p_w0[12] ^ p_w0[16];
+}
+/**
+ * Function: precomputeBlocks72To75Length4To7
+ */
+static inline void precomputeBlocks72To75Length4To7
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength4To7)
+    p_blocks[72] = p_precomputedBlocks[72] ^ p_w0[5] ^ p_w0[11] ^ p_w0[12] ^ p_w0[13] ^ p_w0[16] ^ p_w0[18];
+    p_blocks[73] = p_precomputedBlocks[73] ^ p_w0[20];
+    p_blocks[74] = p_precomputedBlocks[74] ^ p_w0[8] ^ p_w0[16];
+    p_blocks[75] = p_precomputedBlocks[75] ^ p_w0[6] ^ p_w0[12] ^ p_w0[14];
+}
+/**
+ * Function: precomputeBlocks76To79Length4To7
+ */
+static inline void precomputeBlocks76To79Length4To7
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength4To7)
+    p_blocks[76] = p_precomputedBlocks[76] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[16] ^ p_w0[21];
+    p_blocks[77] = p_precomputedBlocks[77];
+    p_blocks[78] = p_precomputedBlocks[78] ^ p_w0[7] ^ p_w0[8] ^ p_w0[15] ^ p_w0[18] ^ p_w0[20];
+    p_blocks[79] = p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+}
+/**
+ * Function: precomputeInnerLoopLength8To11
+ */
+static inline void precomputeInnerLoopLength8To11
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = p_precomputedBlocks[16] ^ p_w0[1];
+    p_blocks[17] = p_precomputedBlocks[17];
+    p_blocks[18] = p_precomputedBlocks[18];
+    p_blocks[19] = p_precomputedBlocks[19] ^ p_w0[2];
+    p_blocks[20] = p_precomputedBlocks[20];
+    p_blocks[21] = p_precomputedBlocks[21];
+    p_blocks[22] = p_precomputedBlocks[22] ^ p_w0[3];
+    p_blocks[23] = p_precomputedBlocks[23];
+    p_blocks[24] = p_precomputedBlocks[24] ^ p_w0[2];
+    p_blocks[25] = p_precomputedBlocks[25] ^ p_w0[4];
+    p_blocks[26] = p_precomputedBlocks[26];
+    p_blocks[27] = p_precomputedBlocks[27];
+    p_blocks[28] = p_precomputedBlocks[28] ^ p_w0[5];
+    p_blocks[29] = p_precomputedBlocks[29];
+    p_blocks[30] = p_precomputedBlocks[30] ^ p_w0[2] ^ p_w0[4];
+    p_blocks[31] = p_precomputedBlocks[31] ^ p_w0[6];
+    p_blocks[32] = p_precomputedBlocks[32] ^ p_w0[2] ^ p_w0[3];
+    p_blocks[33] = p_precomputedBlocks[33];
+    p_blocks[34] = p_precomputedBlocks[34] ^ p_w0[7];
+    p_blocks[35] = p_precomputedBlocks[35] ^ p_w0[4];
+    p_blocks[36] = p_precomputedBlocks[36] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[37] = p_precomputedBlocks[37] ^ p_w0[8];
+    p_blocks[38] = p_precomputedBlocks[38] ^ p_w0[4];
+    p_blocks[39] = p_precomputedBlocks[39];
+    p_blocks[40] = p_precomputedBlocks[40] ^ p_w0[4] ^ p_w0[9];
+    p_blocks[41] = p_precomputedBlocks[41];
+    p_blocks[42] = p_precomputedBlocks[42] ^ p_w0[6] ^ p_w0[8];
+    p_blocks[43] = p_precomputedBlocks[43] ^ p_w0[10];
+    p_blocks[44] = p_precomputedBlocks[44] ^ p_w0[3] ^ p_w0[6] ^ p_w0[7];
+    p_blocks[45] = p_precomputedBlocks[45];
+    p_blocks[46] = p_precomputedBlocks[46] ^ p_w0[4] ^ p_w0[11];
+    p_blocks[47] = p_precomputedBlocks[47] ^ p_w0[4] ^ p_w0[8];
+    p_blocks[48] = p_precomputedBlocks[48] ^ p_w0[3] ^ p_w0[4] ^ p_w0[5] ^ p_w0[8] ^ p_w0[10];
+    p_blocks[49] = p_precomputedBlocks[49] ^ p_w0[12];
+    p_blocks[50] = p_precomputedBlocks[50] ^ p_w0[8];
+    p_blocks[51] = p_precomputedBlocks[51] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[52] = p_precomputedBlocks[52] ^ p_w0[4] ^ p_w0[8] ^ p_w0[13];
+    p_blocks[53] = p_precomputedBlocks[53];
+    p_blocks[54] = p_precomputedBlocks[54] ^ p_w0[7] ^ p_w0[10] ^ p_w0[12];
+    p_blocks[55] = p_precomputedBlocks[55] ^ p_w0[14];
+    p_blocks[56] = p_precomputedBlocks[56] ^ p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[10] ^ p_w0[11];
+    p_blocks[57] = p_precomputedBlocks[57] ^ p_w0[8];
+    p_blocks[58] = p_precomputedBlocks[58] ^ p_w0[4] ^ p_w0[8] ^ p_w0[15];
+    p_blocks[59] = p_precomputedBlocks[59] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[60] = p_precomputedBlocks[60] ^ p_w0[4] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[14];
+    p_blocks[61] = p_precomputedBlocks[61] ^ p_w0[16];
+    p_blocks[62] = p_precomputedBlocks[62] ^ p_w0[4] ^ p_w0[6] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[63] = p_precomputedBlocks[63] ^ p_w0[8];
+    p_blocks[64] = p_precomputedBlocks[64] ^ p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[17];
+    p_blocks[65] = p_precomputedBlocks[65];
+    p_blocks[66] = p_precomputedBlocks[66] ^ p_w0[14] ^ p_w0[16];
+    p_blocks[67] = p_precomputedBlocks[67] ^ p_w0[8] ^ p_w0[18];
+    p_blocks[68] = p_precomputedBlocks[68] ^ p_w0[11] ^ p_w0[14] ^ p_w0[15];
+    p_blocks[69] = p_precomputedBlocks[69];
+    p_blocks[70] = p_precomputedBlocks[70] ^ p_w0[12] ^ p_w0[19];
+    p_blocks[71] = p_precomputedBlocks[71] ^ p_w0[12] ^ p_w0[16];
+}
+/**
+ * Function: precomputeBlocks72To75Length8To11
+ */
+static inline void precomputeBlocks72To75Length8To11
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength8To11)
+    p_blocks[72] = p_precomputedBlocks[72] ^ p_w0[5] ^ p_w0[11] ^ p_w0[12] ^ p_w0[13] ^ p_w0[16] ^ p_w0[18];
+    p_blocks[73] = p_precomputedBlocks[73] ^ p_w0[20];
+    p_blocks[74] = p_precomputedBlocks[74] ^ p_w0[8] ^ p_w0[16];
+    p_blocks[75] = p_precomputedBlocks[75] ^ p_w0[6] ^ p_w0[12] ^ p_w0[14];
+}
+/**
+ * Function: precomputeBlocks76To79Length8To11
+ */
+static inline void precomputeBlocks76To79Length8To11
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength8To11)
+    p_blocks[76] = p_precomputedBlocks[76] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[16] ^ p_w0[21];
+    p_blocks[77] = p_precomputedBlocks[77];
+    p_blocks[78] = p_precomputedBlocks[78] ^ p_w0[7] ^ p_w0[8] ^ p_w0[15] ^ p_w0[18] ^ p_w0[20];
+    p_blocks[79] = p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+}
+/**
+ * Function: precomputeInnerLoopLength12
+ */
+static inline void precomputeInnerLoopLength12
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = p_precomputedBlocks[16] ^ p_w0[1];
+    p_blocks[17] = p_precomputedBlocks[17];
+    p_blocks[18] = p_precomputedBlocks[18];
+    p_blocks[19] = p_precomputedBlocks[19] ^ p_w0[2];
+    p_blocks[20] = p_precomputedBlocks[20];
+    p_blocks[21] = p_precomputedBlocks[21];
+    p_blocks[22] = p_precomputedBlocks[22] ^ p_w0[3];
+    p_blocks[23] = p_precomputedBlocks[23];
+    p_blocks[24] = p_precomputedBlocks[24] ^ p_w0[2];
+    p_blocks[25] = p_precomputedBlocks[25] ^ p_w0[4];
+    p_blocks[26] = p_precomputedBlocks[26];
+    p_blocks[27] = p_precomputedBlocks[27];
+    p_blocks[28] = p_precomputedBlocks[28] ^ p_w0[5];
+    p_blocks[29] = p_precomputedBlocks[29];
+    p_blocks[30] = p_precomputedBlocks[30] ^ p_w0[2] ^ p_w0[4];
+    p_blocks[31] = p_precomputedBlocks[31] ^ p_w0[6];
+    p_blocks[32] = p_precomputedBlocks[32] ^ p_w0[2] ^ p_w0[3];
+    p_blocks[33] = p_precomputedBlocks[33];
+    p_blocks[34] = p_precomputedBlocks[34] ^ p_w0[7];
+    p_blocks[35] = p_precomputedBlocks[35] ^ p_w0[4];
+    p_blocks[36] = p_precomputedBlocks[36] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[37] = p_precomputedBlocks[37] ^ p_w0[8];
+    p_blocks[38] = p_precomputedBlocks[38] ^ p_w0[4];
+    p_blocks[39] = p_precomputedBlocks[39];
+    p_blocks[40] = p_precomputedBlocks[40] ^ p_w0[4] ^ p_w0[9];
+    p_blocks[41] = p_precomputedBlocks[41];
+    p_blocks[42] = p_precomputedBlocks[42] ^ p_w0[6] ^ p_w0[8];
+    p_blocks[43] = p_precomputedBlocks[43] ^ p_w0[10];
+    p_blocks[44] = p_precomputedBlocks[44] ^ p_w0[3] ^ p_w0[6] ^ p_w0[7];
+    p_blocks[45] = p_precomputedBlocks[45];
+    p_blocks[46] = p_precomputedBlocks[46] ^ p_w0[4] ^ p_w0[11];
+    p_blocks[47] = p_precomputedBlocks[47] ^ p_w0[4] ^ p_w0[8];
+    p_blocks[48] = p_precomputedBlocks[48] ^ p_w0[3] ^ p_w0[4] ^ p_w0[5] ^ p_w0[8] ^ p_w0[10];
+    p_blocks[49] = p_precomputedBlocks[49] ^ p_w0[12];
+    p_blocks[50] = p_precomputedBlocks[50] ^ p_w0[8];
+    p_blocks[51] = p_precomputedBlocks[51] ^ p_w0[4] ^ p_w0[6];
+    p_blocks[52] = p_precomputedBlocks[52] ^ p_w0[4] ^ p_w0[8] ^ p_w0[13];
+    p_blocks[53] = p_precomputedBlocks[53];
+    p_blocks[54] = p_precomputedBlocks[54] ^ p_w0[7] ^ p_w0[10] ^ p_w0[12];
+    p_blocks[55] = p_precomputedBlocks[55] ^ p_w0[14];
+    p_blocks[56] = p_precomputedBlocks[56] ^ p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[10] ^ p_w0[11];
+    p_blocks[57] = p_precomputedBlocks[57] ^ p_w0[8];
+    p_blocks[58] = p_precomputedBlocks[58] ^ p_w0[4] ^ p_w0[8] ^ p_w0[15];
+    p_blocks[59] = p_precomputedBlocks[59] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[60] = p_precomputedBlocks[60] ^ p_w0[4] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[14];
+    p_blocks[61] = p_precomputedBlocks[61] ^ p_w0[16];
+    p_blocks[62] = p_precomputedBlocks[62] ^ p_w0[4] ^ p_w0[6] ^ p_w0[8] ^ p_w0[12];
+    p_blocks[63] = p_precomputedBlocks[63] ^ p_w0[8];
+    p_blocks[64] = p_precomputedBlocks[64] ^ p_w0[4] ^ p_w0[6] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[17];
+    p_blocks[65] = p_precomputedBlocks[65];
+    p_blocks[66] = p_precomputedBlocks[66] ^ p_w0[14] ^ p_w0[16];
+    p_blocks[67] = p_precomputedBlocks[67] ^ p_w0[8] ^ p_w0[18];
+    p_blocks[68] = p_precomputedBlocks[68] ^ p_w0[11] ^ p_w0[14] ^ p_w0[15];
+    p_blocks[69] = p_precomputedBlocks[69];
+    p_blocks[70] = p_precomputedBlocks[70] ^ p_w0[12] ^ p_w0[19];
+    p_blocks[71] = p_precomputedBlocks[71] ^ p_w0[12] ^ p_w0[16];
+}
+/**
+ * Function: precomputeBlocks72To75Length12
+ */
+static inline void precomputeBlocks72To75Length12
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength12)
+    p_blocks[72] = p_precomputedBlocks[72] ^ p_w0[5] ^ p_w0[11] ^ p_w0[12] ^ p_w0[13] ^ p_w0[16] ^ p_w0[18];
+    p_blocks[73] = p_precomputedBlocks[73] ^ p_w0[20];
+    p_blocks[74] = p_precomputedBlocks[74] ^ p_w0[8] ^ p_w0[16];
+    p_blocks[75] = p_precomputedBlocks[75] ^ p_w0[6] ^ p_w0[12] ^ p_w0[14];
+}
+/**
+ * Function: precomputeBlocks76To79Length12
+ */
+static inline void precomputeBlocks76To79Length12
+(
+    const uint32_t *p_precomputedBlocks,
+    uint32_t       *p_w0,
+    uint32_t       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength12)
+    p_blocks[76] = p_precomputedBlocks[76] ^ p_w0[7] ^ p_w0[8] ^ p_w0[12] ^ p_w0[16] ^ p_w0[21];
+    p_blocks[77] = p_precomputedBlocks[77];
+    p_blocks[78] = p_precomputedBlocks[78] ^ p_w0[7] ^ p_w0[8] ^ p_w0[15] ^ p_w0[18] ^ p_w0[20];
+    p_blocks[79] = p_precomputedBlocks[79] ^ p_w0[8] ^ p_w0[22];
+}
@@ -0,0 +1,1612 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+/*
+ *  Generated by scripts/generate_kernels.py, do not edit.
+ *
+ *  Generic kernel for arbitrary keyspaces, specialized per preimage length:
+ *  - lengths 1 - 3: word blocks 17, 20, 26 are always zero, 13 only depend on word block 0, initial step constants 1, 2, 3, 4 are fixed
+ *  - lengths 4 - 7: no word block 16 - 79 is always zero, 5 only depend on word block 0, initial step constants 2, 3, 4 are fixed
+ *  - lengths 8 - 11: no word block 16 - 79 is always zero, initial step constants 3, 4 are fixed
+ *  - length 12: no word block 16 - 79 is always zero, initial step constant 4 is fixed
+ */
+#include "sha1-cracker.h"
+// compile this kernel for SSE2, it is only called if the CPU supports it
+#pragma GCC target("sse2")
+// SSE2 intrinsics
+#include <emmintrin.h>
+
+// macros for SSE2 intrinsics
+#define OR(x, y)                        (_mm_or_si128(x, y))
+#define XOR(x, y)                       (_mm_xor_si128(x, y))
+#define AND(x, y)                       (_mm_and_si128(x, y))
+#define ADD(x, y)                       (_mm_add_epi32(x, y))
+#define SUB(x, y)                       (_mm_sub_epi32(x, y))
+#define SLLI(x, bits)                   (_mm_slli_epi32(x, bits))
+#define SRLI(x, bits)                   (_mm_srli_epi32(x, bits))
+#define SET1INT(x)                      (_mm_set1_epi32(x))
+#define STORE(loc, x)                   (_mm_storeu_si128(((__m128i *) loc), x))
+#define LOAD(loc)                       (_mm_loadu_si128((const __m128i *) (loc)))
+#define CMPEQ(x, y)                     (_mm_cmpeq_epi32(x, y))
+#define MOVEMASK(x)                     (_mm_movemask_ps(_mm_castsi128_ps(x)))
+
+// macros for f-functions
+#define VF_00_19(mB, mC, mD) (XOR(mD, (AND(mB, (XOR(mC, mD))))))
+#define VF_40_59(mB, mC, mD) (XOR(AND(mB, mC), (AND(mD, (XOR(mB, mC))))))
+#define VF_REST(mB, mC, mD)  (XOR((XOR(mB, mC)), mD))
+
+// macros for circular left-shift (adapted from RFC 3174)
+#define VEC_LEFT_ROTATE(word, bits) (OR((SLLI((word), (bits))), (SRLI((word), (32 - (bits))))))
+
+// macros for the different round additions (word blocks 1 - 15 are part of the constants)
+#define ROUND_ADDITION_00                           (ADD(ROUND_CONSTANT_00, p_blocks[0]))
+#define ROUND_ADDITION_01(mA)                       (ADD(ROUND_CONSTANT_01, VEC_LEFT_ROTATE(mA, 5)))
+#define ROUND_ADDITION_02(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_02, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_03(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_03, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_04(mA, mB, mC, mD)           (ADD(ADD(ROUND_CONSTANT_04, VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_05_14(mA, mB, mC, mD, mE)    (ADD(ADD(ADD(K_00_19, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+#define ROUND_ADDITION_15(mA, mB, mC, mD, mE)       (ADD(ADD(ADD(ROUND_CONSTANT_15, mE), VEC_LEFT_ROTATE(mA, 5)), VF_00_19(mB, mC, mD)))
+
+// macros for setting state variables in each round
+#define ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition) \
+    mE = mRoundAddition;                                   \
+    mB = VEC_LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_END(mA, mB, mE, f, k, i)                             \
+    mE = ADD(ADD(ADD(k, mE), VEC_LEFT_ROTATE(mA, 5)), ADD(f, (p_blocks[i]))); \
+    mB = VEC_LEFT_ROTATE(mB, 30);
+#define ROUND_PROCESSING_ZERO(mA, mB, mE, f, k)           \
+    mE = ADD(ADD(ADD(k, mE), VEC_LEFT_ROTATE(mA, 5)), f); \
+    mB = VEC_LEFT_ROTATE(mB, 30);
+
+// macros for the round functions
+#define ROUND_00_15(mA, mB, mC, mD, mE, mRoundAddition) \
+    ROUND_PROCESSING_START(mA, mB, mE, mRoundAddition)
+#define ROUND_16_19(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, VF_00_19(mB, mC, mD), K_00_19, i)
+#define ROUND_20_39(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, VF_REST(mB, mC, mD), K_20_39, i)
+#define ROUND_40_59(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, VF_40_59(mB, mC, mD), K_40_59, i)
+#define ROUND_60_79(mA, mB, mC, mD, mE, i) \
+    ROUND_PROCESSING_END(mA, mB, mE, VF_REST(mB, mC, mD), K_60_79, i)
+// macros for rounds whose word block is always zero
+#define ROUND_16_19_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_00_19(mB, mC, mD), K_00_19)
+#define ROUND_20_39_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_REST(mB, mC, mD), K_20_39)
+#define ROUND_40_59_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_40_59(mB, mC, mD), K_40_59)
+#define ROUND_60_79_ZERO(mA, mB, mC, mD, mE) \
+    ROUND_PROCESSING_ZERO(mA, mB, mE, VF_REST(mB, mC, mD), K_60_79)
+// macro for rewinding rounds 79 - 76 of a single target (see initTargetSet)
+#define REWIND_ROUNDS_79_76(m74, m73, m72, m71)                                      \
+    m74 = SUB(p_vecRewind[0], p_blocks[79]);                                         \
+    m73 = SUB(SUB(p_vecRewind[1], XOR(p_vecRewind[2], m74)), p_blocks[78]);          \
+    m72 = SUB(SUB(p_vecRewind[3], VF_REST(p_vecRewind[4], m74, m73)), p_blocks[77]); \
+    m71 = SUB(SUB(p_vecRewind[5], VF_REST(VEC_LEFT_ROTATE(m74, 2), m73, m72)), p_blocks[76]);
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+
+// function prototypes
+static int crackSliceLength1To3(struct crackJob         *p_job,
+                                const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength1To3(const __m128i *p_vecPrecomputedBlocks,
+                                                 __m128i       *p_w0,
+                                                 __m128i       *p_blocks);
+static inline void precomputeBlocks72To75Length1To3(const __m128i *p_vecPrecomputedBlocks,
+                                                    __m128i       *p_w0,
+                                                    __m128i       *p_blocks);
+static inline void precomputeBlocks76To79Length1To3(const __m128i *p_vecPrecomputedBlocks,
+                                                    __m128i       *p_w0,
+                                                    __m128i       *p_blocks);
+static int crackSliceLength4To7(struct crackJob         *p_job,
+                                const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength4To7(const __m128i *p_vecPrecomputedBlocks,
+                                                 __m128i       *p_w0,
+                                                 __m128i       *p_blocks);
+static inline void precomputeBlocks72To75Length4To7(const __m128i *p_vecPrecomputedBlocks,
+                                                    __m128i       *p_w0,
+                                                    __m128i       *p_blocks);
+static inline void precomputeBlocks76To79Length4To7(const __m128i *p_vecPrecomputedBlocks,
+                                                    __m128i       *p_w0,
+                                                    __m128i       *p_blocks);
+static int crackSliceLength8To11(struct crackJob         *p_job,
+                                 const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength8To11(const __m128i *p_vecPrecomputedBlocks,
+                                                  __m128i       *p_w0,
+                                                  __m128i       *p_blocks);
+static inline void precomputeBlocks72To75Length8To11(const __m128i *p_vecPrecomputedBlocks,
+                                                     __m128i       *p_w0,
+                                                     __m128i       *p_blocks);
+static inline void precomputeBlocks76To79Length8To11(const __m128i *p_vecPrecomputedBlocks,
+                                                     __m128i       *p_w0,
+                                                     __m128i       *p_blocks);
+static int crackSliceLength12(struct crackJob         *p_job,
+                              const struct sliceSetup *p_setup);
+static inline void precomputeInnerLoopLength12(const __m128i *p_vecPrecomputedBlocks,
+                                               __m128i       *p_w0,
+                                               __m128i       *p_blocks);
+static inline void precomputeBlocks72To75Length12(const __m128i *p_vecPrecomputedBlocks,
+                                                  __m128i       *p_w0,
+                                                  __m128i       *p_blocks);
+static inline void precomputeBlocks76To79Length12(const __m128i *p_vecPrecomputedBlocks,
+                                                  __m128i       *p_w0,
+                                                  __m128i       *p_blocks);
+
+/**
+ * Function: crackSliceGenericSse2
+ */
+int crackSliceGenericSse2
+(
+    struct crackJob *p_job,
+    uint64_t        slice
+)
+{
+    struct sliceSetup setup;
+    // outer loop bytes, padding and initial step constants of the slice
+    CYCLES_START(outerStart);
+    setupSlice(p_job->p_layout,
+               slice,
+               &setup);
+    CYCLES_STOP(outerCycles, outerStart);
+    COUNT(outerPrecomputes, 1);
+    // every preimage length has its own kernel (lengths with the same schedule share one)
+    switch(setup.length)
+    {
+        case 1:
+        case 2:
+        case 3:
+            return crackSliceLength1To3(p_job,
+                                        &setup);
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+            return crackSliceLength4To7(p_job,
+                                        &setup);
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+            return crackSliceLength8To11(p_job,
+                                         &setup);
+        default:
+            return crackSliceLength12(p_job,
+                                      &setup);
+    }
+}
+/**
+ * Function: crackSliceLength1To3
+ */
+static int crackSliceLength1To3
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    int                    index,
+                           mask;
+    __m128i                a, b, c, d, e, vecTemp;
+    // rewound results of rounds 74 - 71 (single target)
+    __m128i                r74, r73, r72, r71,
+                           p_vecRewind[6];
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_tempSave[4],
+                           p_stateSave[5][4],
+                           p_state[5];
+    __m128i                p_vecPrecomputedBlocks[80],
+                           p_w0[23],
+                           p_blocks[80];
+    const struct targetSet *p_targets = p_job->p_targets;
+    // constant vectors
+    const __m128i   K_00_19 = SET1INT(0x5A827999),
+                    K_20_39 = SET1INT(0x6ED9EBA1),
+                    K_40_59 = SET1INT(0x8F1BBCDC),
+                    K_60_79 = SET1INT(0xCA62C1D6);
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const __m128i   ROUND_CONSTANT_00 = SET1INT(UINT32_C(0x9FB498B3)),
+                    ROUND_CONSTANT_01 = SET1INT(UINT32_C(0x66B0CD0D)),
+                    ROUND_CONSTANT_02 = SET1INT(UINT32_C(0xF33D5697)),
+                    ROUND_CONSTANT_03 = SET1INT(UINT32_C(0xD675E47B)),
+                    ROUND_CONSTANT_04 = SET1INT(UINT32_C(0xB453C259)),
+                    ROUND_CONSTANT_15 = SET1INT(p_setup->p_roundConstants[5]);
+    // precomputed word blocks are the same in all lanes
+    for(index = 16; index < 80; index++)
+        p_vecPrecomputedBlocks[index] = SET1INT(p_setup->p_precomputedBlocks[index]);
+    // only used if there is a single target (see initTargetSet)
+    for(index = 0; index < 6; index++)
+        p_vecRewind[index] = SET1INT(p_targets->p_rewind[index]);
+    // inner loop through all combinations of input bytes 0 - 3, four low table entries at once
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low += 4)
+        {
+            // generate (missing) first word blocks based on new input
+            p_blocks[0] = OR(SET1INT(p_setup->p_innerHigh[high]),
+                             LOAD(p_setup->p_innerLow + low));
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength1To3(p_vecPrecomputedBlocks,
+                                          p_w0,
+                                          p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 4);
+            // initialize state variables with constants
+            a = SET1INT(SHA1_IV_0);
+            b = SET1INT(SHA1_IV_1);
+            c = SET1INT(SHA1_IV_2);
+            d = SET1INT(SHA1_IV_3);
+            e = SET1INT(SHA1_IV_4);
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19_ZERO(d, e, a, b, c)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39_ZERO(a, b, c, d, e)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39_ZERO(e, a, b, c, d)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length1To3(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                mask = MOVEMASK(CMPEQ(VEC_LEFT_ROTATE(d, 30), r71));
+                if(LIKELY(mask == 0))
+                    continue;
+                COUNT(earlyExitPassed, __builtin_popcount(mask));
+                precomputeBlocks72To75Length1To3(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length1To3(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                vecTemp = ADD(VEC_LEFT_ROTATE(a, 30), p_blocks[79]);
+                STORE(p_tempSave, vecTemp);
+                mask = 0;
+                for(index = 0; index < 4; index++)
+                    if(TARGET_SET_MAY_CONTAIN(p_targets, p_tempSave[index])
+                       && targetSetContainsKey(p_targets, p_tempSave[index]))
+                        mask |= 1 << index;
+                if(LIKELY(mask == 0))
+                    continue;
+                precomputeBlocks76To79Length1To3(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            STORE(p_stateSave[0], a);
+            STORE(p_stateSave[1], b);
+            STORE(p_stateSave[2], c);
+            STORE(p_stateSave[3], d);
+            STORE(p_stateSave[4], e);
+            // compare the full state of every remaining lane against the targets
+            for(index = 0; index < 4; index++)
+            {
+                // lanes past the end of the low table repeat its last entry
+                if(!(mask & (1 << index)) || low + index >= p_setup->numberOfInnerLow)
+                    continue;
+                p_state[0] = p_stateSave[0][index];
+                p_state[1] = p_stateSave[1][index];
+                p_state[2] = p_stateSave[2][index];
+                p_state[3] = p_stateSave[3][index];
+                p_state[4] = p_stateSave[4][index];
+                getSlicePreimage(p_setup,
+                                 (uint64_t) high * p_setup->numberOfInnerLow + low + index,
+                                 p_preimage);
+                reportCandidate(p_job,
+                                p_state,
+                                p_preimage,
+                                p_setup->length);
+            }
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: crackSliceLength4To7
+ */
+static int crackSliceLength4To7
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    int                    index,
+                           mask;
+    __m128i                a, b, c, d, e, vecTemp;
+    // rewound results of rounds 74 - 71 (single target)
+    __m128i                r74, r73, r72, r71,
+                           p_vecRewind[6];
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_tempSave[4],
+                           p_stateSave[5][4],
+                           p_state[5];
+    __m128i                p_vecPrecomputedBlocks[80],
+                           p_w0[23],
+                           p_blocks[80];
+    const struct targetSet *p_targets = p_job->p_targets;
+    // constant vectors
+    const __m128i   K_00_19 = SET1INT(0x5A827999),
+                    K_20_39 = SET1INT(0x6ED9EBA1),
+                    K_40_59 = SET1INT(0x8F1BBCDC),
+                    K_60_79 = SET1INT(0xCA62C1D6);
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const __m128i   ROUND_CONSTANT_00 = SET1INT(UINT32_C(0x9FB498B3)),
+                    ROUND_CONSTANT_01 = SET1INT(p_setup->p_roundConstants[1]),
+                    ROUND_CONSTANT_02 = SET1INT(UINT32_C(0xF33D5697)),
+                    ROUND_CONSTANT_03 = SET1INT(UINT32_C(0xD675E47B)),
+                    ROUND_CONSTANT_04 = SET1INT(UINT32_C(0xB453C259)),
+                    ROUND_CONSTANT_15 = SET1INT(p_setup->p_roundConstants[5]);
+    // precomputed word blocks are the same in all lanes
+    for(index = 16; index < 80; index++)
+        p_vecPrecomputedBlocks[index] = SET1INT(p_setup->p_precomputedBlocks[index]);
+    // only used if there is a single target (see initTargetSet)
+    for(index = 0; index < 6; index++)
+        p_vecRewind[index] = SET1INT(p_targets->p_rewind[index]);
+    // inner loop through all combinations of input bytes 0 - 3, four low table entries at once
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low += 4)
+        {
+            // generate (missing) first word blocks based on new input
+            p_blocks[0] = OR(SET1INT(p_setup->p_innerHigh[high]),
+                             LOAD(p_setup->p_innerLow + low));
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength4To7(p_vecPrecomputedBlocks,
+                                          p_w0,
+                                          p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 4);
+            // initialize state variables with constants
+            a = SET1INT(SHA1_IV_0);
+            b = SET1INT(SHA1_IV_1);
+            c = SET1INT(SHA1_IV_2);
+            d = SET1INT(SHA1_IV_3);
+            e = SET1INT(SHA1_IV_4);
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19(d, e, a, b, c, 17)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39(a, b, c, d, e, 20)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39(e, a, b, c, d, 26)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length4To7(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                mask = MOVEMASK(CMPEQ(VEC_LEFT_ROTATE(d, 30), r71));
+                if(LIKELY(mask == 0))
+                    continue;
+                COUNT(earlyExitPassed, __builtin_popcount(mask));
+                precomputeBlocks72To75Length4To7(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length4To7(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+                p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                vecTemp = ADD(VEC_LEFT_ROTATE(a, 30), p_blocks[79]);
+                STORE(p_tempSave, vecTemp);
+                mask = 0;
+                for(index = 0; index < 4; index++)
+                    if(TARGET_SET_MAY_CONTAIN(p_targets, p_tempSave[index])
+                       && targetSetContainsKey(p_targets, p_tempSave[index]))
+                        mask |= 1 << index;
+                if(LIKELY(mask == 0))
+                    continue;
+                precomputeBlocks76To79Length4To7(p_vecPrecomputedBlocks,
+                                                 p_w0,
+                                                 p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            STORE(p_stateSave[0], a);
+            STORE(p_stateSave[1], b);
+            STORE(p_stateSave[2], c);
+            STORE(p_stateSave[3], d);
+            STORE(p_stateSave[4], e);
+            // compare the full state of every remaining lane against the targets
+            for(index = 0; index < 4; index++)
+            {
+                // lanes past the end of the low table repeat its last entry
+                if(!(mask & (1 << index)) || low + index >= p_setup->numberOfInnerLow)
+                    continue;
+                p_state[0] = p_stateSave[0][index];
+                p_state[1] = p_stateSave[1][index];
+                p_state[2] = p_stateSave[2][index];
+                p_state[3] = p_stateSave[3][index];
+                p_state[4] = p_stateSave[4][index];
+                getSlicePreimage(p_setup,
+                                 (uint64_t) high * p_setup->numberOfInnerLow + low + index,
+                                 p_preimage);
+                reportCandidate(p_job,
+                                p_state,
+                                p_preimage,
+                                p_setup->length);
+            }
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: crackSliceLength8To11
+ */
+static int crackSliceLength8To11
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    int                    index,
+                           mask;
+    __m128i                a, b, c, d, e, vecTemp;
+    // rewound results of rounds 74 - 71 (single target)
+    __m128i                r74, r73, r72, r71,
+                           p_vecRewind[6];
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_tempSave[4],
+                           p_stateSave[5][4],
+                           p_state[5];
+    __m128i                p_vecPrecomputedBlocks[80],
+                           p_w0[23],
+                           p_blocks[80];
+    const struct targetSet *p_targets = p_job->p_targets;
+    // constant vectors
+    const __m128i   K_00_19 = SET1INT(0x5A827999),
+                    K_20_39 = SET1INT(0x6ED9EBA1),
+                    K_40_59 = SET1INT(0x8F1BBCDC),
+                    K_60_79 = SET1INT(0xCA62C1D6);
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const __m128i   ROUND_CONSTANT_00 = SET1INT(UINT32_C(0x9FB498B3)),
+                    ROUND_CONSTANT_01 = SET1INT(p_setup->p_roundConstants[1]),
+                    ROUND_CONSTANT_02 = SET1INT(p_setup->p_roundConstants[2]),
+                    ROUND_CONSTANT_03 = SET1INT(UINT32_C(0xD675E47B)),
+                    ROUND_CONSTANT_04 = SET1INT(UINT32_C(0xB453C259)),
+                    ROUND_CONSTANT_15 = SET1INT(p_setup->p_roundConstants[5]);
+    // precomputed word blocks are the same in all lanes
+    for(index = 16; index < 80; index++)
+        p_vecPrecomputedBlocks[index] = SET1INT(p_setup->p_precomputedBlocks[index]);
+    // only used if there is a single target (see initTargetSet)
+    for(index = 0; index < 6; index++)
+        p_vecRewind[index] = SET1INT(p_targets->p_rewind[index]);
+    // inner loop through all combinations of input bytes 0 - 3, four low table entries at once
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low += 4)
+        {
+            // generate (missing) first word blocks based on new input
+            p_blocks[0] = OR(SET1INT(p_setup->p_innerHigh[high]),
+                             LOAD(p_setup->p_innerLow + low));
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength8To11(p_vecPrecomputedBlocks,
+                                           p_w0,
+                                           p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 4);
+            // initialize state variables with constants
+            a = SET1INT(SHA1_IV_0);
+            b = SET1INT(SHA1_IV_1);
+            c = SET1INT(SHA1_IV_2);
+            d = SET1INT(SHA1_IV_3);
+            e = SET1INT(SHA1_IV_4);
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19(d, e, a, b, c, 17)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39(a, b, c, d, e, 20)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39(e, a, b, c, d, 26)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length8To11(p_vecPrecomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                mask = MOVEMASK(CMPEQ(VEC_LEFT_ROTATE(d, 30), r71));
+                if(LIKELY(mask == 0))
+                    continue;
+                COUNT(earlyExitPassed, __builtin_popcount(mask));
+                precomputeBlocks72To75Length8To11(p_vecPrecomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length8To11(p_vecPrecomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+                p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                vecTemp = ADD(VEC_LEFT_ROTATE(a, 30), p_blocks[79]);
+                STORE(p_tempSave, vecTemp);
+                mask = 0;
+                for(index = 0; index < 4; index++)
+                    if(TARGET_SET_MAY_CONTAIN(p_targets, p_tempSave[index])
+                       && targetSetContainsKey(p_targets, p_tempSave[index]))
+                        mask |= 1 << index;
+                if(LIKELY(mask == 0))
+                    continue;
+                precomputeBlocks76To79Length8To11(p_vecPrecomputedBlocks,
+                                                  p_w0,
+                                                  p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            STORE(p_stateSave[0], a);
+            STORE(p_stateSave[1], b);
+            STORE(p_stateSave[2], c);
+            STORE(p_stateSave[3], d);
+            STORE(p_stateSave[4], e);
+            // compare the full state of every remaining lane against the targets
+            for(index = 0; index < 4; index++)
+            {
+                // lanes past the end of the low table repeat its last entry
+                if(!(mask & (1 << index)) || low + index >= p_setup->numberOfInnerLow)
+                    continue;
+                p_state[0] = p_stateSave[0][index];
+                p_state[1] = p_stateSave[1][index];
+                p_state[2] = p_stateSave[2][index];
+                p_state[3] = p_stateSave[3][index];
+                p_state[4] = p_stateSave[4][index];
+                getSlicePreimage(p_setup,
+                                 (uint64_t) high * p_setup->numberOfInnerLow + low + index,
+                                 p_preimage);
+                reportCandidate(p_job,
+                                p_state,
+                                p_preimage,
+                                p_setup->length);
+            }
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: crackSliceLength12
+ */
+static int crackSliceLength12
+(
+    struct crackJob         *p_job,
+    const struct sliceSetup *p_setup
+)
+{
+    int                    index,
+                           mask;
+    __m128i                a, b, c, d, e, vecTemp;
+    // rewound results of rounds 74 - 71 (single target)
+    __m128i                r74, r73, r72, r71,
+                           p_vecRewind[6];
+    char                   p_preimage[CRACK_MAX_PREIMAGE_LENGTH];
+    uint32_t               p_tempSave[4],
+                           p_stateSave[5][4],
+                           p_state[5];
+    __m128i                p_vecPrecomputedBlocks[80],
+                           p_w0[23],
+                           p_blocks[80];
+    const struct targetSet *p_targets = p_job->p_targets;
+    // constant vectors
+    const __m128i   K_00_19 = SET1INT(0x5A827999),
+                    K_20_39 = SET1INT(0x6ED9EBA1),
+                    K_40_59 = SET1INT(0x8F1BBCDC),
+                    K_60_79 = SET1INT(0xCA62C1D6);
+    // initial step constants, the ones without word blocks of the slice are the same for all slices
+    const __m128i   ROUND_CONSTANT_00 = SET1INT(UINT32_C(0x9FB498B3)),
+                    ROUND_CONSTANT_01 = SET1INT(p_setup->p_roundConstants[1]),
+                    ROUND_CONSTANT_02 = SET1INT(p_setup->p_roundConstants[2]),
+                    ROUND_CONSTANT_03 = SET1INT(p_setup->p_roundConstants[3]),
+                    ROUND_CONSTANT_04 = SET1INT(UINT32_C(0xB453C259)),
+                    ROUND_CONSTANT_15 = SET1INT(p_setup->p_roundConstants[5]);
+    // precomputed word blocks are the same in all lanes
+    for(index = 16; index < 80; index++)
+        p_vecPrecomputedBlocks[index] = SET1INT(p_setup->p_precomputedBlocks[index]);
+    // only used if there is a single target (see initTargetSet)
+    for(index = 0; index < 6; index++)
+        p_vecRewind[index] = SET1INT(p_targets->p_rewind[index]);
+    // inner loop through all combinations of input bytes 0 - 3, four low table entries at once
+    for (uint32_t high = 0; high < p_setup->numberOfInnerHigh; high++)
+        for (uint32_t low = 0; low < p_setup->numberOfInnerLow; low += 4)
+        {
+            // generate (missing) first word blocks based on new input
+            p_blocks[0] = OR(SET1INT(p_setup->p_innerHigh[high]),
+                             LOAD(p_setup->p_innerLow + low));
+            // precompute word blocks for inner loop
+            CYCLES_START(innerStart);
+            precomputeInnerLoopLength12(p_vecPrecomputedBlocks,
+                                        p_w0,
+                                        p_blocks);
+            CYCLES_STOP(innerCycles, innerStart);
+            COUNT(innerPrecomputes, 1);
+            COUNT(candidates, 4);
+            // initialize state variables with constants
+            a = SET1INT(SHA1_IV_0);
+            b = SET1INT(SHA1_IV_1);
+            c = SET1INT(SHA1_IV_2);
+            d = SET1INT(SHA1_IV_3);
+            e = SET1INT(SHA1_IV_4);
+            /*************** UNROLLED ROUND FUNCTION LOOPS ****************/
+            // round 00
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_00)
+            // round 01
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_01(e))
+            // round 02
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_02(d, e, a, b))
+            // round 03
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_03(c, d, e, a))
+            // round 04
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_04(b, c, d, e))
+            // rounds 05 - 14
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_05_14(a, b, c, d, e))
+            ROUND_00_15(e, a, b, c, d, ROUND_ADDITION_05_14(e, a, b, c, d))
+            ROUND_00_15(d, e, a, b, c, ROUND_ADDITION_05_14(d, e, a, b, c))
+            ROUND_00_15(c, d, e, a, b, ROUND_ADDITION_05_14(c, d, e, a, b))
+            ROUND_00_15(b, c, d, e, a, ROUND_ADDITION_05_14(b, c, d, e, a))
+            // round 15
+            ROUND_00_15(a, b, c, d, e, ROUND_ADDITION_15(a, b, c, d, e))
+            // rounds 16 - 19
+            ROUND_16_19(e, a, b, c, d, 16)
+            ROUND_16_19(d, e, a, b, c, 17)
+            ROUND_16_19(c, d, e, a, b, 18)
+            ROUND_16_19(b, c, d, e, a, 19)
+            // rounds 20 - 39
+            ROUND_20_39(a, b, c, d, e, 20)
+            ROUND_20_39(e, a, b, c, d, 21)
+            ROUND_20_39(d, e, a, b, c, 22)
+            ROUND_20_39(c, d, e, a, b, 23)
+            ROUND_20_39(b, c, d, e, a, 24)
+            ROUND_20_39(a, b, c, d, e, 25)
+            ROUND_20_39(e, a, b, c, d, 26)
+            ROUND_20_39(d, e, a, b, c, 27)
+            ROUND_20_39(c, d, e, a, b, 28)
+            ROUND_20_39(b, c, d, e, a, 29)
+            ROUND_20_39(a, b, c, d, e, 30)
+            ROUND_20_39(e, a, b, c, d, 31)
+            ROUND_20_39(d, e, a, b, c, 32)
+            ROUND_20_39(c, d, e, a, b, 33)
+            ROUND_20_39(b, c, d, e, a, 34)
+            ROUND_20_39(a, b, c, d, e, 35)
+            ROUND_20_39(e, a, b, c, d, 36)
+            ROUND_20_39(d, e, a, b, c, 37)
+            ROUND_20_39(c, d, e, a, b, 38)
+            ROUND_20_39(b, c, d, e, a, 39)
+            // rounds 40 - 59
+            ROUND_40_59(a, b, c, d, e, 40)
+            ROUND_40_59(e, a, b, c, d, 41)
+            ROUND_40_59(d, e, a, b, c, 42)
+            ROUND_40_59(c, d, e, a, b, 43)
+            ROUND_40_59(b, c, d, e, a, 44)
+            ROUND_40_59(a, b, c, d, e, 45)
+            ROUND_40_59(e, a, b, c, d, 46)
+            ROUND_40_59(d, e, a, b, c, 47)
+            ROUND_40_59(c, d, e, a, b, 48)
+            ROUND_40_59(b, c, d, e, a, 49)
+            ROUND_40_59(a, b, c, d, e, 50)
+            ROUND_40_59(e, a, b, c, d, 51)
+            ROUND_40_59(d, e, a, b, c, 52)
+            ROUND_40_59(c, d, e, a, b, 53)
+            ROUND_40_59(b, c, d, e, a, 54)
+            ROUND_40_59(a, b, c, d, e, 55)
+            ROUND_40_59(e, a, b, c, d, 56)
+            ROUND_40_59(d, e, a, b, c, 57)
+            ROUND_40_59(c, d, e, a, b, 58)
+            ROUND_40_59(b, c, d, e, a, 59)
+            // rounds 60 - 71
+            ROUND_60_79(a, b, c, d, e, 60)
+            ROUND_60_79(e, a, b, c, d, 61)
+            ROUND_60_79(d, e, a, b, c, 62)
+            ROUND_60_79(c, d, e, a, b, 63)
+            ROUND_60_79(b, c, d, e, a, 64)
+            ROUND_60_79(a, b, c, d, e, 65)
+            ROUND_60_79(e, a, b, c, d, 66)
+            ROUND_60_79(d, e, a, b, c, 67)
+            ROUND_60_79(c, d, e, a, b, 68)
+            ROUND_60_79(b, c, d, e, a, 69)
+            ROUND_60_79(a, b, c, d, e, 70)
+            ROUND_60_79(e, a, b, c, d, 71)
+            /**************************************************************/
+            /***************** EARLY EXIT OPTIMIZATION *******************/
+            /*
+             *  For a single target, rounds 79 - 76 are rewound from the target, which
+             *  only needs word blocks 76 - 79, and compared against the result of round
+             *  71. Otherwise rounds 72 - 74 run and the result of round 74 plus word
+             *  block 79 (the target with round 79 undone) probes the bitmap filter
+             *  first and, only if that passes, the sorted keys to rule out false positives.
+             */
+            if(p_targets->numberOfTargets == 1)
+            {
+                precomputeBlocks76To79Length12(p_vecPrecomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                REWIND_ROUNDS_79_76(r74, r73, r72, r71)
+                mask = MOVEMASK(CMPEQ(VEC_LEFT_ROTATE(d, 30), r71));
+                if(LIKELY(mask == 0))
+                    continue;
+                COUNT(earlyExitPassed, __builtin_popcount(mask));
+                precomputeBlocks72To75Length12(p_vecPrecomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+            }
+            else
+            {
+                precomputeBlocks72To75Length12(p_vecPrecomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+                p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+                ROUND_60_79(d, e, a, b, c, 72)
+                ROUND_60_79(c, d, e, a, b, 73)
+                ROUND_60_79(b, c, d, e, a, 74)
+                vecTemp = ADD(VEC_LEFT_ROTATE(a, 30), p_blocks[79]);
+                STORE(p_tempSave, vecTemp);
+                mask = 0;
+                for(index = 0; index < 4; index++)
+                    if(TARGET_SET_MAY_CONTAIN(p_targets, p_tempSave[index])
+                       && targetSetContainsKey(p_targets, p_tempSave[index]))
+                        mask |= 1 << index;
+                if(LIKELY(mask == 0))
+                    continue;
+                precomputeBlocks76To79Length12(p_vecPrecomputedBlocks,
+                                               p_w0,
+                                               p_blocks);
+            }
+            // rounds 75 - 79
+            ROUND_60_79(a, b, c, d, e, 75)
+            ROUND_60_79(e, a, b, c, d, 76)
+            ROUND_60_79(d, e, a, b, c, 77)
+            ROUND_60_79(c, d, e, a, b, 78)
+            ROUND_60_79(b, c, d, e, a, 79)
+            /**************************************************************/
+            STORE(p_stateSave[0], a);
+            STORE(p_stateSave[1], b);
+            STORE(p_stateSave[2], c);
+            STORE(p_stateSave[3], d);
+            STORE(p_stateSave[4], e);
+            // compare the full state of every remaining lane against the targets
+            for(index = 0; index < 4; index++)
+            {
+                // lanes past the end of the low table repeat its last entry
+                if(!(mask & (1 << index)) || low + index >= p_setup->numberOfInnerLow)
+                    continue;
+                p_state[0] = p_stateSave[0][index];
+                p_state[1] = p_stateSave[1][index];
+                p_state[2] = p_stateSave[2][index];
+                p_state[3] = p_stateSave[3][index];
+                p_state[4] = p_stateSave[4][index];
+                getSlicePreimage(p_setup,
+                                 (uint64_t) high * p_setup->numberOfInnerLow + low + index,
+                                 p_preimage);
+                reportCandidate(p_job,
+                                p_state,
+                                p_preimage,
+                                p_setup->length);
+            }
+            // stop early once every target has been found
+            if(atomic_load(&p_job->numberOfFound) == p_targets->numberOfTargets)
+                return 0;
+        }
+    // if we end up here, targets are left after this slice
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: precomputeInnerLoopLength1To3
+ */
+static inline void precomputeInnerLoopLength1To3
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = VEC_LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = VEC_LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = VEC_LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = VEC_LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = VEC_LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = VEC_LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = VEC_LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = VEC_LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = VEC_LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = VEC_LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = VEC_LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = VEC_LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = VEC_LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = VEC_LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = VEC_LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = VEC_LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = VEC_LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = VEC_LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = VEC_LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = VEC_LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = VEC_LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = VEC_LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = p_w0[1];
+    p_blocks[18] = p_vecPrecomputedBlocks[18];
+    p_blocks[19] = p_w0[2];
+    p_blocks[21] = p_vecPrecomputedBlocks[21];
+    p_blocks[22] = p_w0[3];
+    p_blocks[23] = p_vecPrecomputedBlocks[23];
+    p_blocks[24] = XOR(p_vecPrecomputedBlocks[24], p_w0[2]);
+    p_blocks[25] = p_w0[4];
+    p_blocks[27] = p_vecPrecomputedBlocks[27];
+    p_blocks[28] = p_w0[5];
+    p_blocks[29] = p_vecPrecomputedBlocks[29];
+    p_blocks[30] = XOR(XOR(p_vecPrecomputedBlocks[30], p_w0[2]), p_w0[4]);
+    p_blocks[31] = XOR(p_vecPrecomputedBlocks[31], p_w0[6]);
+    p_blocks[32] = XOR(p_w0[2], p_w0[3]);
+    p_blocks[33] = p_vecPrecomputedBlocks[33];
+    p_blocks[34] = XOR(p_vecPrecomputedBlocks[34], p_w0[7]);
+    p_blocks[35] = XOR(p_vecPrecomputedBlocks[35], p_w0[4]);
+    p_blocks[36] = XOR(XOR(p_vecPrecomputedBlocks[36], p_w0[4]), p_w0[6]);
+    p_blocks[37] = XOR(p_vecPrecomputedBlocks[37], p_w0[8]);
+    p_blocks[38] = p_w0[4];
+    p_blocks[39] = p_vecPrecomputedBlocks[39];
+    p_blocks[40] = XOR(p_w0[4], p_w0[9]);
+    p_blocks[41] = p_vecPrecomputedBlocks[41];
+    p_blocks[42] = XOR(XOR(p_vecPrecomputedBlocks[42], p_w0[6]), p_w0[8]);
+    p_blocks[43] = XOR(p_vecPrecomputedBlocks[43], p_w0[10]);
+    p_blocks[44] = XOR(XOR(p_w0[3], p_w0[6]), p_w0[7]);
+    p_blocks[45] = p_vecPrecomputedBlocks[45];
+    p_blocks[46] = XOR(XOR(p_vecPrecomputedBlocks[46], p_w0[4]), p_w0[11]);
+    p_blocks[47] = XOR(XOR(p_vecPrecomputedBlocks[47], p_w0[4]), p_w0[8]);
+    p_blocks[48] = XOR(XOR(XOR(p_vecPrecomputedBlocks[48], p_w0[3]), XOR(p_w0[4], p_w0[5])), XOR(p_w0[8], p_w0[10]));
+    p_blocks[49] = XOR(p_vecPrecomputedBlocks[49], p_w0[12]);
+    p_blocks[50] = XOR(p_vecPrecomputedBlocks[50], p_w0[8]);
+    p_blocks[51] = XOR(XOR(p_vecPrecomputedBlocks[51], p_w0[4]), p_w0[6]);
+    p_blocks[52] = XOR(XOR(p_w0[4], p_w0[8]), p_w0[13]);
+    p_blocks[53] = p_vecPrecomputedBlocks[53];
+    p_blocks[54] = XOR(XOR(p_vecPrecomputedBlocks[54], p_w0[7]), XOR(p_w0[10], p_w0[12]));
+    p_blocks[55] = XOR(p_vecPrecomputedBlocks[55], p_w0[14]);
+    p_blocks[56] = XOR(XOR(XOR(p_vecPrecomputedBlocks[56], p_w0[4]), XOR(p_w0[6], p_w0[7])), XOR(p_w0[10], p_w0[11]));
+    p_blocks[57] = XOR(p_vecPrecomputedBlocks[57], p_w0[8]);
+    p_blocks[58] = XOR(XOR(p_vecPrecomputedBlocks[58], p_w0[4]), XOR(p_w0[8], p_w0[15]));
+    p_blocks[59] = XOR(XOR(p_vecPrecomputedBlocks[59], p_w0[8]), p_w0[12]);
+    p_blocks[60] = XOR(XOR(XOR(p_vecPrecomputedBlocks[60], p_w0[4]), XOR(p_w0[7], p_w0[8])), XOR(p_w0[12], p_w0[14]));
+    p_blocks[61] = XOR(p_vecPrecomputedBlocks[61], p_w0[16]);
+    p_blocks[62] = XOR(XOR(p_vecPrecomputedBlocks[62], p_w0[4]), XOR(XOR(p_w0[6], p_w0[8]), p_w0[12]));
+    p_blocks[63] = XOR(p_vecPrecomputedBlocks[63], p_w0[8]);
+    p_blocks[64] = XOR(XOR(XOR(p_w0[4], p_w0[6]), XOR(p_w0[7], p_w0[8])), XOR(p_w0[12], p_w0[17]));
+    p_blocks[65] = p_vecPrecomputedBlocks[65];
+    p_blocks[66] = XOR(XOR(p_vecPrecomputedBlocks[66], p_w0[14]), p_w0[16]);
+    p_blocks[67] = XOR(XOR(p_vecPrecomputedBlocks[67], p_w0[8]), p_w0[18]);
+    p_blocks[68] = XOR(XOR(p_w0[11], p_w0[14]), p_w0[15]);
+    p_blocks[69] = p_vecPrecomputedBlocks[69];
+    p_blocks[70] = XOR(XOR(p_vecPrecomputedBlocks[70], p_w0[12]), p_w0[19]);
+    p_blocks[71] = XOR(XOR(p_vecPrecomputedBlocks[71], p_w0[12]), p_w0[16]);
+}
+/**
+ * Function: precomputeBlocks72To75Length1To3
+ */
+static inline void precomputeBlocks72To75Length1To3
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength1To3)
+    p_blocks[72] = XOR(XOR(XOR(p_vecPrecomputedBlocks[72], p_w0[5]), XOR(p_w0[11], p_w0[12])), XOR(XOR(p_w0[13], p_w0[16]), p_w0[18]));
+    p_blocks[73] = XOR(p_vecPrecomputedBlocks[73], p_w0[20]);
+    p_blocks[74] = XOR(XOR(p_vecPrecomputedBlocks[74], p_w0[8]), p_w0[16]);
+    p_blocks[75] = XOR(XOR(p_vecPrecomputedBlocks[75], p_w0[6]), XOR(p_w0[12], p_w0[14]));
+}
+/**
+ * Function: precomputeBlocks76To79Length1To3
+ */
+static inline void precomputeBlocks76To79Length1To3
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength1To3)
+    p_blocks[76] = XOR(XOR(p_w0[7], p_w0[8]), XOR(XOR(p_w0[12], p_w0[16]), p_w0[21]));
+    p_blocks[77] = p_vecPrecomputedBlocks[77];
+    p_blocks[78] = XOR(XOR(XOR(p_vecPrecomputedBlocks[78], p_w0[7]), XOR(p_w0[8], p_w0[15])), XOR(p_w0[18], p_w0[20]));
+    p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+}
+/**
+ * Function: precomputeInnerLoopLength4To7
+ */
+static inline void precomputeInnerLoopLength4To7
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = VEC_LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = VEC_LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = VEC_LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = VEC_LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = VEC_LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = VEC_LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = VEC_LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = VEC_LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = VEC_LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = VEC_LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = VEC_LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = VEC_LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = VEC_LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = VEC_LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = VEC_LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = VEC_LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = VEC_LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = VEC_LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = VEC_LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = VEC_LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = VEC_LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = VEC_LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = p_w0[1];
+    p_blocks[17] = p_vecPrecomputedBlocks[17];
+    p_blocks[18] = p_vecPrecomputedBlocks[18];
+    p_blocks[19] = p_w0[2];
+    p_blocks[20] = p_vecPrecomputedBlocks[20];
+    p_blocks[21] = p_vecPrecomputedBlocks[21];
+    p_blocks[22] = p_w0[3];
+    p_blocks[23] = p_vecPrecomputedBlocks[23];
+    p_blocks[24] = XOR(p_vecPrecomputedBlocks[24], p_w0[2]);
+    p_blocks[25] = XOR(p_vecPrecomputedBlocks[25], p_w0[4]);
+    p_blocks[26] = p_vecPrecomputedBlocks[26];
+    p_blocks[27] = p_vecPrecomputedBlocks[27];
+    p_blocks[28] = p_w0[5];
+    p_blocks[29] = p_vecPrecomputedBlocks[29];
+    p_blocks[30] = XOR(XOR(p_vecPrecomputedBlocks[30], p_w0[2]), p_w0[4]);
+    p_blocks[31] = XOR(p_vecPrecomputedBlocks[31], p_w0[6]);
+    p_blocks[32] = XOR(XOR(p_vecPrecomputedBlocks[32], p_w0[2]), p_w0[3]);
+    p_blocks[33] = p_vecPrecomputedBlocks[33];
+    p_blocks[34] = XOR(p_vecPrecomputedBlocks[34], p_w0[7]);
+    p_blocks[35] = XOR(p_vecPrecomputedBlocks[35], p_w0[4]);
+    p_blocks[36] = XOR(XOR(p_vecPrecomputedBlocks[36], p_w0[4]), p_w0[6]);
+    p_blocks[37] = XOR(p_vecPrecomputedBlocks[37], p_w0[8]);
+    p_blocks[38] = XOR(p_vecPrecomputedBlocks[38], p_w0[4]);
+    p_blocks[39] = p_vecPrecomputedBlocks[39];
+    p_blocks[40] = XOR(p_w0[4], p_w0[9]);
+    p_blocks[41] = p_vecPrecomputedBlocks[41];
+    p_blocks[42] = XOR(XOR(p_vecPrecomputedBlocks[42], p_w0[6]), p_w0[8]);
+    p_blocks[43] = XOR(p_vecPrecomputedBlocks[43], p_w0[10]);
+    p_blocks[44] = XOR(XOR(p_vecPrecomputedBlocks[44], p_w0[3]), XOR(p_w0[6], p_w0[7]));
+    p_blocks[45] = p_vecPrecomputedBlocks[45];
+    p_blocks[46] = XOR(XOR(p_vecPrecomputedBlocks[46], p_w0[4]), p_w0[11]);
+    p_blocks[47] = XOR(XOR(p_vecPrecomputedBlocks[47], p_w0[4]), p_w0[8]);
+    p_blocks[48] = XOR(XOR(XOR(p_vecPrecomputedBlocks[48], p_w0[3]), XOR(p_w0[4], p_w0[5])), XOR(p_w0[8], p_w0[10]));
+    p_blocks[49] = XOR(p_vecPrecomputedBlocks[49], p_w0[12]);
+    p_blocks[50] = XOR(p_vecPrecomputedBlocks[50], p_w0[8]);
+    p_blocks[51] = XOR(XOR(p_vecPrecomputedBlocks[51], p_w0[4]), p_w0[6]);
+    p_blocks[52] = XOR(XOR(p_vecPrecomputedBlocks[52], p_w0[4]), XOR(p_w0[8], p_w0[13]));
+    p_blocks[53] = p_vecPrecomputedBlocks[53];
+    p_blocks[54] = XOR(XOR(p_vecPrecomputedBlocks[54], p_w0[7]), XOR(p_w0[10], p_w0[12]));
+    p_blocks[55] = XOR(p_vecPrecomputedBlocks[55], p_w0[14]);
+    p_blocks[56] = XOR(XOR(XOR(p_vecPrecomputedBlocks[56], p_w0[4]), XOR(p_w0[6], p_w0[7])), XOR(p_w0[10], p_w0[11]));
+    p_blocks[57] = XOR(p_vecPrecomputedBlocks[57], p_w0[8]);
+    p_blocks[58] = XOR(XOR(p_vecPrecomputedBlocks[58], p_w0[4]), XOR(p_w0[8], p_w0[15]));
+    p_blocks[59] = XOR(XOR(p_vecPrecomputedBlocks[59], p_w0[8]), p_w0[12]);
+    p_blocks[60] = XOR(XOR(XOR(p_vecPrecomputedBlocks[60], p_w0[4]), XOR(p_w0[7], p_w0[8])), XOR(p_w0[12], p_w0[14]));
+    p_blocks[61] = XOR(p_vecPrecomputedBlocks[61], p_w0[16]);
+    p_blocks[62] = XOR(XOR(p_vecPrecomputedBlocks[62], p_w0[4]), XOR(XOR(p_w0[6], p_w0[8]), p_w0[12]));
+    p_blocks[63] = XOR(p_vecPrecomputedBlocks[63], p_w0[8]);
+    p_blocks[64] = XOR(XOR(XOR(p_vecPrecomputedBlocks[64], p_w0[4]), XOR(p_w0[6], p_w0[7])), XOR(XOR(p_w0[8], p_w0[12]), p_w0[17]));
+    p_blocks[65] = p_vecPrecomputedBlocks[65];
+    p_blocks[66] = XOR(XOR(p_vecPrecomputedBlocks[66], p_w0[14]), p_w0[16]);
+    p_blocks[67] = XOR(XOR(p_vecPrecomputedBlocks[67], p_w0[8]), p_w0[18]);
+    p_blocks[68] = XOR(XOR(p_vecPrecomputedBlocks[68], p_w0[11]), XOR(p_w0[14], p_w0[15]));
+    p_blocks[69] = p_vecPrecomputedBlocks[69];
+    p_blocks[70] = XOR(XOR(p_vecPrecomputedBlocks[70], p_w0[12]), p_w0[19]);
+    p_blocks[71] = XOR(XOR(p_vecPrecomputedBlocks[71], p_w0[12]), p_w0[16]);
+}
+/**
+ * Function: precomputeBlocks72To75Length4To7
+ */
+static inline void precomputeBlocks72To75Length4To7
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength4To7)
+    p_blocks[72] = XOR(XOR(XOR(p_vecPrecomputedBlocks[72], p_w0[5]), XOR(p_w0[11], p_w0[12])), XOR(XOR(p_w0[13], p_w0[16]), p_w0[18]));
+    p_blocks[73] = XOR(p_vecPrecomputedBlocks[73], p_w0[20]);
+    p_blocks[74] = XOR(XOR(p_vecPrecomputedBlocks[74], p_w0[8]), p_w0[16]);
+    p_blocks[75] = XOR(XOR(p_vecPrecomputedBlocks[75], p_w0[6]), XOR(p_w0[12], p_w0[14]));
+}
+/**
+ * Function: precomputeBlocks76To79Length4To7
+ */
+static inline void precomputeBlocks76To79Length4To7
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength4To7)
+    p_blocks[76] = XOR(XOR(XOR(p_vecPrecomputedBlocks[76], p_w0[7]), XOR(p_w0[8], p_w0[12])), XOR(p_w0[16], p_w0[21]));
+    p_blocks[77] = p_vecPrecomputedBlocks[77];
+    p_blocks[78] = XOR(XOR(XOR(p_vecPrecomputedBlocks[78], p_w0[7]), XOR(p_w0[8], p_w0[15])), XOR(p_w0[18], p_w0[20]));
+    p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+}
+/**
+ * Function: precomputeInnerLoopLength8To11
+ */
+static inline void precomputeInnerLoopLength8To11
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = VEC_LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = VEC_LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = VEC_LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = VEC_LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = VEC_LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = VEC_LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = VEC_LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = VEC_LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = VEC_LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = VEC_LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = VEC_LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = VEC_LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = VEC_LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = VEC_LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = VEC_LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = VEC_LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = VEC_LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = VEC_LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = VEC_LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = VEC_LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = VEC_LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = VEC_LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = XOR(p_vecPrecomputedBlocks[16], p_w0[1]);
+    p_blocks[17] = p_vecPrecomputedBlocks[17];
+    p_blocks[18] = p_vecPrecomputedBlocks[18];
+    p_blocks[19] = XOR(p_vecPrecomputedBlocks[19], p_w0[2]);
+    p_blocks[20] = p_vecPrecomputedBlocks[20];
+    p_blocks[21] = p_vecPrecomputedBlocks[21];
+    p_blocks[22] = XOR(p_vecPrecomputedBlocks[22], p_w0[3]);
+    p_blocks[23] = p_vecPrecomputedBlocks[23];
+    p_blocks[24] = XOR(p_vecPrecomputedBlocks[24], p_w0[2]);
+    p_blocks[25] = XOR(p_vecPrecomputedBlocks[25], p_w0[4]);
+    p_blocks[26] = p_vecPrecomputedBlocks[26];
+    p_blocks[27] = p_vecPrecomputedBlocks[27];
+    p_blocks[28] = XOR(p_vecPrecomputedBlocks[28], p_w0[5]);
+    p_blocks[29] = p_vecPrecomputedBlocks[29];
+    p_blocks[30] = XOR(XOR(p_vecPrecomputedBlocks[30], p_w0[2]), p_w0[4]);
+    p_blocks[31] = XOR(p_vecPrecomputedBlocks[31], p_w0[6]);
+    p_blocks[32] = XOR(XOR(p_vecPrecomputedBlocks[32], p_w0[2]), p_w0[3]);
+    p_blocks[33] = p_vecPrecomputedBlocks[33];
+    p_blocks[34] = XOR(p_vecPrecomputedBlocks[34], p_w0[7]);
+    p_blocks[35] = XOR(p_vecPrecomputedBlocks[35], p_w0[4]);
+    p_blocks[36] = XOR(XOR(p_vecPrecomputedBlocks[36], p_w0[4]), p_w0[6]);
+    p_blocks[37] = XOR(p_vecPrecomputedBlocks[37], p_w0[8]);
+    p_blocks[38] = XOR(p_vecPrecomputedBlocks[38], p_w0[4]);
+    p_blocks[39] = p_vecPrecomputedBlocks[39];
+    p_blocks[40] = XOR(XOR(p_vecPrecomputedBlocks[40], p_w0[4]), p_w0[9]);
+    p_blocks[41] = p_vecPrecomputedBlocks[41];
+    p_blocks[42] = XOR(XOR(p_vecPrecomputedBlocks[42], p_w0[6]), p_w0[8]);
+    p_blocks[43] = XOR(p_vecPrecomputedBlocks[43], p_w0[10]);
+    p_blocks[44] = XOR(XOR(p_vecPrecomputedBlocks[44], p_w0[3]), XOR(p_w0[6], p_w0[7]));
+    p_blocks[45] = p_vecPrecomputedBlocks[45];
+    p_blocks[46] = XOR(XOR(p_vecPrecomputedBlocks[46], p_w0[4]), p_w0[11]);
+    p_blocks[47] = XOR(XOR(p_vecPrecomputedBlocks[47], p_w0[4]), p_w0[8]);
+    p_blocks[48] = XOR(XOR(XOR(p_vecPrecomputedBlocks[48], p_w0[3]), XOR(p_w0[4], p_w0[5])), XOR(p_w0[8], p_w0[10]));
+    p_blocks[49] = XOR(p_vecPrecomputedBlocks[49], p_w0[12]);
+    p_blocks[50] = XOR(p_vecPrecomputedBlocks[50], p_w0[8]);
+    p_blocks[51] = XOR(XOR(p_vecPrecomputedBlocks[51], p_w0[4]), p_w0[6]);
+    p_blocks[52] = XOR(XOR(p_vecPrecomputedBlocks[52], p_w0[4]), XOR(p_w0[8], p_w0[13]));
+    p_blocks[53] = p_vecPrecomputedBlocks[53];
+    p_blocks[54] = XOR(XOR(p_vecPrecomputedBlocks[54], p_w0[7]), XOR(p_w0[10], p_w0[12]));
+    p_blocks[55] = XOR(p_vecPrecomputedBlocks[55], p_w0[14]);
+    p_blocks[56] = XOR(XOR(XOR(p_vecPrecomputedBlocks[56], p_w0[4]), XOR(p_w0[6], p_w0[7])), XOR(p_w0[10], p_w0[11]));
+    p_blocks[57] = XOR(p_vecPrecomputedBlocks[57], p_w0[8]);
+    p_blocks[58] = XOR(XOR(p_vecPrecomputedBlocks[58], p_w0[4]), XOR(p_w0[8], p_w0[15]));
+    p_blocks[59] = XOR(XOR(p_vecPrecomputedBlocks[59], p_w0[8]), p_w0[12]);
+    p_blocks[60] = XOR(XOR(XOR(p_vecPrecomputedBlocks[60], p_w0[4]), XOR(p_w0[7], p_w0[8])), XOR(p_w0[12], p_w0[14]));
+    p_blocks[61] = XOR(p_vecPrecomputedBlocks[61], p_w0[16]);
+    p_blocks[62] = XOR(XOR(p_vecPrecomputedBlocks[62], p_w0[4]), XOR(XOR(p_w0[6], p_w0[8]), p_w0[12]));
+    p_blocks[63] = XOR(p_vecPrecomputedBlocks[63], p_w0[8]);
+    p_blocks[64] = XOR(XOR(XOR(p_vecPrecomputedBlocks[64], p_w0[4]), XOR(p_w0[6], p_w0[7])), XOR(XOR(p_w0[8], p_w0[12]), p_w0[17]));
+    p_blocks[65] = p_vecPrecomputedBlocks[65];
+    p_blocks[66] = XOR(XOR(p_vecPrecomputedBlocks[66], p_w0[14]), p_w0[16]);
+    p_blocks[67] = XOR(XOR(p_vecPrecomputedBlocks[67], p_w0[8]), p_w0[18]);
+    p_blocks[68] = XOR(XOR(p_vecPrecomputedBlocks[68], p_w0[11]), XOR(p_w0[14], p_w0[15]));
+    p_blocks[69] = p_vecPrecomputedBlocks[69];
+    p_blocks[70] = XOR(XOR(p_vecPrecomputedBlocks[70], p_w0[12]), p_w0[19]);
+    p_blocks[71] = XOR(XOR(p_vecPrecomputedBlocks[71], p_w0[12]), p_w0[16]);
+}
+/**
+ * Function: precomputeBlocks72To75Length8To11
+ */
+static inline void precomputeBlocks72To75Length8To11
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength8To11)
+    p_blocks[72] = XOR(XOR(XOR(p_vecPrecomputedBlocks[72], p_w0[5]), XOR(p_w0[11], p_w0[12])), XOR(XOR(p_w0[13], p_w0[16]), p_w0[18]));
+    p_blocks[73] = XOR(p_vecPrecomputedBlocks[73], p_w0[20]);
+    p_blocks[74] = XOR(XOR(p_vecPrecomputedBlocks[74], p_w0[8]), p_w0[16]);
+    p_blocks[75] = XOR(XOR(p_vecPrecomputedBlocks[75], p_w0[6]), XOR(p_w0[12], p_w0[14]));
+}
+/**
+ * Function: precomputeBlocks76To79Length8To11
+ */
+static inline void precomputeBlocks76To79Length8To11
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength8To11)
+    p_blocks[76] = XOR(XOR(XOR(p_vecPrecomputedBlocks[76], p_w0[7]), XOR(p_w0[8], p_w0[12])), XOR(p_w0[16], p_w0[21]));
+    p_blocks[77] = p_vecPrecomputedBlocks[77];
+    p_blocks[78] = XOR(XOR(XOR(p_vecPrecomputedBlocks[78], p_w0[7]), XOR(p_w0[8], p_w0[15])), XOR(p_w0[18], p_w0[20]));
+    p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+}
+/**
+ * Function: precomputeInnerLoopLength12
+ */
+static inline void precomputeInnerLoopLength12
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // rotate w0
+    p_w0[ 1] = VEC_LEFT_ROTATE(p_blocks[0],  1);
+    p_w0[ 2] = VEC_LEFT_ROTATE(p_blocks[0],  2);
+    p_w0[ 3] = VEC_LEFT_ROTATE(p_blocks[0],  3);
+    p_w0[ 4] = VEC_LEFT_ROTATE(p_blocks[0],  4);
+    p_w0[ 5] = VEC_LEFT_ROTATE(p_blocks[0],  5);
+    p_w0[ 6] = VEC_LEFT_ROTATE(p_blocks[0],  6);
+    p_w0[ 7] = VEC_LEFT_ROTATE(p_blocks[0],  7);
+    p_w0[ 8] = VEC_LEFT_ROTATE(p_blocks[0],  8);
+    p_w0[ 9] = VEC_LEFT_ROTATE(p_blocks[0],  9);
+    p_w0[10] = VEC_LEFT_ROTATE(p_blocks[0], 10);
+    p_w0[11] = VEC_LEFT_ROTATE(p_blocks[0], 11);
+    p_w0[12] = VEC_LEFT_ROTATE(p_blocks[0], 12);
+    p_w0[13] = VEC_LEFT_ROTATE(p_blocks[0], 13);
+    p_w0[14] = VEC_LEFT_ROTATE(p_blocks[0], 14);
+    p_w0[15] = VEC_LEFT_ROTATE(p_blocks[0], 15);
+    p_w0[16] = VEC_LEFT_ROTATE(p_blocks[0], 16);
+    p_w0[17] = VEC_LEFT_ROTATE(p_blocks[0], 17);
+    p_w0[18] = VEC_LEFT_ROTATE(p_blocks[0], 18);
+    p_w0[19] = VEC_LEFT_ROTATE(p_blocks[0], 19);
+    p_w0[20] = VEC_LEFT_ROTATE(p_blocks[0], 20);
+    p_w0[21] = VEC_LEFT_ROTATE(p_blocks[0], 21);
+    p_w0[22] = VEC_LEFT_ROTATE(p_blocks[0], 22);
+    // word blocks of rounds 16 - 71, word blocks that are always zero are left out
+    p_blocks[16] = XOR(p_vecPrecomputedBlocks[16], p_w0[1]);
+    p_blocks[17] = p_vecPrecomputedBlocks[17];
+    p_blocks[18] = p_vecPrecomputedBlocks[18];
+    p_blocks[19] = XOR(p_vecPrecomputedBlocks[19], p_w0[2]);
+    p_blocks[20] = p_vecPrecomputedBlocks[20];
+    p_blocks[21] = p_vecPrecomputedBlocks[21];
+    p_blocks[22] = XOR(p_vecPrecomputedBlocks[22], p_w0[3]);
+    p_blocks[23] = p_vecPrecomputedBlocks[23];
+    p_blocks[24] = XOR(p_vecPrecomputedBlocks[24], p_w0[2]);
+    p_blocks[25] = XOR(p_vecPrecomputedBlocks[25], p_w0[4]);
+    p_blocks[26] = p_vecPrecomputedBlocks[26];
+    p_blocks[27] = p_vecPrecomputedBlocks[27];
+    p_blocks[28] = XOR(p_vecPrecomputedBlocks[28], p_w0[5]);
+    p_blocks[29] = p_vecPrecomputedBlocks[29];
+    p_blocks[30] = XOR(XOR(p_vecPrecomputedBlocks[30], p_w0[2]), p_w0[4]);
+    p_blocks[31] = XOR(p_vecPrecomputedBlocks[31], p_w0[6]);
+    p_blocks[32] = XOR(XOR(p_vecPrecomputedBlocks[32], p_w0[2]), p_w0[3]);
+    p_blocks[33] = p_vecPrecomputedBlocks[33];
+    p_blocks[34] = XOR(p_vecPrecomputedBlocks[34], p_w0[7]);
+    p_blocks[35] = XOR(p_vecPrecomputedBlocks[35], p_w0[4]);
+    p_blocks[36] = XOR(XOR(p_vecPrecomputedBlocks[36], p_w0[4]), p_w0[6]);
+    p_blocks[37] = XOR(p_vecPrecomputedBlocks[37], p_w0[8]);
+    p_blocks[38] = XOR(p_vecPrecomputedBlocks[38], p_w0[4]);
+    p_blocks[39] = p_vecPrecomputedBlocks[39];
+    p_blocks[40] = XOR(XOR(p_vecPrecomputedBlocks[40], p_w0[4]), p_w0[9]);
+    p_blocks[41] = p_vecPrecomputedBlocks[41];
+    p_blocks[42] = XOR(XOR(p_vecPrecomputedBlocks[42], p_w0[6]), p_w0[8]);
+    p_blocks[43] = XOR(p_vecPrecomputedBlocks[43], p_w0[10]);
+    p_blocks[44] = XOR(XOR(p_vecPrecomputedBlocks[44], p_w0[3]), XOR(p_w0[6], p_w0[7]));
+    p_blocks[45] = p_vecPrecomputedBlocks[45];
+    p_blocks[46] = XOR(XOR(p_vecPrecomputedBlocks[46], p_w0[4]), p_w0[11]);
+    p_blocks[47] = XOR(XOR(p_vecPrecomputedBlocks[47], p_w0[4]), p_w0[8]);
+    p_blocks[48] = XOR(XOR(XOR(p_vecPrecomputedBlocks[48], p_w0[3]), XOR(p_w0[4], p_w0[5])), XOR(p_w0[8], p_w0[10]));
+    p_blocks[49] = XOR(p_vecPrecomputedBlocks[49], p_w0[12]);
+    p_blocks[50] = XOR(p_vecPrecomputedBlocks[50], p_w0[8]);
+    p_blocks[51] = XOR(XOR(p_vecPrecomputedBlocks[51], p_w0[4]), p_w0[6]);
+    p_blocks[52] = XOR(XOR(p_vecPrecomputedBlocks[52], p_w0[4]), XOR(p_w0[8], p_w0[13]));
+    p_blocks[53] = p_vecPrecomputedBlocks[53];
+    p_blocks[54] = XOR(XOR(p_vecPrecomputedBlocks[54], p_w0[7]), XOR(p_w0[10], p_w0[12]));
+    p_blocks[55] = XOR(p_vecPrecomputedBlocks[55], p_w0[14]);
+    p_blocks[56] = XOR(XOR(XOR(p_vecPrecomputedBlocks[56], p_w0[4]), XOR(p_w0[6], p_w0[7])), XOR(p_w0[10], p_w0[11]));
+    p_blocks[57] = XOR(p_vecPrecomputedBlocks[57], p_w0[8]);
+    p_blocks[58] = XOR(XOR(p_vecPrecomputedBlocks[58], p_w0[4]), XOR(p_w0[8], p_w0[15]));
+    p_blocks[59] = XOR(XOR(p_vecPrecomputedBlocks[59], p_w0[8]), p_w0[12]);
+    p_blocks[60] = XOR(XOR(XOR(p_vecPrecomputedBlocks[60], p_w0[4]), XOR(p_w0[7], p_w0[8])), XOR(p_w0[12], p_w0[14]));
+    p_blocks[61] = XOR(p_vecPrecomputedBlocks[61], p_w0[16]);
+    p_blocks[62] = XOR(XOR(p_vecPrecomputedBlocks[62], p_w0[4]), XOR(XOR(p_w0[6], p_w0[8]), p_w0[12]));
+    p_blocks[63] = XOR(p_vecPrecomputedBlocks[63], p_w0[8]);
+    p_blocks[64] = XOR(XOR(XOR(p_vecPrecomputedBlocks[64], p_w0[4]), XOR(p_w0[6], p_w0[7])), XOR(XOR(p_w0[8], p_w0[12]), p_w0[17]));
+    p_blocks[65] = p_vecPrecomputedBlocks[65];
+    p_blocks[66] = XOR(XOR(p_vecPrecomputedBlocks[66], p_w0[14]), p_w0[16]);
+    p_blocks[67] = XOR(XOR(p_vecPrecomputedBlocks[67], p_w0[8]), p_w0[18]);
+    p_blocks[68] = XOR(XOR(p_vecPrecomputedBlocks[68], p_w0[11]), XOR(p_w0[14], p_w0[15]));
+    p_blocks[69] = p_vecPrecomputedBlocks[69];
+    p_blocks[70] = XOR(XOR(p_vecPrecomputedBlocks[70], p_w0[12]), p_w0[19]);
+    p_blocks[71] = XOR(XOR(p_vecPrecomputedBlocks[71], p_w0[12]), p_w0[16]);
+}
+/**
+ * Function: precomputeBlocks72To75Length12
+ */
+static inline void precomputeBlocks72To75Length12
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 72 - 75 (see precomputeInnerLoopLength12)
+    p_blocks[72] = XOR(XOR(XOR(p_vecPrecomputedBlocks[72], p_w0[5]), XOR(p_w0[11], p_w0[12])), XOR(XOR(p_w0[13], p_w0[16]), p_w0[18]));
+    p_blocks[73] = XOR(p_vecPrecomputedBlocks[73], p_w0[20]);
+    p_blocks[74] = XOR(XOR(p_vecPrecomputedBlocks[74], p_w0[8]), p_w0[16]);
+    p_blocks[75] = XOR(XOR(p_vecPrecomputedBlocks[75], p_w0[6]), XOR(p_w0[12], p_w0[14]));
+}
+/**
+ * Function: precomputeBlocks76To79Length12
+ */
+static inline void precomputeBlocks76To79Length12
+(
+    const __m128i *p_vecPrecomputedBlocks,
+    __m128i       *p_w0,
+    __m128i       *p_blocks
+)
+{
+    // word blocks of rounds 76 - 79 (see precomputeInnerLoopLength12)
+    p_blocks[76] = XOR(XOR(XOR(p_vecPrecomputedBlocks[76], p_w0[7]), XOR(p_w0[8], p_w0[12])), XOR(p_w0[16], p_w0[21]));
+    p_blocks[77] = p_vecPrecomputedBlocks[77];
+    p_blocks[78] = XOR(XOR(XOR(p_vecPrecomputedBlocks[78], p_w0[7]), XOR(p_w0[8], p_w0[15])), XOR(p_w0[18], p_w0[20]));
+    p_blocks[79] = XOR(XOR(p_vecPrecomputedBlocks[79], p_w0[8]), p_w0[22]);
+}
@@ -0,0 +1,654 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ * 
+ * This program is free software: you can redistribute it and/or modify  
+ * it under the terms of the GNU General Public License as published by  
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// malloc, free
+#include <stdlib.h>
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+// constant for k-values of rounds 0 - 19
+#define K_00_19              UINT32_C(0x5A827999)
+
+// macro for f-function of rounds 0 - 19
+#define F_00_19(mB, mC, mD) (mD ^ (mB & (mC ^ mD)))
+// macro for circular left-shift of a 32-bit word (taken from RFC 3174)
+#define LEFT_ROTATE(word, bits) (((word) << (bits)) | ((word) >> (32 - (bits))))
+// macro for the position of an input byte within its word block
+#define BYTE_SHIFT(position) (24 - 8 * ((position) & 3))
+
+// built-in charsets of masks (as in hashcat)
+#define MASK_CHARSET_LOWER   "abcdefghijklmnopqrstuvwxyz"
+#define MASK_CHARSET_UPPER   "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+#define MASK_CHARSET_DIGITS  "0123456789"
+#define MASK_CHARSET_SPECIAL " !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"
+#define MASK_CHARSET_ALL     MASK_CHARSET_LOWER MASK_CHARSET_UPPER MASK_CHARSET_DIGITS MASK_CHARSET_SPECIAL
+
+// function prototypes
+static void decodeOuterPositions(const struct keyspaceLayout *p_layout,
+                                 unsigned int                length,
+                                 uint64_t                    slice,
+                                 char                        *p_preimage);
+static void decodeInnerPositions(const struct keyspaceLayout *p_layout,
+                                 unsigned int                length,
+                                 uint64_t                    innerIndex,
+                                 char                        *p_preimage);
+static unsigned int getCharsetPosition(const struct keyspaceLayout *p_layout,
+                                       unsigned int                position,
+                                       char                        character);
+static int parseMask(struct keyspaceLayout *p_layout,
+                     const struct keyspace *p_keyspace,
+                     unsigned int          *p_maskLength);
+static int appendPlaceholder(char                  *p_charset,
+                             unsigned int          *p_charsetLength,
+                             unsigned char         *p_seen,
+                             char                  name,
+                             const struct keyspace *p_keyspace,
+                             int                   isCustomCharset);
+static unsigned int chooseInnerSplit(const struct keyspaceLayout *p_layout,
+                                     unsigned int                inner);
+static uint32_t *buildInnerTable(const struct keyspaceLayout *p_layout,
+                                 unsigned int                firstPosition,
+                                 unsigned int                numberOfPositions,
+                                 uint32_t                    padding,
+                                 uint32_t                    *p_numberOfEntries);
+
+/**
+ * Function: initKeyspaceLayout
+ */
+int initKeyspaceLayout
+(
+    struct keyspaceLayout *p_layout,
+    const struct keyspace *p_keyspace
+)
+{
+    unsigned char seen[256] = { 0 };
+    unsigned int  maskLength;
+    int           result;
+    memset(p_layout,
+           0,
+           sizeof(struct keyspaceLayout));
+    p_layout->minLength = p_keyspace->minLength;
+    p_layout->maxLength = p_keyspace->maxLength;
+    if(p_keyspace->p_mask != NULL)
+    {
+        if((result = parseMask(p_layout, p_keyspace, &maskLength)) != 0)
+            return result;
+        // without lengths the whole mask is swept
+        if(p_keyspace->maxLength == 0)
+            p_layout->minLength = p_layout->maxLength = maskLength;
+        if(p_layout->maxLength > maskLength)
+            return E_CRACK_BAD_KEYSPACE;
+    }
+    else if(p_keyspace->p_charset != NULL)
+    {
+        // copy the charset and reject duplicates (they would sweep candidates twice)
+        for(const char *p_curr = p_keyspace->p_charset; *p_curr != '\0'; p_curr++)
+        {
+            if(seen[(unsigned char) *p_curr]++)
+                return E_CRACK_BAD_KEYSPACE;
+            p_layout->p_charsets[0][p_layout->p_charsetLengths[0]++] = *p_curr;
+        }
+        if(p_layout->p_charsetLengths[0] == 0)
+            return E_CRACK_BAD_KEYSPACE;
+        // every position uses the same charset
+        for(unsigned int i = 1; i < CRACK_MAX_PREIMAGE_LENGTH; i++)
+        {
+            memcpy(p_layout->p_charsets[i],
+                   p_layout->p_charsets[0],
+                   sizeof(p_layout->p_charsets[0]));
+            p_layout->p_charsetLengths[i] = p_layout->p_charsetLengths[0];
+        }
+    }
+    else
+        return E_CRACK_BAD_KEYSPACE;
+
+    return buildKeyspaceLayout(p_layout);
+}
+/**
+ * Function: buildKeyspaceLayout
+ */
+int buildKeyspaceLayout
+(
+    struct keyspaceLayout *p_layout
+)
+{
+    unsigned int split;
+    uint64_t     numberOfSlices,
+                 numberOfInner;
+    uint32_t     padding;
+    if(p_layout->minLength < 1 || p_layout->minLength > p_layout->maxLength
+       || p_layout->maxLength > CRACK_MAX_PREIMAGE_LENGTH)
+        return E_CRACK_BAD_KEYSPACE;
+    p_layout->isDefault = p_layout->minLength == PREIMAGE_LENGTH_BYTE
+                          && p_layout->maxLength == PREIMAGE_LENGTH_BYTE;
+    for(unsigned int i = 0; i < PREIMAGE_LENGTH_BYTE; i++)
+        p_layout->isDefault = p_layout->isDefault
+                              && strcmp(p_layout->p_charsets[i], CRACK_DEFAULT_CHARSET) == 0;
+    /*
+     *  Input bytes 0 - 3 (word block 0) are swept by the inner loop, every
+     *  combination of the remaining bytes is one slice of the outer loop.
+     */
+    p_layout->p_firstSlice[p_layout->minLength]     = 0;
+    p_layout->p_firstCandidate[p_layout->minLength] = 0;
+    for(unsigned int length = p_layout->minLength; length <= p_layout->maxLength; length++)
+    {
+        numberOfSlices = 1;
+        for(unsigned int i = 4; i < length; i++)
+        {
+            if(numberOfSlices > UINT64_MAX / p_layout->p_charsetLengths[i])
+                return E_CRACK_BAD_KEYSPACE;
+            numberOfSlices *= p_layout->p_charsetLengths[i];
+        }
+        if(p_layout->p_firstSlice[length] > UINT64_MAX - numberOfSlices)
+            return E_CRACK_BAD_KEYSPACE;
+        p_layout->p_firstSlice[length + 1] = p_layout->p_firstSlice[length] + numberOfSlices;
+        // candidates are numbered slice by slice (see getCandidatePreimage)
+        numberOfInner = 1;
+        for(unsigned int i = 0; i < length && i < 4; i++)
+            numberOfInner *= p_layout->p_charsetLengths[i];
+        if(numberOfSlices > (UINT64_MAX - p_layout->p_firstCandidate[length]) / numberOfInner)
+            return E_CRACK_BAD_KEYSPACE;
+        p_layout->p_firstCandidate[length + 1] = p_layout->p_firstCandidate[length]
+                                               + numberOfSlices * numberOfInner;
+    }
+    // build the inner loop tables for every number of inner positions in use
+    for(unsigned int inner = (p_layout->minLength < 4) ? p_layout->minLength : 4;
+        inner <= p_layout->maxLength && inner <= 4;
+        inner++)
+    {
+        // the '1'-bit follows the preimage within word block 0 for lengths < 4
+        padding = (inner < 4) ? (UINT32_C(0x80) << BYTE_SHIFT(inner)) : 0;
+        split   = chooseInnerSplit(p_layout,
+                                   inner);
+        p_layout->p_innerSplit[inner] = split;
+        p_layout->p_innerHigh[inner]  = buildInnerTable(p_layout,
+                                                        0,
+                                                        split,
+                                                        0,
+                                                        &p_layout->p_numberOfInnerHigh[inner]);
+        p_layout->p_innerLow[inner]   = buildInnerTable(p_layout,
+                                                        split,
+                                                        inner - split,
+                                                        padding,
+                                                        &p_layout->p_numberOfInnerLow[inner]);
+        if(p_layout->p_innerHigh[inner] == NULL || p_layout->p_innerLow[inner] == NULL)
+        {
+            freeKeyspaceLayout(p_layout);
+            return E_CRACK_OUT_OF_MEMORY;
+        }
+    }
+
+    return 0;
+}
+/**
+ * Function: freeKeyspaceLayout
+ */
+void freeKeyspaceLayout
+(
+    struct keyspaceLayout *p_layout
+)
+{
+    for(unsigned int i = 0; i < 5; i++)
+    {
+        free(p_layout->p_innerHigh[i]);
+        free(p_layout->p_innerLow[i]);
+        p_layout->p_innerHigh[i] = NULL;
+        p_layout->p_innerLow[i]  = NULL;
+    }
+}
+/**
+ * Function: setupSlice
+ */
+void setupSlice
+(
+    const struct keyspaceLayout *p_layout,
+    uint64_t                    slice,
+    struct sliceSetup           *p_setup
+)
+{
+    unsigned int length = p_layout->minLength,
+                 inner;
+    uint32_t     *p_blocks = p_setup->p_precomputedBlocks,
+                 temp;
+    // find the length the slice belongs to
+    while(slice >= p_layout->p_firstSlice[length + 1])
+        length++;
+    slice -= p_layout->p_firstSlice[length];
+    inner = (length < 4) ? length : 4;
+    p_setup->p_layout          = p_layout;
+    p_setup->length            = length;
+    p_setup->innerSplit        = p_layout->p_innerSplit[inner];
+    p_setup->p_innerHigh       = p_layout->p_innerHigh[inner];
+    p_setup->p_innerLow        = p_layout->p_innerLow[inner];
+    p_setup->numberOfInnerHigh = p_layout->p_numberOfInnerHigh[inner];
+    p_setup->numberOfInnerLow  = p_layout->p_numberOfInnerLow[inner];
+    memset(p_blocks,
+           0,
+           16 * sizeof(uint32_t));
+    // the slice selects the input bytes after word block 0
+    decodeOuterPositions(p_layout,
+                         length,
+                         slice,
+                         p_setup->p_preimage);
+    for(unsigned int i = 4; i < length; i++)
+        p_blocks[i >> 2] |= (uint32_t) (unsigned char) p_setup->p_preimage[i] << BYTE_SHIFT(i);
+    // set padding (for lengths < 4 it is part of the inner loop tables)
+    if(length >= 4)
+        p_blocks[length >> 2] |= UINT32_C(0x80) << BYTE_SHIFT(length);
+    p_blocks[15] = length * 8;
+    // expand the word blocks once, word block 0 is added by the inner loop
+    for(unsigned int i = 16; i < 80; i++)
+    {
+        temp = p_blocks[i - 3] ^ p_blocks[i - 8] ^ p_blocks[i - 14] ^ p_blocks[i - 16];
+        p_blocks[i] = LEFT_ROTATE(temp, 1);
+    }
+    /*
+     *  Initial step optimization: everything but word block 0 (and the result
+     *  of round 0 from round 1 on) is constant in rounds 0 - 4. Word blocks 5 - 14
+     *  are always zero, so round 15 only needs the length word.
+     */
+    p_setup->p_roundConstants[0] = LEFT_ROTATE(SHA1_IV_0, 5) + F_00_19(SHA1_IV_1, SHA1_IV_2, SHA1_IV_3)
+                                 + SHA1_IV_4 + K_00_19;
+    p_setup->p_roundConstants[1] = F_00_19(SHA1_IV_0, LEFT_ROTATE(SHA1_IV_1, 30), SHA1_IV_2)
+                                 + SHA1_IV_3 + K_00_19 + p_blocks[1];
+    p_setup->p_roundConstants[2] = SHA1_IV_2 + K_00_19 + p_blocks[2];
+    p_setup->p_roundConstants[3] = LEFT_ROTATE(SHA1_IV_1, 30) + K_00_19 + p_blocks[3];
+    p_setup->p_roundConstants[4] = LEFT_ROTATE(SHA1_IV_0, 30) + K_00_19 + p_blocks[4];
+    p_setup->p_roundConstants[5] = K_00_19 + p_blocks[15];
+}
+/**
+ * Function: getSlicePreimage
+ */
+void getSlicePreimage
+(
+    const struct sliceSetup *p_setup,
+    uint64_t                innerIndex,
+    char                    *p_preimage
+)
+{
+    memcpy(p_preimage,
+           p_setup->p_preimage,
+           p_setup->length);
+    decodeInnerPositions(p_setup->p_layout,
+                         p_setup->length,
+                         innerIndex,
+                         p_preimage);
+}
+/**
+ * Function: getNumberOfCandidates
+ */
+uint64_t getNumberOfCandidates
+(
+    const struct keyspaceLayout *p_layout
+)
+{
+    return p_layout->p_firstCandidate[p_layout->maxLength + 1];
+}
+/**
+ * Function: getCandidateIndex
+ */
+uint64_t getCandidateIndex
+(
+    const struct sliceSetup *p_setup,
+    uint64_t                slice,
+    uint64_t                innerIndex
+)
+{
+    const struct keyspaceLayout *p_layout      = p_setup->p_layout;
+    uint64_t                    numberOfInner = (uint64_t) p_setup->numberOfInnerHigh * p_setup->numberOfInnerLow;
+
+    return p_layout->p_firstCandidate[p_setup->length]
+           + (slice - p_layout->p_firstSlice[p_setup->length]) * numberOfInner + innerIndex;
+}
+/**
+ * Function: getCandidatePreimage
+ */
+unsigned int getCandidatePreimage
+(
+    const struct keyspaceLayout *p_layout,
+    uint64_t                    index,
+    char                        *p_preimage
+)
+{
+    unsigned int length = p_layout->minLength,
+                 inner;
+    uint64_t     numberOfInner;
+    // find the length the candidate belongs to
+    while(index >= p_layout->p_firstCandidate[length + 1])
+        length++;
+    index -= p_layout->p_firstCandidate[length];
+    inner = (length < 4) ? length : 4;
+    numberOfInner = (uint64_t) p_layout->p_numberOfInnerHigh[inner] * p_layout->p_numberOfInnerLow[inner];
+    decodeOuterPositions(p_layout,
+                         length,
+                         index / numberOfInner,
+                         p_preimage);
+    decodeInnerPositions(p_layout,
+                         length,
+                         index % numberOfInner,
+                         p_preimage);
+
+    return length;
+}
+/**
+ * Function: buildInnerTable
+ */
+static uint32_t *buildInnerTable
+(
+    const struct keyspaceLayout *p_layout,
+    unsigned int                firstPosition,
+    unsigned int                numberOfPositions,
+    uint32_t                    padding,
+    uint32_t                    *p_numberOfEntries
+)
+{
+    uint32_t numberOfEntries = 1,
+             index,
+             *p_table;
+    for(unsigned int i = firstPosition; i < firstPosition + numberOfPositions; i++)
+        numberOfEntries *= p_layout->p_charsetLengths[i];
+    // pad to a multiple of the widest kernel with copies of the last entry
+    p_table = malloc(((numberOfEntries + CRACK_INNER_ALIGNMENT - 1) / CRACK_INNER_ALIGNMENT)
+                     * CRACK_INNER_ALIGNMENT * sizeof(uint32_t));
+    if(p_table == NULL)
+        return NULL;
+    for(uint32_t i = 0; i < numberOfEntries; i++)
+    {
+        p_table[i] = padding;
+        index      = i;
+        for(unsigned int j = firstPosition + numberOfPositions; j-- > firstPosition;)
+        {
+            p_table[i] |= (uint32_t) (unsigned char) p_layout->p_charsets[j][index % p_layout->p_charsetLengths[j]]
+                          << BYTE_SHIFT(j);
+            index /= p_layout->p_charsetLengths[j];
+        }
+    }
+    for(uint32_t i = numberOfEntries; i % CRACK_INNER_ALIGNMENT != 0; i++)
+        p_table[i] = p_table[numberOfEntries - 1];
+    *p_numberOfEntries = numberOfEntries;
+
+    return p_table;
+}
+/**
+ * Function: getPreimageIndex
+ */
+uint64_t getPreimageIndex
+(
+    const struct keyspaceLayout *p_layout,
+    const char                  *p_preimage,
+    unsigned int                length
+)
+{
+    unsigned int inner = (length < 4) ? length : 4,
+                 split = p_layout->p_innerSplit[inner];
+    uint64_t     slice = 0,
+                 high  = 0,
+                 low   = 0;
+    // inverse of decodeOuterPositions and decodeInnerPositions
+    for(unsigned int i = 4; i < length; i++)
+        slice = slice * p_layout->p_charsetLengths[i] + getCharsetPosition(p_layout, i, p_preimage[i]);
+    for(unsigned int i = 0; i < split; i++)
+        high = high * p_layout->p_charsetLengths[i] + getCharsetPosition(p_layout, i, p_preimage[i]);
+    for(unsigned int i = split; i < inner; i++)
+        low = low * p_layout->p_charsetLengths[i] + getCharsetPosition(p_layout, i, p_preimage[i]);
+
+    return p_layout->p_firstCandidate[length]
+           + (slice * p_layout->p_numberOfInnerHigh[inner] + high) * p_layout->p_numberOfInnerLow[inner] + low;
+}
+/**
+ * Function: getCandidateSlice
+ */
+uint64_t getCandidateSlice
+(
+    const struct keyspaceLayout *p_layout,
+    uint64_t                    index
+)
+{
+    unsigned int length = p_layout->minLength,
+                 inner;
+    // find the length the candidate belongs to
+    while(index >= p_layout->p_firstCandidate[length + 1])
+        length++;
+    inner = (length < 4) ? length : 4;
+
+    return p_layout->p_firstSlice[length] + (index - p_layout->p_firstCandidate[length])
+           / ((uint64_t) p_layout->p_numberOfInnerHigh[inner] * p_layout->p_numberOfInnerLow[inner]);
+}
+/**
+ * Function: getSliceCandidate
+ */
+uint64_t getSliceCandidate
+(
+    const struct keyspaceLayout *p_layout,
+    uint64_t                    slice
+)
+{
+    unsigned int length = p_layout->minLength,
+                 inner;
+    // one past the last slice maps to one past the last candidate
+    if(slice >= p_layout->p_firstSlice[p_layout->maxLength + 1])
+        return getNumberOfCandidates(p_layout);
+    while(slice >= p_layout->p_firstSlice[length + 1])
+        length++;
+    inner = (length < 4) ? length : 4;
+
+    return p_layout->p_firstCandidate[length] + (slice - p_layout->p_firstSlice[length])
+           * ((uint64_t) p_layout->p_numberOfInnerHigh[inner] * p_layout->p_numberOfInnerLow[inner]);
+}
+/**
+ * Function: decodeOuterPositions
+ */
+static void decodeOuterPositions
+(
+    const struct keyspaceLayout *p_layout,
+    unsigned int                length,
+    uint64_t                    slice,
+    char                        *p_preimage
+)
+{
+    // slice within its length, the last byte varies fastest
+    for(unsigned int i = length; i-- > 4;)
+    {
+        p_preimage[i] = p_layout->p_charsets[i][slice % p_layout->p_charsetLengths[i]];
+        slice /= p_layout->p_charsetLengths[i];
+    }
+}
+/**
+ * Function: decodeInnerPositions
+ */
+static void decodeInnerPositions
+(
+    const struct keyspaceLayout *p_layout,
+    unsigned int                length,
+    uint64_t                    innerIndex,
+    char                        *p_preimage
+)
+{
+    unsigned int inner = (length < 4) ? length : 4,
+                 split = p_layout->p_innerSplit[inner];
+    uint64_t     high  = innerIndex / p_layout->p_numberOfInnerLow[inner],
+                 low   = innerIndex % p_layout->p_numberOfInnerLow[inner];
+    // low table covers the input bytes from the split on, high table the ones before (last byte varies fastest)
+    for(unsigned int i = inner; i-- > split;)
+    {
+        p_preimage[i] = p_layout->p_charsets[i][low % p_layout->p_charsetLengths[i]];
+        low /= p_layout->p_charsetLengths[i];
+    }
+    for(unsigned int i = split; i-- > 0;)
+    {
+        p_preimage[i] = p_layout->p_charsets[i][high % p_layout->p_charsetLengths[i]];
+        high /= p_layout->p_charsetLengths[i];
+    }
+}
+/**
+ * Function: getCharsetPosition
+ */
+static unsigned int getCharsetPosition
+(
+    const struct keyspaceLayout *p_layout,
+    unsigned int                position,
+    char                        character
+)
+{
+    const char *p_found = memchr(p_layout->p_charsets[position],
+                                 character,
+                                 p_layout->p_charsetLengths[position]);
+    // characters outside the charset never come out of a sweep
+    return (p_found != NULL) ? (unsigned int) (p_found - p_layout->p_charsets[position]) : 0;
+}
+/**
+ * Function: parseMask
+ */
+static int parseMask
+(
+    struct keyspaceLayout *p_layout,
+    const struct keyspace *p_keyspace,
+    unsigned int          *p_maskLength
+)
+{
+    unsigned char seen[256];
+    unsigned int  length = 0;
+    int           result;
+    for(const char *p_curr = p_keyspace->p_mask; *p_curr != '\0'; p_curr++, length++)
+    {
+        if(length == CRACK_MAX_PREIMAGE_LENGTH)
+            return E_CRACK_BAD_KEYSPACE;
+        // characters of overlapping charsets (e.g. "?l?a") are only swept once
+        memset(seen,
+               0,
+               sizeof(seen));
+        if(*p_curr != '?')
+        {
+            p_layout->p_charsets[length][0]    = *p_curr;
+            p_layout->p_charsetLengths[length] = 1;
+            continue;
+        }
+        if((result = appendPlaceholder(p_layout->p_charsets[length],
+                                       &p_layout->p_charsetLengths[length],
+                                       seen,
+                                       *++p_curr,
+                                       p_keyspace,
+                                       0)) != 0)
+            return result;
+        if(p_layout->p_charsetLengths[length] == 0)
+            return E_CRACK_BAD_KEYSPACE;
+    }
+    if(length == 0)
+        return E_CRACK_BAD_KEYSPACE;
+    *p_maskLength = length;
+
+    return 0;
+}
+/**
+ * Function: appendPlaceholder
+ */
+static int appendPlaceholder
+(
+    char                  *p_charset,
+    unsigned int          *p_charsetLength,
+    unsigned char         *p_seen,
+    char                  name,
+    const struct keyspace *p_keyspace,
+    int                   isCustomCharset
+)
+{
+    const char *p_source;
+    int        result;
+    switch(name)
+    {
+        case 'l': p_source = MASK_CHARSET_LOWER;   break;
+        case 'u': p_source = MASK_CHARSET_UPPER;   break;
+        case 'd': p_source = MASK_CHARSET_DIGITS;  break;
+        case 's': p_source = MASK_CHARSET_SPECIAL; break;
+        case 'a': p_source = MASK_CHARSET_ALL;     break;
+        case '?': p_source = "?";                  break;
+        case '1': case '2': case '3': case '4':
+            // custom charsets can use the built-in ones, but no other custom charset
+            p_source = p_keyspace->p_customCharsets[name - '1'];
+            if(isCustomCharset || p_source == NULL)
+                return E_CRACK_BAD_KEYSPACE;
+            for(; *p_source != '\0'; p_source++)
+            {
+                if(*p_source == '?')
+                {
+                    if((result = appendPlaceholder(p_charset,
+                                                   p_charsetLength,
+                                                   p_seen,
+                                                   *++p_source,
+                                                   p_keyspace,
+                                                   1)) != 0)
+                        return result;
+                }
+                else if(!p_seen[(unsigned char) *p_source]++)
+                    p_charset[(*p_charsetLength)++] = *p_source;
+            }
+            return 0;
+        default:
+            return E_CRACK_BAD_KEYSPACE;
+    }
+    for(; *p_source != '\0'; p_source++)
+        if(!p_seen[(unsigned char) *p_source]++)
+            p_charset[(*p_charsetLength)++] = *p_source;
+
+    return 0;
+}
+/**
+ * Function: chooseInnerSplit
+ */
+static unsigned int chooseInnerSplit
+(
+    const struct keyspaceLayout *p_layout,
+    unsigned int                inner
+)
+{
+    uint64_t     numberOfHigh,
+                 numberOfLow,
+                 padded,
+                 bestLow    = 1,
+                 bestPadded = 0;
+    unsigned int best       = (inner < 2) ? inner : 2;
+    /*
+     *  The low table is loaded into the vector lanes and padded to
+     *  CRACK_INNER_ALIGNMENT, the high table is broadcast. Pick the split
+     *  that wastes the fewest lanes on padding (a single character at the end
+     *  of a mask would waste seven of eight) while the low table stays in L1;
+     *  on a tie the smaller low table wins.
+     */
+    for(unsigned int split = inner + 1; split-- > 0;)
+    {
+        numberOfHigh = numberOfLow = 1;
+        for(unsigned int i = 0; i < split; i++)
+            numberOfHigh *= p_layout->p_charsetLengths[i];
+        for(unsigned int i = split; i < inner; i++)
+            numberOfLow *= p_layout->p_charsetLengths[i];
+        if(numberOfLow > CRACK_MAX_INNER_LOW || numberOfHigh > CRACK_MAX_INNER_HIGH)
+            continue;
+        padded = (numberOfLow + CRACK_INNER_ALIGNMENT - 1) / CRACK_INNER_ALIGNMENT * CRACK_INNER_ALIGNMENT;
+        if(bestPadded == 0 || padded * bestLow < bestPadded * numberOfLow)
+        {
+            best       = split;
+            bestLow    = numberOfLow;
+            bestPadded = padded;
+        }
+    }
+
+    return best;
+}
@@ -0,0 +1,507 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+// sched_getaffinity, CPU_SET, pthread_attr_setaffinity_np
+#define _GNU_SOURCE
+#include "sha1-cracker.h"
+// sched_getaffinity, sched_setaffinity, cpu_set_t
+#include <sched.h>
+// fopen, fgets, fclose, snprintf
+#include <stdio.h>
+// getenv, strtoul
+#include <stdlib.h>
+// mmap, munmap
+#include <sys/mman.h>
+// syscall, SYS_mbind
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// topology of the kernel's sysfs (below CRACK_SYSFS_PATH)
+#define SYSFS_CPU_PATH      "%s/devices/system/cpu/cpu%u/topology/thread_siblings_list"
+#define SYSFS_NODE_PATH     "%s/devices/system/node/node%u/cpulist"
+// memory policy of mbind: allocate on the node, fall back to others once it is full
+#define MPOL_PREFERRED      1
+// start of the next cache line
+#define NODE_ALIGN(offset)  (((offset) + 63) & ~(size_t) 63)
+
+// function prototypes
+static void initCrackPlacement(void) __attribute__((constructor));
+static int readCpuList(const char         *p_path,
+                       struct crackCpuSet *p_set);
+static void bindNodeMemory(void         *p_memory,
+                           size_t       size,
+                           unsigned int node);
+static size_t getTargetSetLayout(const struct targetSet *p_set,
+                                 size_t                 *p_offsets);
+
+// pin the workers of a sweep (unless CRACK_PLACEMENT_ENV is "off")
+static int isPlacementEnabled = 1;
+// held by the one sweep of the process that pins its workers
+static atomic_flag isPlacementClaimed = ATOMIC_FLAG_INIT;
+
+/**
+ * Function: setCrackPlacement
+ */
+void setCrackPlacement
+(
+    int isEnabled
+)
+{
+    isPlacementEnabled = isEnabled;
+}
+/**
+ * Function: getCrackPlacement
+ */
+int getCrackPlacement
+(
+    void
+)
+{
+    return isPlacementEnabled;
+}
+/**
+ * Function: claimCrackPlacement
+ */
+int claimCrackPlacement
+(
+    void
+)
+{
+    /*
+     *  Every sweep would pin its workers to the same cores, starting with the
+     *  first one, so only one sweep at a time gets the cores of the process.
+     *  Concurrent sweeps leave their workers to the scheduler.
+     */
+    if(!isPlacementEnabled || atomic_flag_test_and_set(&isPlacementClaimed))
+        return 1;
+
+    return 0;
+}
+/**
+ * Function: releaseCrackPlacement
+ */
+void releaseCrackPlacement
+(
+    void
+)
+{
+    atomic_flag_clear(&isPlacementClaimed);
+}
+/**
+ * Function: pinCrackProcess
+ */
+int pinCrackProcess
+(
+    unsigned int index
+)
+{
+    cpu_set_t            cpus;
+    struct crackTopology topology;
+    if(!isPlacementEnabled || getCrackTopology(&topology) != 0)
+        return 1;
+    /*
+     *  Worker processes take the cores of the caller in turn. A sweep of the
+     *  process then only sees its own core, instead of pinning to the first
+     *  core like the sweeps of all other workers.
+     */
+    CPU_ZERO(&cpus);
+    CPU_SET(topology.p_cpus[index % topology.numberOfCores], &cpus);
+
+    return (sched_setaffinity(0, sizeof(cpus), &cpus) == 0) ? 0 : 1;
+}
+/**
+ * Function: getCrackTopology
+ */
+int getCrackTopology
+(
+    struct crackTopology *p_topology
+)
+{
+    cpu_set_t          affinity;
+    struct crackCpuSet allowed;
+    memset(p_topology,
+           0,
+           sizeof(struct crackTopology));
+    // only the CPUs the calling thread may run on (e.g. within a cpuset)
+    if(sched_getaffinity(0, sizeof(affinity), &affinity) != 0)
+        return E_CRACK_IO;
+    memset(&allowed,
+           0,
+           sizeof(allowed));
+    for(unsigned int cpu = 0; cpu < CRACK_MAX_CPUS && cpu < CPU_SETSIZE; cpu++)
+        if(CPU_ISSET(cpu, &affinity))
+            CRACK_CPU_SET(&allowed, cpu);
+
+    return buildCrackTopology(p_topology,
+                              CRACK_SYSFS_PATH,
+                              &allowed);
+}
+/**
+ * Function: buildCrackTopology
+ */
+int buildCrackTopology
+(
+    struct crackTopology     *p_topology,
+    const char               *p_sysfsPath,
+    const struct crackCpuSet *p_allowed
+)
+{
+    char               p_path[4096];
+    unsigned int       p_coreNodes[CRACK_MAX_CPUS];
+    struct crackCpuSet siblings,
+                       nodeCpus;
+    unsigned int       first;
+    int                hasNodes = 0;
+    memset(p_topology,
+           0,
+           sizeof(struct crackTopology));
+    for(unsigned int i = 0; i < CRACK_MAX_CPUS; i++)
+        p_coreNodes[i] = UINT_MAX;
+    // a physical core is represented by the first of its hardware threads that is allowed
+    for(unsigned int cpu = 0; cpu < CRACK_MAX_CPUS; cpu++)
+    {
+        if(!CRACK_CPU_ISSET(p_allowed, cpu))
+            continue;
+        snprintf(p_path, sizeof(p_path), SYSFS_CPU_PATH, p_sysfsPath, cpu);
+        if(readCpuList(p_path, &siblings) != 0)
+            memset(&siblings,
+                   0,
+                   sizeof(siblings));
+        CRACK_CPU_SET(&siblings, cpu);
+        first = 0;
+        while(!CRACK_CPU_ISSET(&siblings, first) || !CRACK_CPU_ISSET(p_allowed, first))
+            first++;
+        if(first == cpu)
+            p_coreNodes[cpu] = 0;
+    }
+    // without NUMA support in the kernel, all cores are on node 0
+    for(unsigned int node = 0; node < CRACK_MAX_NODES; node++)
+    {
+        snprintf(p_path, sizeof(p_path), SYSFS_NODE_PATH, p_sysfsPath, node);
+        if(readCpuList(p_path, &nodeCpus) != 0)
+            continue;
+        hasNodes = 1;
+        for(unsigned int cpu = 0; cpu < CRACK_MAX_CPUS; cpu++)
+            if(p_coreNodes[cpu] != UINT_MAX && CRACK_CPU_ISSET(&nodeCpus, cpu))
+                p_coreNodes[cpu] = node;
+    }
+    /*
+     *  Cores are listed node by node, so the first workers of a sweep share a
+     *  node and the target tables are only replicated once more nodes are used.
+     */
+    for(unsigned int node = 0; node < (hasNodes ? CRACK_MAX_NODES : 1); node++)
+    {
+        for(unsigned int cpu = 0; cpu < CRACK_MAX_CPUS && p_topology->numberOfCores < CRACK_MAX_THREADS; cpu++)
+        {
+            if(p_coreNodes[cpu] != node)
+                continue;
+            if(p_topology->numberOfCores == 0 || p_topology->p_nodes[p_topology->numberOfCores - 1] != node)
+                p_topology->numberOfNodes++;
+            p_topology->p_cpus[p_topology->numberOfCores]    = cpu;
+            p_topology->p_nodes[p_topology->numberOfCores++] = node;
+        }
+    }
+    if(p_topology->numberOfCores == 0)
+        return E_CRACK_IO;
+
+    return 0;
+}
+/**
+ * Function: parseCpuList
+ */
+int parseCpuList
+(
+    const char         *p_text,
+    struct crackCpuSet *p_set
+)
+{
+    char          *p_end;
+    unsigned long first,
+                  last;
+    memset(p_set,
+           0,
+           sizeof(struct crackCpuSet));
+    // comma-separated CPUs and ranges, e.g. "0-3,8-11" (empty for a node without CPUs)
+    while(*p_text >= '0' && *p_text <= '9')
+    {
+        first = last = strtoul(p_text, &p_end, 10);
+        if(*p_end == '-')
+        {
+            if(p_end[1] < '0' || p_end[1] > '9')
+                return E_CRACK_IO;
+            last = strtoul(p_end + 1, &p_end, 10);
+        }
+        if(last < first)
+            return E_CRACK_IO;
+        for(unsigned long cpu = first; cpu <= last && cpu < CRACK_MAX_CPUS; cpu++)
+            CRACK_CPU_SET(p_set, cpu);
+        if(*p_end != ',')
+        {
+            p_text = p_end;
+            break;
+        }
+        p_text = p_end + 1;
+    }
+    // nothing but the line end may follow
+    if(*p_text != '\0' && *p_text != '\n')
+        return E_CRACK_IO;
+
+    return 0;
+}
+/**
+ * Function: startPlacedThread
+ */
+int startPlacedThread
+(
+    struct placedThread *p_thread,
+    void                *(*p_function)(void *),
+    void                *p_arg,
+    unsigned int        cpu,
+    unsigned int        node
+)
+{
+    int            result = E_CRACK_OUT_OF_MEMORY;
+    cpu_set_t      cpus;
+    pthread_attr_t attributes;
+    /*
+     *  The stack holds the precomputed word blocks of the kernels, so it is
+     *  bound to the node of the core. The thread starts pinned to the core,
+     *  so even where mbind is not allowed its first touch keeps it local.
+     */
+    p_thread->p_stack = allocNodeMemory(CRACK_WORKER_STACK_SIZE,
+                                        node);
+    if(p_thread->p_stack == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    if(pthread_attr_init(&attributes) != 0)
+    {
+        freeNodeMemory(p_thread->p_stack,
+                       CRACK_WORKER_STACK_SIZE);
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    if(pthread_attr_setstack(&attributes, p_thread->p_stack, CRACK_WORKER_STACK_SIZE) == 0
+       && pthread_attr_setaffinity_np(&attributes, sizeof(cpus), &cpus) == 0
+       && pthread_create(&p_thread->thread, &attributes, p_function, p_arg) == 0)
+        result = 0;
+    pthread_attr_destroy(&attributes);
+    if(result != 0)
+    {
+        freeNodeMemory(p_thread->p_stack,
+                       CRACK_WORKER_STACK_SIZE);
+        p_thread->p_stack = NULL;
+    }
+
+    return result;
+}
+/**
+ * Function: joinPlacedThread
+ */
+void joinPlacedThread
+(
+    struct placedThread *p_thread
+)
+{
+    pthread_join(p_thread->thread,
+                 NULL);
+    freeNodeMemory(p_thread->p_stack,
+                   CRACK_WORKER_STACK_SIZE);
+    p_thread->p_stack = NULL;
+}
+/**
+ * Function: initNodeTargetSet
+ */
+int initNodeTargetSet
+(
+    struct targetSet       *p_copy,
+    const struct targetSet *p_set,
+    unsigned int           cpu,
+    unsigned int           node
+)
+{
+    size_t        p_offsets[4],
+                  size = getTargetSetLayout(p_set, p_offsets);
+    unsigned char *p_memory;
+    cpu_set_t     original,
+                  cpus;
+    int           isPinned;
+    p_memory = allocNodeMemory(size,
+                               node);
+    if(p_memory == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    // copied from a core of the node, so the pages are local even if mbind is not allowed
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    isPinned = pthread_getaffinity_np(pthread_self(), sizeof(original), &original) == 0
+               && pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+    *p_copy             = *p_set;
+    p_copy->p_filter    = (uint32_t *) p_memory;
+    p_copy->p_directory = (uint32_t *) (p_memory + p_offsets[0]);
+    p_copy->p_keys      = (uint32_t *) (p_memory + p_offsets[1]);
+    p_copy->p_entries   = (struct targetEntry *) (p_memory + p_offsets[2]);
+    memcpy(p_copy->p_filter,
+           p_set->p_filter,
+           p_offsets[0]);
+    memcpy(p_copy->p_directory,
+           p_set->p_directory,
+           (((size_t) 1 << (32 - p_set->directoryShift)) + 1) * sizeof(uint32_t));
+    memcpy(p_copy->p_keys,
+           p_set->p_keys,
+           p_set->numberOfTargets * sizeof(uint32_t));
+    memcpy(p_copy->p_entries,
+           p_set->p_entries,
+           p_set->numberOfTargets * sizeof(struct targetEntry));
+    if(isPinned)
+        pthread_setaffinity_np(pthread_self(),
+                               sizeof(original),
+                               &original);
+
+    return 0;
+}
+/**
+ * Function: freeNodeTargetSet
+ */
+void freeNodeTargetSet
+(
+    struct targetSet *p_copy
+)
+{
+    size_t p_offsets[4];
+    // filter, directory, keys and entries share one mapping
+    freeNodeMemory(p_copy->p_filter,
+                   getTargetSetLayout(p_copy, p_offsets));
+    p_copy->p_filter    = NULL;
+    p_copy->p_directory = NULL;
+    p_copy->p_keys      = NULL;
+    p_copy->p_entries   = NULL;
+}
+/**
+ * Function: allocNodeMemory
+ */
+void *allocNodeMemory
+(
+    size_t       size,
+    unsigned int node
+)
+{
+    void *p_memory = mmap(NULL,
+                          size,
+                          PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS,
+                          -1,
+                          0);
+    if(p_memory == MAP_FAILED)
+        return NULL;
+    bindNodeMemory(p_memory,
+                   size,
+                   node);
+
+    return p_memory;
+}
+/**
+ * Function: freeNodeMemory
+ */
+void freeNodeMemory
+(
+    void   *p_memory,
+    size_t size
+)
+{
+    if(p_memory != NULL)
+        munmap(p_memory,
+               size);
+}
+/**
+ * Function: initCrackPlacement
+ */
+static void initCrackPlacement
+(
+    void
+)
+{
+    const char *p_override = getenv(CRACK_PLACEMENT_ENV);
+    // e.g. to compare against the scheduler's own placement
+    if(p_override != NULL && strcmp(p_override, "off") == 0)
+        isPlacementEnabled = 0;
+}
+/**
+ * Function: readCpuList
+ */
+static int readCpuList
+(
+    const char         *p_path,
+    struct crackCpuSet *p_set
+)
+{
+    char p_line[4096],
+         *p_curr;
+    FILE *p_file;
+    memset(p_set,
+           0,
+           sizeof(struct crackCpuSet));
+    if((p_file = fopen(p_path, "r")) == NULL)
+        return E_CRACK_IO;
+    p_curr = fgets(p_line, sizeof(p_line), p_file);
+    fclose(p_file);
+    if(p_curr == NULL)
+        return E_CRACK_IO;
+
+    return parseCpuList(p_line,
+                        p_set);
+}
+/**
+ * Function: bindNodeMemory
+ */
+static void bindNodeMemory
+(
+    void         *p_memory,
+    size_t       size,
+    unsigned int node
+)
+{
+    unsigned long p_nodeMask[(CRACK_MAX_NODES + 63) / 64] = { 0 };
+    p_nodeMask[node / 64] = 1UL << (node % 64);
+    /*
+     *  Called directly, so no libnuma is needed. Failing is fine (e.g. a
+     *  container without the permission): the pages then go to the node of
+     *  the thread that touches them first.
+     */
+    syscall(SYS_mbind,
+            p_memory,
+            size,
+            MPOL_PREFERRED,
+            p_nodeMask,
+            (unsigned long) CRACK_MAX_NODES + 1,
+            0);
+}
+/**
+ * Function: getTargetSetLayout
+ */
+static size_t getTargetSetLayout
+(
+    const struct targetSet *p_set,
+    size_t                 *p_offsets
+)
+{
+    // ends of filter, directory, keys and entries, each part starts on a cache line
+    p_offsets[0] = ((size_t) p_set->filterMask + 1) * sizeof(uint32_t);
+    p_offsets[1] = NODE_ALIGN(p_offsets[0]
+                              + (((size_t) 1 << (32 - p_set->directoryShift)) + 1) * sizeof(uint32_t));
+    p_offsets[2] = NODE_ALIGN(p_offsets[1] + p_set->numberOfTargets * sizeof(uint32_t));
+    p_offsets[3] = p_offsets[2] + p_set->numberOfTargets * sizeof(struct targetEntry);
+
+    return p_offsets[3] + 1;
+}
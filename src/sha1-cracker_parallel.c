@@ -0,0 +1,721 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ * 
+ * This program is free software: you can redistribute it and/or modify  
+ * it under the terms of the GNU General Public License as published by  
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// pthread_create, pthread_join
+#include <pthread.h>
+// malloc, calloc, free
+#include <stdlib.h>
+// sysconf
+#include <unistd.h>
+
+// what a worker thread sweeps with
+struct crackWorkerArgs
+{
+	struct crackJob       *p_job;
+	// copy of the job probing the target tables on the worker's node (or the job itself)
+	struct crackJob       *p_nodeJob;
+	// hands out the slices, the worker owns deque number worker
+	struct sliceScheduler *p_scheduler;
+	unsigned int          worker;
+};
+
+// function prototypes
+static int runCrackJob(const struct targetSet      *p_targets,
+                       const struct keyspaceLayout *p_layout,
+                       char                        *p_results,
+                       unsigned int                numberOfThreads,
+                       struct checkpointState      *p_checkpoint,
+                       struct crackProgress        *p_progress,
+                       uint64_t                    firstCandidate,
+                       uint64_t                    endCandidate);
+static void *crackWorker(void *p_arg);
+static void updateProgress(struct crackJob *p_job,
+                           uint64_t        slice,
+                           int             isResumed);
+static uint64_t getNanoseconds(void);
+
+#ifdef CRACK_INSTRUMENT
+_Thread_local struct crackCounters crackThreadCounters;
+#endif
+// counters each worker thread of the last sweep left behind
+static struct crackCounters p_lastCounters[CRACK_MAX_THREADS];
+static atomic_uint          numberOfCounters;
+
+/**
+ * Function: crackHash
+ */
+int crackHash
+(
+    struct hash targetHash,
+    char        *p_result
+)
+{
+    return crackHashParallel(targetHash,
+                             p_result,
+                             1);
+}
+/**
+ * Function: crackHashParallel
+ */
+int crackHashParallel
+(
+    struct hash  targetHash,
+    char         *p_result,
+    unsigned int numberOfThreads
+)
+{
+    return crackHashes(&targetHash,
+                       1,
+                       p_result,
+                       numberOfThreads);
+}
+/**
+ * Function: crackHashes
+ */
+int crackHashes
+(
+    const struct hash *p_targets,
+    size_t            numberOfTargets,
+    char              *p_results,
+    unsigned int      numberOfThreads
+)
+{
+    int                   err;
+    char                  *p_keyspaceResults;
+    const struct keyspace keyspace = { CRACK_DEFAULT_CHARSET,
+                                       PREIMAGE_LENGTH_BYTE,
+                                       PREIMAGE_LENGTH_BYTE,
+                                       NULL,
+                                       { NULL } };
+    p_keyspaceResults = malloc(numberOfTargets * CRACK_RESULT_SIZE + 1);
+    if(p_keyspaceResults == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    // six lower-case letters are swept by the hand-tuned kernels
+    err = crackHashesInKeyspace(p_targets,
+                                numberOfTargets,
+                                &keyspace,
+                                p_keyspaceResults,
+                                numberOfThreads);
+    for(size_t i = 0; i < numberOfTargets; i++)
+        memcpy(p_results + i * PREIMAGE_LENGTH_BYTE,
+               p_keyspaceResults + i * CRACK_RESULT_SIZE,
+               PREIMAGE_LENGTH_BYTE);
+    free(p_keyspaceResults);
+
+    return err;
+}
+/**
+ * Function: crackHashesInKeyspace
+ */
+int crackHashesInKeyspace
+(
+    const struct hash     *p_targets,
+    size_t                numberOfTargets,
+    const struct keyspace *p_keyspace,
+    char                  *p_results,
+    unsigned int          numberOfThreads
+)
+{
+    return crackHashesWithCheckpoint(p_targets,
+                                     numberOfTargets,
+                                     p_keyspace,
+                                     p_results,
+                                     numberOfThreads,
+                                     NULL);
+}
+/**
+ * Function: crackHashRange
+ */
+int crackHashRange
+(
+    struct hash           targetHash,
+    uint64_t              firstCandidate,
+    uint64_t              endCandidate,
+    const struct keyspace *p_keyspace,
+    char                  *p_result,
+    unsigned int          numberOfThreads
+)
+{
+    return crackHashesInRange(&targetHash,
+                              1,
+                              firstCandidate,
+                              endCandidate,
+                              p_keyspace,
+                              p_result,
+                              numberOfThreads);
+}
+/**
+ * Function: crackHashesInRange
+ */
+int crackHashesInRange
+(
+    const struct hash     *p_targets,
+    size_t                numberOfTargets,
+    uint64_t              firstCandidate,
+    uint64_t              endCandidate,
+    const struct keyspace *p_keyspace,
+    char                  *p_results,
+    unsigned int          numberOfThreads
+)
+{
+    int                   err;
+    struct targetSet      targets;
+    struct keyspaceLayout layout;
+    err = initKeyspaceLayout(&layout,
+                             p_keyspace);
+    if(err != 0)
+        return err;
+    // candidates are addressed by their linear index (see getCandidatePreimage)
+    if(firstCandidate > endCandidate || endCandidate > getNumberOfCandidates(&layout))
+    {
+        freeKeyspaceLayout(&layout);
+        return E_CRACK_BAD_KEYSPACE;
+    }
+    err = initTargetSet(&targets,
+                        p_targets,
+                        numberOfTargets);
+    if(err != 0)
+    {
+        freeKeyspaceLayout(&layout);
+        return err;
+    }
+    err = runCrackJob(&targets,
+                      &layout,
+                      p_results,
+                      numberOfThreads,
+                      NULL,
+                      NULL,
+                      firstCandidate,
+                      endCandidate);
+    freeTargetSet(&targets);
+    freeKeyspaceLayout(&layout);
+
+    return err;
+}
+/**
+ * Function: crackHashesWithCheckpoint
+ */
+int crackHashesWithCheckpoint
+(
+    const struct hash       *p_targets,
+    size_t                  numberOfTargets,
+    const struct keyspace   *p_keyspace,
+    char                    *p_results,
+    unsigned int            numberOfThreads,
+    const struct checkpoint *p_checkpoint
+)
+{
+    return crackHashesWithProgress(p_targets,
+                                   numberOfTargets,
+                                   p_keyspace,
+                                   p_results,
+                                   numberOfThreads,
+                                   p_checkpoint,
+                                   NULL);
+}
+/**
+ * Function: crackHashesWithProgress
+ */
+int crackHashesWithProgress
+(
+    const struct hash       *p_targets,
+    size_t                  numberOfTargets,
+    const struct keyspace   *p_keyspace,
+    char                    *p_results,
+    unsigned int            numberOfThreads,
+    const struct checkpoint *p_checkpoint,
+    struct crackProgress    *p_progress
+)
+{
+    int                    err;
+    struct targetSet       targets;
+    struct keyspaceLayout  layout;
+    struct checkpointState checkpointState;
+    // derive slices, inner loop tables and padding of every length
+    err = initKeyspaceLayout(&layout,
+                             p_keyspace);
+    if(err != 0)
+        return err;
+    // build the lookup structure probed by the kernels
+    err = initTargetSet(&targets,
+                        p_targets,
+                        numberOfTargets);
+    if(err != 0)
+    {
+        freeKeyspaceLayout(&layout);
+        return err;
+    }
+    if(p_checkpoint == NULL)
+        err = runCrackJob(&targets,
+                          &layout,
+                          p_results,
+                          numberOfThreads,
+                          NULL,
+                          p_progress,
+                          0,
+                          getNumberOfCandidates(&layout));
+    // pick up where an interrupted sweep of the same targets and keyspace left off
+    else if((err = initCheckpointState(&checkpointState,
+                                       p_checkpoint,
+                                       &layout,
+                                       p_targets,
+                                       numberOfTargets,
+                                       layout.p_firstSlice[layout.maxLength + 1])) == 0)
+    {
+        err = runCrackJob(&targets,
+                          &layout,
+                          p_results,
+                          numberOfThreads,
+                          &checkpointState,
+                          p_progress,
+                          0,
+                          getNumberOfCandidates(&layout));
+        // once the sweep is done, the checkpoint is not needed anymore; after an error it is kept for the next attempt
+        freeCheckpointState(&checkpointState,
+                            err == 0 || err == E_CRACK_NOT_FOUND);
+    }
+    freeTargetSet(&targets);
+    freeKeyspaceLayout(&layout);
+
+    return err;
+}
+/**
+ * Function: getCrackCounters
+ */
+unsigned int getCrackCounters
+(
+    struct crackCounters *p_counters,
+    unsigned int         maxThreads
+)
+{
+    unsigned int numberOfThreads = atomic_load(&numberOfCounters);
+    // nothing is counted without CRACK_INSTRUMENT
+    if(numberOfThreads > CRACK_MAX_THREADS)
+        numberOfThreads = CRACK_MAX_THREADS;
+    if(numberOfThreads > maxThreads)
+        numberOfThreads = maxThreads;
+    memcpy(p_counters,
+           p_lastCounters,
+           numberOfThreads * sizeof(struct crackCounters));
+
+    return numberOfThreads;
+}
+/**
+ * Function: reportCandidate
+ */
+void reportCandidate
+(
+    struct crackJob *p_job,
+    const uint32_t  *p_state,
+    const char      *p_preimage,
+    unsigned int    length
+)
+{
+    unsigned char          expected;
+    uint64_t               index;
+    const struct targetSet *p_set  = p_job->p_targets;
+    uint32_t               key     = getEarlyExitKey(p_state),
+                           first   = p_set->p_directory[key >> p_set->directoryShift],
+                           last    = p_set->p_directory[(key >> p_set->directoryShift) + 1];
+    const uint32_t         *p_curr;
+    COUNT(reported, 1);
+    // compare the full state against every target sharing the early exit value
+    for(uint32_t i = first; i < last; i++)
+    {
+        if(p_set->p_keys[i] != key)
+            continue;
+        p_curr = p_set->p_entries[i].p_state;
+        if(p_curr[0] != p_state[0] || p_curr[1] != p_state[1] || p_curr[2] != p_state[2]
+           || p_curr[3] != p_state[3] || p_curr[4] != p_state[4])
+            continue;
+        // confirm the preimage with a full SHA-1, independent of the kernel
+        if(sha1Verify(p_preimage, length, &p_set->p_entries[i].target) != 0)
+            continue;
+        COUNT(matched, 1);
+        // a range ignores candidates of its border slices that lie outside
+        if(p_job->p_rangeLayout != NULL)
+        {
+            index = getPreimageIndex(p_job->p_rangeLayout,
+                                     p_preimage,
+                                     length);
+            if(index < p_job->firstCandidate || index >= p_job->endCandidate)
+                continue;
+        }
+        // only the first worker to find a preimage gets to write it
+        expected = 0;
+        if(atomic_compare_exchange_strong(&p_job->p_found[p_set->p_entries[i].index],
+                                          &expected,
+                                          1))
+        {
+            memcpy(p_job->p_results + p_set->p_entries[i].index * p_job->resultSize,
+                   p_preimage,
+                   length);
+            p_job->p_results[p_set->p_entries[i].index * p_job->resultSize + length] = '\0';
+            atomic_store(&p_job->p_found[p_set->p_entries[i].index],
+                         CRACK_FOUND_WRITTEN);
+            atomic_fetch_add(&p_job->numberOfFound,
+                             1);
+        }
+    }
+}
+/**
+ * Function: runCrackJob
+ */
+static int runCrackJob
+(
+    const struct targetSet      *p_targets,
+    const struct keyspaceLayout *p_layout,
+    char                        *p_results,
+    unsigned int                numberOfThreads,
+    struct checkpointState      *p_checkpoint,
+    struct crackProgress        *p_progress,
+    uint64_t                    firstCandidate,
+    uint64_t                    endCandidate
+)
+{
+    unsigned int           numberOfStarted  = 0,
+                           numberOfReplicas = 0,
+                           numberOfCores,
+                           p_coreReplicas[CRACK_MAX_THREADS];
+    uint64_t               firstSlice       = 0,
+                           resumed;
+    int                    isClaimed,
+                           isPlaced;
+    struct sliceScheduler  scheduler;
+    pthread_t              p_threads[CRACK_MAX_THREADS];
+    struct placedThread    p_placed[CRACK_MAX_THREADS];
+    struct crackWorkerArgs p_workers[CRACK_MAX_THREADS];
+    struct crackTopology   topology;
+    struct targetSet       p_nodeTargets[CRACK_MAX_NODES];
+    struct crackJob        job,
+                           p_nodeJobs[CRACK_MAX_NODES];
+    // workers are pinned to one physical core each, unless placement is off, taken by another sweep or /sys can't be read
+    isClaimed = (claimCrackPlacement() == 0);
+    isPlaced  = isClaimed && getCrackTopology(&topology) == 0;
+    // zero threads means one thread per physical core (per online core without placement)
+    if(numberOfThreads == 0)
+        numberOfThreads = isPlaced ? topology.numberOfCores : (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+    if(numberOfThreads == 0)
+        numberOfThreads = 1;
+    if(numberOfThreads > CRACK_MAX_THREADS)
+        numberOfThreads = CRACK_MAX_THREADS;
+    // initialize the job shared by all workers
+    job.p_targets  = p_targets;
+    job.p_results  = p_results;
+    job.resultSize = CRACK_RESULT_SIZE;
+    // the hand-tuned kernels cover the default keyspace, the generic ones the rest
+    if(p_layout->isDefault)
+    {
+        job.p_layout       = NULL;
+        job.crackSlice     = crackSlice;
+        job.numberOfSlices = CRACK_NUMBER_OF_SLICES;
+    }
+    else
+    {
+        job.p_layout       = p_layout;
+        job.crackSlice     = crackSliceGeneric;
+        job.numberOfSlices = p_layout->p_firstSlice[p_layout->maxLength + 1];
+    }
+    job.p_checkpoint   = p_checkpoint;
+    job.firstCandidate = firstCandidate;
+    job.endCandidate   = endCandidate;
+    job.p_rangeLayout  = NULL;
+    job.p_progress     = p_progress;
+    job.p_sweptLayout  = p_layout;
+    /*
+     *  A range only sweeps the slices it overlaps. Slices at its borders are
+     *  swept completely, so reported candidates are checked against the range.
+     */
+    if(firstCandidate > 0 || endCandidate < getNumberOfCandidates(p_layout))
+    {
+        job.p_rangeLayout  = p_layout;
+        job.numberOfSlices = 0;
+        if(endCandidate > firstCandidate)
+        {
+            job.numberOfSlices = getCandidateSlice(p_layout, endCandidate - 1) + 1;
+            firstSlice         = getCandidateSlice(p_layout, firstCandidate);
+        }
+    }
+    job.p_found = calloc(p_targets->numberOfTargets + 1, sizeof(atomic_uchar));
+    if(job.p_found == NULL)
+    {
+        if(isClaimed)
+            releaseCrackPlacement();
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    atomic_init(&job.numberOfFound, 0);
+    atomic_init(&job.nextSlice, firstSlice);
+    atomic_store(&numberOfCounters,
+                 0);
+    // pick up where an interrupted sweep of the same targets and keyspace left off
+    if(p_checkpoint != NULL && restoreCheckpoint(p_checkpoint, &job) != 0)
+    {
+        free(job.p_found);
+        if(isClaimed)
+            releaseCrackPlacement();
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    if(p_progress != NULL)
+    {
+        // slices below the restored outer loop position are never handed out
+        resumed = getSliceCandidate(p_layout, atomic_load(&job.nextSlice))
+                  - getSliceCandidate(p_layout, firstSlice);
+        p_progress->numberOfCandidates = endCandidate - firstCandidate;
+        p_progress->startNanoseconds   = getNanoseconds();
+        atomic_store(&p_progress->candidatesTested, resumed);
+        atomic_store(&p_progress->candidatesResumed, resumed);
+        atomic_store(&p_progress->hashesPerSecond, 0);
+        atomic_store(&p_progress->secondsRemaining, 0);
+    }
+    /*
+     *  The workers steal slice ranges from each other, so cores that are done
+     *  early take over the tail of the sweep. A checkpointed sweep shares a
+     *  slice counter instead: its completed slices are listed until all slices
+     *  below are done, which only stays short while slices finish in order.
+     */
+    initSliceScheduler(&scheduler,
+                       numberOfThreads,
+                       atomic_load(&job.nextSlice),
+                       job.numberOfSlices,
+                       getCrackStealing() && p_checkpoint == NULL);
+    for(unsigned int i = 0; i < numberOfThreads; i++)
+    {
+        p_workers[i].p_job       = &job;
+        p_workers[i].p_nodeJob   = &job;
+        p_workers[i].p_scheduler = &scheduler;
+        p_workers[i].worker      = i;
+    }
+    /*
+     *  Once the cores of a sweep span more than one node, every node gets a
+     *  copy of the target tables and a job probing it. Node jobs share found
+     *  flags and results with the job, the targets they found are moved to the
+     *  job after every slice (see crackWorker). If a copy fails, all workers
+     *  simply probe the tables of the job.
+     */
+    numberOfCores = 0;
+    if(isPlaced)
+        numberOfCores = (numberOfThreads < topology.numberOfCores) ? numberOfThreads : topology.numberOfCores;
+    if(numberOfCores > 0 && topology.p_nodes[0] != topology.p_nodes[numberOfCores - 1])
+    {
+        for(unsigned int i = 0; i < numberOfCores; i++)
+        {
+            if(i > 0 && topology.p_nodes[i] == topology.p_nodes[i - 1])
+            {
+                p_coreReplicas[i] = numberOfReplicas - 1;
+                continue;
+            }
+            if(initNodeTargetSet(&p_nodeTargets[numberOfReplicas], p_targets,
+                                 topology.p_cpus[i], topology.p_nodes[i]) != 0)
+            {
+                while(numberOfReplicas > 0)
+                    freeNodeTargetSet(&p_nodeTargets[--numberOfReplicas]);
+                break;
+            }
+            p_nodeJobs[numberOfReplicas]              = job;
+            p_nodeJobs[numberOfReplicas].p_targets    = &p_nodeTargets[numberOfReplicas];
+            p_nodeJobs[numberOfReplicas].p_checkpoint = NULL;
+            p_nodeJobs[numberOfReplicas].p_progress   = NULL;
+            atomic_init(&p_nodeJobs[numberOfReplicas].numberOfFound, 0);
+            p_coreReplicas[i] = numberOfReplicas++;
+        }
+        for(unsigned int i = 0; i < numberOfThreads && numberOfReplicas > 0; i++)
+            p_workers[i].p_nodeJob = &p_nodeJobs[p_coreReplicas[i % numberOfCores]];
+    }
+    if(isPlaced)
+    {
+        /*
+         *  Placed workers all run on threads of their own, pinned to the cores
+         *  in turn, and the calling thread only waits for them. If starting a
+         *  thread fails, the remaining workers pick up its share of the slices.
+         */
+        for(unsigned int i = 0; i < numberOfThreads; i++)
+            if(startPlacedThread(&p_placed[numberOfStarted],
+                                 crackWorker,
+                                 &p_workers[i],
+                                 topology.p_cpus[i % topology.numberOfCores],
+                                 topology.p_nodes[i % topology.numberOfCores]) == 0)
+                numberOfStarted++;
+        if(numberOfStarted == 0)
+            crackWorker(&p_workers[0]);
+        for(unsigned int i = 0; i < numberOfStarted; i++)
+            joinPlacedThread(&p_placed[i]);
+        while(numberOfReplicas > 0)
+            freeNodeTargetSet(&p_nodeTargets[--numberOfReplicas]);
+    }
+    else
+    {
+        /*
+         *  The calling thread works on the job as well, so only numberOfThreads - 1
+         *  additional threads are started. If starting a thread fails, the remaining
+         *  workers simply pick up its share of the slices.
+         */
+        while(numberOfStarted < numberOfThreads - 1)
+        {
+            if(pthread_create(&p_threads[numberOfStarted],
+                              NULL,
+                              crackWorker,
+                              &p_workers[numberOfStarted + 1]) != 0)
+                break;
+            numberOfStarted++;
+        }
+        crackWorker(&p_workers[0]);
+        for(unsigned int i = 0; i < numberOfStarted; i++)
+            pthread_join(p_threads[i],
+                         NULL);
+    }
+    freeSliceScheduler(&scheduler);
+    if(isClaimed)
+        releaseCrackPlacement();
+    // clear the results of all targets that were not found
+    for(size_t i = 0; i < p_targets->numberOfTargets; i++)
+        if(!atomic_load(&job.p_found[i]))
+            memset(p_results + i * CRACK_RESULT_SIZE,
+                   0,
+                   CRACK_RESULT_SIZE);
+    free(job.p_found);
+    // if a target is left over, the keyspace is exhausted
+    if(atomic_load(&job.numberOfFound) < p_targets->numberOfTargets)
+        return E_CRACK_NOT_FOUND;
+
+    return 0;
+}
+/**
+ * Function: crackWorker
+ */
+static void *crackWorker
+(
+    void *p_arg
+)
+{
+    uint64_t               slice;
+    struct crackWorkerArgs *p_worker   = p_arg;
+    struct crackJob        *p_job      = p_worker->p_job,
+                           *p_sliceJob = p_worker->p_nodeJob;
+    // grab slices until the keyspace is exhausted or all targets were found
+    while(atomic_load_explicit(&p_job->numberOfFound, memory_order_relaxed)
+          < p_job->p_targets->numberOfTargets)
+    {
+        if(getNextSlice(p_worker->p_scheduler, p_worker->worker, &slice) != 0)
+            break;
+        /*
+         *  Slices completed before the sweep was resumed are skipped, or only
+         *  swept for the targets that were added since (see getSliceJob).
+         */
+        if(p_job->p_checkpoint != NULL
+           && (p_sliceJob = getSliceJob(p_job->p_checkpoint, p_job, slice)) == NULL)
+        {
+            if(p_job->p_progress != NULL)
+                updateProgress(p_job,
+                               slice,
+                               1);
+            continue;
+        }
+        // the job's own targets are probed in the tables on this worker's node
+        if(p_job->p_checkpoint == NULL || p_sliceJob == p_job)
+            p_sliceJob = p_worker->p_nodeJob;
+        CYCLES_START(sliceStart);
+        p_sliceJob->crackSlice(p_sliceJob,
+                               slice);
+        CYCLES_STOP(sliceCycles, sliceStart);
+        COUNT(slices, 1);
+        // found flags and results are shared, the targets found are counted by the job itself
+        if(p_sliceJob != p_job)
+            atomic_fetch_add(&p_job->numberOfFound,
+                             atomic_exchange(&p_sliceJob->numberOfFound, 0));
+        // a kernel leaves its slice early once all targets are found
+        if(p_job->p_checkpoint != NULL
+           && atomic_load(&p_job->numberOfFound) < p_job->p_targets->numberOfTargets)
+            completeSlice(p_job,
+                          slice);
+        // progress is only reported between slices, so the kernels are not slowed down
+        if(p_job->p_progress != NULL)
+            updateProgress(p_job,
+                           slice,
+                           0);
+    }
+    // the other workers don't wait for slices this worker kept to itself
+    leaveSliceScheduler(p_worker->p_scheduler,
+                        p_worker->worker);
+#ifdef CRACK_INSTRUMENT
+    // leave the counters of this thread for getCrackCounters
+    slice = atomic_fetch_add(&numberOfCounters, 1);
+    if(slice < CRACK_MAX_THREADS)
+        p_lastCounters[slice] = crackThreadCounters;
+    memset(&crackThreadCounters,
+           0,
+           sizeof(struct crackCounters));
+#endif
+
+    return NULL;
+}
+/**
+ * Function: updateProgress
+ */
+static void updateProgress
+(
+    struct crackJob *p_job,
+    uint64_t        slice,
+    int             isResumed
+)
+{
+    struct crackProgress *p_progress = p_job->p_progress;
+    uint64_t             first       = getSliceCandidate(p_job->p_sweptLayout, slice),
+                         end         = getSliceCandidate(p_job->p_sweptLayout, slice + 1),
+                         tested,
+                         swept,
+                         elapsed,
+                         rate;
+    // border slices of a range only count the candidates inside it
+    if(first < p_job->firstCandidate)
+        first = p_job->firstCandidate;
+    if(end > p_job->endCandidate)
+        end = p_job->endCandidate;
+    tested = atomic_fetch_add(&p_progress->candidatesTested, end - first) + (end - first);
+    if(isResumed)
+    {
+        atomic_fetch_add(&p_progress->candidatesResumed,
+                         end - first);
+        return;
+    }
+    // the rate only covers what this sweep did itself
+    swept   = atomic_load(&p_progress->candidatesResumed);
+    swept   = (tested > swept) ? tested - swept : 0;
+    elapsed = getNanoseconds() - p_progress->startNanoseconds;
+    rate    = (elapsed > 0) ? (uint64_t) ((double) swept * 1e9 / (double) elapsed) : 0;
+    atomic_store(&p_progress->hashesPerSecond,
+                 rate);
+    atomic_store(&p_progress->secondsRemaining,
+                 (rate > 0) ? (p_progress->numberOfCandidates - tested) / rate : 0);
+    if(p_progress->callback != NULL)
+        p_progress->callback(p_progress,
+                             p_progress->p_context);
+}
+/**
+ * Function: getNanoseconds
+ */
+static uint64_t getNanoseconds
+(
+    void
+)
+{
+    struct timespec now;
+    // monotonic, so the rate survives changes of the wall clock
+    clock_gettime(CLOCK_MONOTONIC,
+                  &now);
+
+    return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
@@ -0,0 +1,221 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// malloc, realloc, free
+#include <stdlib.h>
+
+// macros for the ASCII case conversions of the rules
+#define IS_LOWER(c)  ((c) >= 'a' && (c) <= 'z')
+#define IS_UPPER(c)  ((c) >= 'A' && (c) <= 'Z')
+#define TO_LOWER(c)  (IS_UPPER(c) ? (char) ((c) + ('a' - 'A')) : (c))
+#define TO_UPPER(c)  (IS_LOWER(c) ? (char) ((c) - ('a' - 'A')) : (c))
+#define TOGGLE(c)    (IS_LOWER(c) ? TO_UPPER(c) : TO_LOWER(c))
+
+// function prototypes
+static int parseRule(const char       *p_line,
+                     size_t           length,
+                     struct crackRule *p_rule);
+static unsigned int getNumberOfOperands(char function);
+
+/**
+ * Function: parseRules
+ */
+int parseRules
+(
+    const char       *p_text,
+    struct crackRule **pp_rules,
+    size_t           *p_numberOfRules
+)
+{
+    int              err;
+    size_t           numberOfRules = 0,
+                     capacity      = 0,
+                     length;
+    const char       *p_lineEnd;
+    struct crackRule *p_rules      = NULL,
+                     *p_grown;
+    // one rule per line, empty lines and comments are skipped
+    while(*p_text != '\0')
+    {
+        p_lineEnd = strchr(p_text,
+                           '\n');
+        length    = (p_lineEnd != NULL) ? (size_t) (p_lineEnd - p_text) : strlen(p_text);
+        if(length > 0 && p_text[length - 1] == '\r')
+            length--;
+        if(length > 0 && p_text[0] != '#')
+        {
+            if(numberOfRules == capacity)
+            {
+                capacity = (capacity == 0) ? 16 : 2 * capacity;
+                p_grown  = realloc(p_rules,
+                                   capacity * sizeof(struct crackRule));
+                if(p_grown == NULL)
+                {
+                    free(p_rules);
+                    return E_CRACK_OUT_OF_MEMORY;
+                }
+                p_rules = p_grown;
+            }
+            if((err = parseRule(p_text, length, &p_rules[numberOfRules])) != 0)
+            {
+                free(p_rules);
+                return err;
+            }
+            numberOfRules++;
+        }
+        if(p_lineEnd == NULL)
+            break;
+        p_text = p_lineEnd + 1;
+    }
+    *pp_rules        = p_rules;
+    *p_numberOfRules = numberOfRules;
+
+    return 0;
+}
+/**
+ * Function: applyRule
+ */
+unsigned int applyRule
+(
+    const struct crackRule *p_rule,
+    const char             *p_word,
+    unsigned int           length,
+    char                   *p_output
+)
+{
+    char         temp;
+    const char   *p_curr = p_rule->p_functions,
+                 *p_end  = p_rule->p_functions + p_rule->length;
+    memcpy(p_output,
+           p_word,
+           length);
+    // the functions are applied from left to right on CRACK_MAX_WORD_LENGTH bytes at most
+    while(p_curr < p_end)
+    {
+        switch(*p_curr)
+        {
+            case 'l':
+                for(unsigned int i = 0; i < length; i++)
+                    p_output[i] = TO_LOWER(p_output[i]);
+                break;
+            case 'u':
+                for(unsigned int i = 0; i < length; i++)
+                    p_output[i] = TO_UPPER(p_output[i]);
+                break;
+            case 'c':
+                for(unsigned int i = 1; i < length; i++)
+                    p_output[i] = TO_LOWER(p_output[i]);
+                if(length > 0)
+                    p_output[0] = TO_UPPER(p_output[0]);
+                break;
+            case 't':
+                for(unsigned int i = 0; i < length; i++)
+                    p_output[i] = TOGGLE(p_output[i]);
+                break;
+            case 'r':
+                for(unsigned int i = 0; i < length / 2; i++)
+                {
+                    temp                     = p_output[i];
+                    p_output[i]              = p_output[length - 1 - i];
+                    p_output[length - 1 - i] = temp;
+                }
+                break;
+            case 'd':
+                if(2 * length > CRACK_MAX_WORD_LENGTH)
+                    return CRACK_RULE_REJECTED;
+                memcpy(p_output + length,
+                       p_output,
+                       length);
+                length *= 2;
+                break;
+            case '$':
+                if(length == CRACK_MAX_WORD_LENGTH)
+                    return CRACK_RULE_REJECTED;
+                p_output[length++] = p_curr[1];
+                break;
+            case '^':
+                if(length == CRACK_MAX_WORD_LENGTH)
+                    return CRACK_RULE_REJECTED;
+                memmove(p_output + 1,
+                        p_output,
+                        length++);
+                p_output[0] = p_curr[1];
+                break;
+            case 's':
+                for(unsigned int i = 0; i < length; i++)
+                    if(p_output[i] == p_curr[1])
+                        p_output[i] = p_curr[2];
+                break;
+        }
+        p_curr += 1 + getNumberOfOperands(*p_curr);
+    }
+
+    return length;
+}
+/**
+ * Function: parseRule
+ */
+static int parseRule
+(
+    const char       *p_line,
+    size_t           length,
+    struct crackRule *p_rule
+)
+{
+    unsigned int numberOfOperands;
+    p_rule->length    = 0;
+    p_rule->keepsWord = 1;
+    for(size_t i = 0; i < length; i += 1 + numberOfOperands)
+    {
+        numberOfOperands = 0;
+        // spaces separate functions, ':' leaves the word as it is
+        if(p_line[i] == ' ' || p_line[i] == ':')
+            continue;
+        if(strchr("luctrd$^s", p_line[i]) == NULL)
+            return E_CRACK_BAD_RULE;
+        numberOfOperands = getNumberOfOperands(p_line[i]);
+        if(i + numberOfOperands >= length
+           || p_rule->length + 1 + numberOfOperands > CRACK_MAX_RULE_LENGTH)
+            return E_CRACK_BAD_RULE;
+        memcpy(p_rule->p_functions + p_rule->length,
+               p_line + i,
+               1 + numberOfOperands);
+        p_rule->length += 1 + numberOfOperands;
+        // appending or repeating the word leaves it at the front
+        if(p_line[i] != '$' && p_line[i] != 'd')
+            p_rule->keepsWord = 0;
+    }
+
+    return 0;
+}
+/**
+ * Function: getNumberOfOperands
+ */
+static unsigned int getNumberOfOperands
+(
+    char function
+)
+{
+    switch(function)
+    {
+        case '$':
+        case '^': return 1;
+        case 's': return 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,320 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// sched_yield
+#include <sched.h>
+// getenv, aligned_alloc, free
+#include <stdlib.h>
+
+// function prototypes
+static void initCrackStealing(void) __attribute__((constructor));
+static int pushRange(struct sliceDeque *p_deque,
+                     uint64_t          first,
+                     uint64_t          end);
+static int takeRange(struct sliceDeque *p_deque,
+                     uint64_t          *p_first,
+                     uint64_t          *p_end);
+static int stealRange(struct sliceDeque *p_deque,
+                      uint64_t          *p_first,
+                      uint64_t          *p_end);
+
+// balance the slices of a sweep by work stealing (unless CRACK_STEALING_ENV is "off")
+static int isStealingEnabled = 1;
+
+/**
+ * Function: setCrackStealing
+ */
+void setCrackStealing
+(
+    int isEnabled
+)
+{
+    isStealingEnabled = isEnabled;
+}
+/**
+ * Function: getCrackStealing
+ */
+int getCrackStealing
+(
+    void
+)
+{
+    return isStealingEnabled;
+}
+/**
+ * Function: initSliceScheduler
+ */
+void initSliceScheduler
+(
+    struct sliceScheduler *p_scheduler,
+    unsigned int          numberOfWorkers,
+    uint64_t              firstSlice,
+    uint64_t              endSlice,
+    int                   isStealing
+)
+{
+    uint64_t numberOfSlices = (endSlice > firstSlice) ? endSlice - firstSlice : 0;
+    p_scheduler->p_deques        = NULL;
+    p_scheduler->numberOfWorkers = numberOfWorkers;
+    p_scheduler->endSlice        = endSlice;
+    atomic_init(&p_scheduler->nextSlice, firstSlice);
+    atomic_init(&p_scheduler->pendingSlices, numberOfSlices);
+    // without deques, the workers simply share the counter
+    if(!isStealing || numberOfWorkers < 2)
+        return;
+    p_scheduler->p_deques = aligned_alloc(64,
+                                          numberOfWorkers * sizeof(struct sliceDeque));
+    if(p_scheduler->p_deques == NULL)
+        return;
+    /*
+     *  Every worker starts with an equal share of the slices in its deque,
+     *  workers that are done early steal the rest.
+     */
+    for(unsigned int i = 0; i < numberOfWorkers; i++)
+    {
+        atomic_init(&p_scheduler->p_deques[i].top, 0);
+        atomic_init(&p_scheduler->p_deques[i].bottom, 0);
+        p_scheduler->p_deques[i].localFirst = 0;
+        p_scheduler->p_deques[i].localEnd   = 0;
+        pushRange(&p_scheduler->p_deques[i],
+                  firstSlice + (uint64_t) ((unsigned __int128) numberOfSlices * i / numberOfWorkers),
+                  firstSlice + (uint64_t) ((unsigned __int128) numberOfSlices * (i + 1) / numberOfWorkers));
+    }
+}
+/**
+ * Function: getNextSlice
+ */
+int getNextSlice
+(
+    struct sliceScheduler *p_scheduler,
+    unsigned int          worker,
+    uint64_t              *p_slice
+)
+{
+    uint64_t          first,
+                      end;
+    unsigned int      victim;
+    struct sliceDeque *p_deque;
+    if(p_scheduler->p_deques == NULL)
+    {
+        *p_slice = atomic_fetch_add(&p_scheduler->nextSlice,
+                                    1);
+
+        return (*p_slice < p_scheduler->endSlice) ? 0 : 1;
+    }
+    p_deque = &p_scheduler->p_deques[worker];
+    // slices kept back from a full deque come first
+    if(p_deque->localFirst < p_deque->localEnd)
+    {
+        atomic_fetch_sub(&p_scheduler->pendingSlices,
+                         1);
+        *p_slice = p_deque->localFirst++;
+
+        return 0;
+    }
+    /*
+     *  Once its own deque is empty, a worker steals from the others, starting
+     *  with its neighbours (with placement, mostly cores of the same node). A
+     *  range that is being split is out of reach for a moment, so the workers
+     *  keep trying until every slice is handed out.
+     */
+    while(takeRange(p_deque, &first, &end) != 0)
+    {
+        for(victim = 1; victim < p_scheduler->numberOfWorkers; victim++)
+            if(stealRange(&p_scheduler->p_deques[(worker + victim) % p_scheduler->numberOfWorkers],
+                          &first,
+                          &end) == 0)
+                break;
+        if(victim < p_scheduler->numberOfWorkers)
+        {
+            COUNT(steals, 1);
+            break;
+        }
+        if(atomic_load(&p_scheduler->pendingSlices) == 0)
+            return 1;
+        sched_yield();
+    }
+    /*
+     *  Ranges are split lazily: the worker keeps the first slice and pushes the
+     *  upper halves back, largest first. A thief takes the largest piece left,
+     *  half of what the worker had, and the worker sweeps its slices in order.
+     *  Every half is smaller than the range below it, so the deque should never
+     *  fill. If it does, the worker keeps the rest of the range to itself.
+     */
+    while(end - first > 1)
+    {
+        if(pushRange(p_deque, first + (end - first) / 2, end) != 0)
+        {
+            p_deque->localFirst = first + 1;
+            p_deque->localEnd   = end;
+            break;
+        }
+        end = first + (end - first) / 2;
+    }
+    atomic_fetch_sub(&p_scheduler->pendingSlices,
+                     1);
+    *p_slice = first;
+
+    return 0;
+}
+/**
+ * Function: leaveSliceScheduler
+ */
+void leaveSliceScheduler
+(
+    struct sliceScheduler *p_scheduler,
+    unsigned int          worker
+)
+{
+    struct sliceDeque *p_deque;
+    if(p_scheduler->p_deques == NULL)
+        return;
+    /*
+     *  Slices kept back from a full deque can't be stolen. A worker that stops
+     *  early (e.g. once all targets are found) gives them up, otherwise the
+     *  others would keep waiting for them to be handed out.
+     */
+    p_deque = &p_scheduler->p_deques[worker];
+    if(p_deque->localFirst < p_deque->localEnd)
+        atomic_fetch_sub(&p_scheduler->pendingSlices,
+                         p_deque->localEnd - p_deque->localFirst);
+    p_deque->localFirst = p_deque->localEnd;
+}
+/**
+ * Function: freeSliceScheduler
+ */
+void freeSliceScheduler
+(
+    struct sliceScheduler *p_scheduler
+)
+{
+    free(p_scheduler->p_deques);
+    p_scheduler->p_deques = NULL;
+}
+/**
+ * Function: initCrackStealing
+ */
+static void initCrackStealing
+(
+    void
+)
+{
+    const char *p_override = getenv(CRACK_STEALING_ENV);
+    // e.g. to compare against the shared slice counter
+    if(p_override != NULL && strcmp(p_override, "off") == 0)
+        isStealingEnabled = 0;
+}
+/**
+ * Function: pushRange
+ */
+static int pushRange
+(
+    struct sliceDeque *p_deque,
+    uint64_t          first,
+    uint64_t          end
+)
+{
+    int_fast64_t bottom = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed),
+                 top    = atomic_load_explicit(&p_deque->top, memory_order_acquire);
+    // the slot of a range is only reused once it was taken
+    if(first >= end || bottom - top >= CRACK_DEQUE_SIZE)
+        return 1;
+    atomic_store_explicit(&p_deque->p_first[bottom % CRACK_DEQUE_SIZE],
+                          first,
+                          memory_order_relaxed);
+    atomic_store_explicit(&p_deque->p_end[bottom % CRACK_DEQUE_SIZE],
+                          end,
+                          memory_order_relaxed);
+    // thieves that see the new bottom see the range as well
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&p_deque->bottom,
+                          bottom + 1,
+                          memory_order_relaxed);
+
+    return 0;
+}
+/**
+ * Function: takeRange
+ */
+static int takeRange
+(
+    struct sliceDeque *p_deque,
+    uint64_t          *p_first,
+    uint64_t          *p_end
+)
+{
+    int          result = 0;
+    int_fast64_t bottom = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed) - 1,
+                 top;
+    /*
+     *  Claim the bottom range before looking at top, a thief either sees the
+     *  lowered bottom or wins the range in the race for the last one below.
+     */
+    atomic_store_explicit(&p_deque->bottom,
+                          bottom,
+                          memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&p_deque->top, memory_order_relaxed);
+    if(top > bottom)
+    {
+        atomic_store_explicit(&p_deque->bottom,
+                              bottom + 1,
+                              memory_order_relaxed);
+        return 1;
+    }
+    *p_first = atomic_load_explicit(&p_deque->p_first[bottom % CRACK_DEQUE_SIZE], memory_order_relaxed);
+    *p_end   = atomic_load_explicit(&p_deque->p_end[bottom % CRACK_DEQUE_SIZE], memory_order_relaxed);
+    if(top == bottom)
+    {
+        if(!atomic_compare_exchange_strong_explicit(&p_deque->top,
+                                                    &top,
+                                                    top + 1,
+                                                    memory_order_seq_cst,
+                                                    memory_order_relaxed))
+            result = 1;
+        atomic_store_explicit(&p_deque->bottom,
+                              bottom + 1,
+                              memory_order_relaxed);
+    }
+
+    return result;
+}
+/**
+ * Function: stealRange
+ */
+static int stealRange
+(
+    struct sliceDeque *p_deque,
+    uint64_t          *p_first,
+    uint64_t          *p_end
+)
+{
+    int_fast64_t top    = atomic_load_explicit(&p_deque->top, memory_order_acquire),
+                 bottom;
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&p_deque->bottom, memory_order_acquire);
+    if(top >= bottom)
+        return 1;
+    *p_first = atomic_load_explicit(&p_deque->p_first[top % CRACK_DEQUE_SIZE], memory_order_relaxed);
+    *p_end   = atomic_load_explicit(&p_deque->p_end[top % CRACK_DEQUE_SIZE], memory_order_relaxed);
+    // the range only belongs to the thief if nobody took it in the meantime
+    return atomic_compare_exchange_strong_explicit(&p_deque->top,
+                                                   &top,
+                                                   top + 1,
+                                                   memory_order_seq_cst,
+                                                   memory_order_relaxed) ? 0 : 1;
+}
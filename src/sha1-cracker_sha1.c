@@ -0,0 +1,290 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+// constants for k-values of rounds 0 - 79
+#define K_00_19              UINT32_C(0x5A827999)
+#define K_20_39              UINT32_C(0x6ED9EBA1)
+#define K_40_59              UINT32_C(0x8F1BBCDC)
+#define K_60_79              UINT32_C(0xCA62C1D6)
+// bytes per message block
+#define SHA1_BLOCK_SIZE      64
+
+// macros for f-functions of rounds 0 - 79
+#define F_00_19(mB, mC, mD) (mD ^ (mB & (mC ^ mD)))
+#define F_20_39(mB, mC, mD) (mB ^ mC ^ mD)
+#define F_40_59(mB, mC, mD) ((mB & mC) | (mD & (mB | mC)))
+#define F_60_79(mB, mC, mD) (mB ^ mC ^ mD)
+// macro for circular left-shift of a 32-bit word (taken from RFC 3174)
+#define LEFT_ROTATE(word, bits) (((word) << (bits)) | ((word) >> (32 - (bits))))
+// macro for the word block of round i, expanded in place
+#define EXPAND(i)                                                                      \
+    (p_blocks[(i) & 15] = LEFT_ROTATE(p_blocks[((i) - 3) & 15] ^ p_blocks[((i) - 8) & 15] \
+                                      ^ p_blocks[((i) - 14) & 15] ^ p_blocks[(i) & 15], 1))
+// macro for one round
+#define ROUND(f, k, w)                                \
+    temp = (f) + (k) + LEFT_ROTATE(a, 5) + e + (w);   \
+    e    = d;                                         \
+    d    = c;                                         \
+    c    = LEFT_ROTATE(b, 30);                        \
+    b    = a;                                         \
+    a    = temp;
+
+/**
+ * Function: sha1
+ */
+void sha1
+(
+    const void  *p_data,
+    size_t      length,
+    struct hash *p_digest
+)
+{
+    const unsigned char *p_bytes                    = p_data;
+    unsigned char       p_tail[2 * SHA1_BLOCK_SIZE] = { 0 };
+    size_t              numberOfFull                = length / SHA1_BLOCK_SIZE,
+                        tailLength                  = length % SHA1_BLOCK_SIZE,
+                        numberOfTail                = (tailLength < SHA1_BLOCK_SIZE - 8) ? 1 : 2;
+    uint64_t            bits                        = (uint64_t) length << 3;
+    uint32_t            p_state[5]                  = { SHA1_IV_0, SHA1_IV_1, SHA1_IV_2, SHA1_IV_3, SHA1_IV_4 };
+    // whole blocks are compressed in place, only the padded tail is copied
+    if(numberOfFull > 0)
+        sha1Blocks(p_state,
+                   p_bytes,
+                   numberOfFull);
+    memcpy(p_tail,
+           p_bytes + numberOfFull * SHA1_BLOCK_SIZE,
+           tailLength);
+    p_tail[tailLength] = 0x80;
+    for(unsigned int i = 0; i < 8; i++)
+        p_tail[numberOfTail * SHA1_BLOCK_SIZE - 1 - i] = (unsigned char) (bits >> (8 * i));
+    sha1Blocks(p_state,
+               p_tail,
+               numberOfTail);
+    p_digest->a = p_state[0];
+    p_digest->b = p_state[1];
+    p_digest->c = p_state[2];
+    p_digest->d = p_state[3];
+    p_digest->e = p_state[4];
+}
+/**
+ * Function: sha1Verify
+ */
+int sha1Verify
+(
+    const void        *p_data,
+    size_t            length,
+    const struct hash *p_expected
+)
+{
+    struct hash digest;
+    sha1(p_data,
+         length,
+         &digest);
+    if(digest.a != p_expected->a || digest.b != p_expected->b || digest.c != p_expected->c
+       || digest.d != p_expected->d || digest.e != p_expected->e)
+        return E_CRACK_NOT_FOUND;
+
+    return 0;
+}
+/**
+ * Function: sha1Multi
+ */
+void sha1Multi
+(
+    const char *const  *pp_messages,
+    const unsigned int *p_lengths,
+    size_t             numberOfMessages,
+    struct hash        *p_digests
+)
+{
+    unsigned int lanes          = numberOfSha1Lanes,
+                 numberOfQueued = 0,
+                 p_queuedLengths[CRACK_SHA1_MAX_LANES];
+    size_t       p_queued[CRACK_SHA1_MAX_LANES];
+    const char   *pp_queuedMessages[CRACK_SHA1_MAX_LANES];
+    struct hash  p_queuedDigests[CRACK_SHA1_MAX_LANES];
+    /*
+     *  Messages that fit into a single block are queued until every lane of
+     *  the engine has one, longer ones are hashed on their own right away.
+     */
+    for(size_t i = 0; i <= numberOfMessages; i++)
+    {
+        if(i < numberOfMessages && p_lengths[i] > CRACK_SHA1_MAX_SHORT_LENGTH)
+        {
+            sha1(pp_messages[i],
+                 p_lengths[i],
+                 &p_digests[i]);
+            continue;
+        }
+        if(i < numberOfMessages)
+        {
+            p_queued[numberOfQueued]          = i;
+            pp_queuedMessages[numberOfQueued] = pp_messages[i];
+            p_queuedLengths[numberOfQueued]   = p_lengths[i];
+            numberOfQueued++;
+            if(numberOfQueued < lanes)
+                continue;
+        }
+        if(numberOfQueued == 0)
+            break;
+        // the last batch repeats its first message in the lanes left over
+        for(unsigned int lane = numberOfQueued; lane < lanes; lane++)
+        {
+            pp_queuedMessages[lane] = pp_queuedMessages[0];
+            p_queuedLengths[lane]   = p_queuedLengths[0];
+        }
+        sha1MultiLanes(pp_queuedMessages,
+                       p_queuedLengths,
+                       NULL,
+                       p_queuedDigests);
+        for(unsigned int lane = 0; lane < numberOfQueued; lane++)
+            p_digests[p_queued[lane]] = p_queuedDigests[lane];
+        numberOfQueued = 0;
+    }
+}
+/**
+ * Function: loadSha1Block
+ */
+void loadSha1Block
+(
+    const char   *p_message,
+    unsigned int length,
+    uint32_t     *p_words
+)
+{
+    // big-endian words, padding and length of a message of up to CRACK_SHA1_MAX_SHORT_LENGTH bytes
+    memset(p_words,
+           0,
+           16 * sizeof(uint32_t));
+    for(unsigned int i = 0; i < length; i++)
+        p_words[i >> 2] |= (uint32_t) (unsigned char) p_message[i] << (24 - 8 * (i & 3));
+    p_words[length >> 2] |= UINT32_C(0x80) << (24 - 8 * (length & 3));
+    p_words[15] = length << 3;
+}
+/**
+ * Function: precomputeSha1Prefix
+ */
+void precomputeSha1Prefix
+(
+    const char        *p_prefix,
+    unsigned int      length,
+    struct sha1Prefix *p_sha1Prefix
+)
+{
+    uint32_t p_blocks[16],
+             a = SHA1_IV_0,
+             b = SHA1_IV_1,
+             c = SHA1_IV_2,
+             d = SHA1_IV_3,
+             e = SHA1_IV_4,
+             temp;
+    // only word blocks made of shared bytes (never padding) take part
+    p_sha1Prefix->numberOfRounds = length / 4;
+    if(p_sha1Prefix->numberOfRounds > 13)
+        p_sha1Prefix->numberOfRounds = 13;
+    loadSha1Block(p_prefix,
+                  p_sha1Prefix->numberOfRounds * 4,
+                  p_blocks);
+    for(unsigned int i = 0; i < p_sha1Prefix->numberOfRounds; i++)
+    {
+        ROUND(F_00_19(b, c, d), K_00_19, p_blocks[i])
+    }
+    p_sha1Prefix->p_state[0] = a;
+    p_sha1Prefix->p_state[1] = b;
+    p_sha1Prefix->p_state[2] = c;
+    p_sha1Prefix->p_state[3] = d;
+    p_sha1Prefix->p_state[4] = e;
+}
+/**
+ * Function: sha1BlocksScalar
+ */
+void sha1BlocksScalar
+(
+    uint32_t            *p_state,
+    const unsigned char *p_data,
+    size_t              numberOfBlocks
+)
+{
+    uint32_t p_blocks[16],
+             a,
+             b,
+             c,
+             d,
+             e,
+             temp;
+    for(size_t block = 0; block < numberOfBlocks; block++, p_data += SHA1_BLOCK_SIZE)
+    {
+        for(unsigned int i = 0; i < 16; i++)
+            p_blocks[i] = (uint32_t) p_data[4 * i] << 24 | (uint32_t) p_data[4 * i + 1] << 16
+                          | (uint32_t) p_data[4 * i + 2] << 8 | p_data[4 * i + 3];
+        a = p_state[0];
+        b = p_state[1];
+        c = p_state[2];
+        d = p_state[3];
+        e = p_state[4];
+        // word blocks 16 - 79 are expanded round by round in a ring of the last 16
+        for(unsigned int i = 0; i < 16; i++)
+        {
+            ROUND(F_00_19(b, c, d), K_00_19, p_blocks[i])
+        }
+        for(unsigned int i = 16; i < 20; i++)
+        {
+            ROUND(F_00_19(b, c, d), K_00_19, EXPAND(i))
+        }
+        for(unsigned int i = 20; i < 40; i++)
+        {
+            ROUND(F_20_39(b, c, d), K_20_39, EXPAND(i))
+        }
+        for(unsigned int i = 40; i < 60; i++)
+        {
+            ROUND(F_40_59(b, c, d), K_40_59, EXPAND(i))
+        }
+        for(unsigned int i = 60; i < 80; i++)
+        {
+            ROUND(F_60_79(b, c, d), K_60_79, EXPAND(i))
+        }
+        p_state[0] += a;
+        p_state[1] += b;
+        p_state[2] += c;
+        p_state[3] += d;
+        p_state[4] += e;
+    }
+}
+/**
+ * Function: sha1MultiScalar
+ */
+void sha1MultiScalar
+(
+    const char *const       *pp_messages,
+    const unsigned int      *p_lengths,
+    const struct sha1Prefix *p_prefix,
+    struct hash             *p_digests
+)
+{
+    // a single lane gains nothing from a shared prefix
+    (void) p_prefix;
+    sha1(pp_messages[0],
+         p_lengths[0],
+         &p_digests[0]);
+}
@@ -0,0 +1,149 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// compile this engine for AVX2, it is only called if the CPU supports it
+#pragma GCC target("avx2")
+// AVX2 intrinsics
+#include <immintrin.h>
+
+// macros for AVX2 intrinsics
+#define OR(x, y)             (_mm256_or_si256(x, y))
+#define XOR(x, y)            (_mm256_xor_si256(x, y))
+#define AND(x, y)            (_mm256_and_si256(x, y))
+#define ADD(x, y)            (_mm256_add_epi32(x, y))
+#define SET1INT(x)           (_mm256_set1_epi32((int) (x)))
+#define LOAD(loc)            (_mm256_loadu_si256((const __m256i *) (loc)))
+#define STORE(loc, x)        (_mm256_storeu_si256(((__m256i *) loc), x))
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+// constants for k-values of rounds 0 - 79
+#define K_00_19              UINT32_C(0x5A827999)
+#define K_20_39              UINT32_C(0x6ED9EBA1)
+#define K_40_59              UINT32_C(0x8F1BBCDC)
+#define K_60_79              UINT32_C(0xCA62C1D6)
+// one message per 32-bit lane
+#define AVX2_LANES           8
+
+// macros for f-functions
+#define VF_00_19(mB, mC, mD) (XOR(mD, (AND(mB, (XOR(mC, mD))))))
+#define VF_40_59(mB, mC, mD) (XOR(AND(mB, mC), (AND(mD, (XOR(mB, mC))))))
+#define VF_REST(mB, mC, mD)  (XOR((XOR(mB, mC)), mD))
+
+// macro for circular left-shift (adapted from RFC 3174)
+#define VEC_LEFT_ROTATE(word, bits) (OR((_mm256_slli_epi32((word), (bits))), (_mm256_srli_epi32((word), (32 - (bits))))))
+
+/*
+ *  One round: the word block of round i is expanded in place in a ring of
+ *  the last 16 word blocks.
+ */
+#define ROUND(f, k, i)                                                                                    \
+    if((i) >= 16)                                                                                         \
+        p_blocks[(i) & 15] = VEC_LEFT_ROTATE(XOR(XOR(p_blocks[((i) - 3) & 15], p_blocks[((i) - 8) & 15]), \
+                                                 XOR(p_blocks[((i) - 14) & 15], p_blocks[(i) & 15])), 1); \
+    temp = ADD(ADD(ADD(f, SET1INT(k)), VEC_LEFT_ROTATE(a, 5)), ADD(e, p_blocks[(i) & 15]));               \
+    e    = d;                                                                                             \
+    d    = c;                                                                                             \
+    c    = VEC_LEFT_ROTATE(b, 30);                                                                        \
+    b    = a;                                                                                             \
+    a    = temp;
+
+/**
+ * Function: sha1MultiAvx2
+ */
+void sha1MultiAvx2
+(
+    const char *const       *pp_messages,
+    const unsigned int      *p_lengths,
+    const struct sha1Prefix *p_prefix,
+    struct hash             *p_digests
+)
+{
+    unsigned int firstRound = 0;
+    uint32_t     p_words[16][AVX2_LANES],
+                 p_message[16],
+                 p_state[5][AVX2_LANES];
+    __m256i      p_blocks[16],
+                 a,
+                 b,
+                 c,
+                 d,
+                 e,
+                 temp;
+    // transpose the padded messages, so every vector holds one word block of all lanes
+    for(unsigned int lane = 0; lane < AVX2_LANES; lane++)
+    {
+        loadSha1Block(pp_messages[lane],
+                      p_lengths[lane],
+                      p_message);
+        for(unsigned int i = 0; i < 16; i++)
+            p_words[i][lane] = p_message[i];
+    }
+    for(unsigned int i = 0; i < 16; i++)
+        p_blocks[i] = LOAD(p_words[i]);
+    // the rounds over the shared leading word blocks were done once for all lanes
+    if(p_prefix != NULL)
+    {
+        a          = SET1INT(p_prefix->p_state[0]);
+        b          = SET1INT(p_prefix->p_state[1]);
+        c          = SET1INT(p_prefix->p_state[2]);
+        d          = SET1INT(p_prefix->p_state[3]);
+        e          = SET1INT(p_prefix->p_state[4]);
+        firstRound = p_prefix->numberOfRounds;
+    }
+    else
+    {
+        a = SET1INT(SHA1_IV_0);
+        b = SET1INT(SHA1_IV_1);
+        c = SET1INT(SHA1_IV_2);
+        d = SET1INT(SHA1_IV_3);
+        e = SET1INT(SHA1_IV_4);
+    }
+    for(unsigned int i = firstRound; i < 20; i++)
+    {
+        ROUND(VF_00_19(b, c, d), K_00_19, i)
+    }
+    for(unsigned int i = 20; i < 40; i++)
+    {
+        ROUND(VF_REST(b, c, d), K_20_39, i)
+    }
+    for(unsigned int i = 40; i < 60; i++)
+    {
+        ROUND(VF_40_59(b, c, d), K_40_59, i)
+    }
+    for(unsigned int i = 60; i < 80; i++)
+    {
+        ROUND(VF_REST(b, c, d), K_60_79, i)
+    }
+    STORE(p_state[0], ADD(a, SET1INT(SHA1_IV_0)));
+    STORE(p_state[1], ADD(b, SET1INT(SHA1_IV_1)));
+    STORE(p_state[2], ADD(c, SET1INT(SHA1_IV_2)));
+    STORE(p_state[3], ADD(d, SET1INT(SHA1_IV_3)));
+    STORE(p_state[4], ADD(e, SET1INT(SHA1_IV_4)));
+    for(unsigned int lane = 0; lane < AVX2_LANES; lane++)
+    {
+        p_digests[lane].a = p_state[0][lane];
+        p_digests[lane].b = p_state[1][lane];
+        p_digests[lane].c = p_state[2][lane];
+        p_digests[lane].d = p_state[3][lane];
+        p_digests[lane].e = p_state[4][lane];
+    }
+}
@@ -0,0 +1,164 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// compile this engine for the SHA extensions, it is only called if the CPU supports them
+#pragma GCC target("sha,sse4.1")
+// SHA, SSSE3 and SSE4.1 intrinsics
+#include <immintrin.h>
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+// lanes of sha1MultiShaNi (two independent blocks keep the SHA units busy)
+#define SHANI_LANES          2
+
+/*
+ *  Four rounds per group: sha1nexte derives e from the a of four rounds
+ *  before and adds the message words, sha1rnds4 runs the rounds. The message
+ *  schedule of word group g + 1 is finished by sha1msg2 in group g, after
+ *  sha1msg1 (group g - 2) and the xor of word group g - 1 (group g - 1).
+ */
+#define SHANI_GROUP(g, abcd, p_e, p_msg)                                                 \
+    if((g) == 0)                                                                         \
+        p_e[0] = _mm_add_epi32(p_e[0], p_msg[0]);                                        \
+    else                                                                                 \
+        p_e[(g) % 2] = _mm_sha1nexte_epu32(p_e[(g) % 2], p_msg[(g) % 4]);                \
+    p_e[((g) + 1) % 2] = abcd;                                                           \
+    if((g) >= 3 && (g) <= 18)                                                            \
+        p_msg[((g) + 1) % 4] = _mm_sha1msg2_epu32(p_msg[((g) + 1) % 4], p_msg[(g) % 4]); \
+    abcd = _mm_sha1rnds4_epu32(abcd, p_e[(g) % 2], (g) / 5);                             \
+    if((g) >= 1 && (g) <= 16)                                                            \
+        p_msg[((g) + 3) % 4] = _mm_sha1msg1_epu32(p_msg[((g) + 3) % 4], p_msg[(g) % 4]); \
+    if((g) >= 2 && (g) <= 17)                                                            \
+        p_msg[((g) + 2) % 4] = _mm_xor_si128(p_msg[((g) + 2) % 4], p_msg[(g) % 4]);
+
+// function prototypes
+static inline void compressBlock(__m128i *p_abcd,
+                                 __m128i *p_e,
+                                 __m128i *p_msg);
+
+/**
+ * Function: sha1BlocksShaNi
+ */
+void sha1BlocksShaNi
+(
+    uint32_t            *p_state,
+    const unsigned char *p_data,
+    size_t              numberOfBlocks
+)
+{
+    // reverses the bytes of the register: big-endian words, word 0 in the top lane
+    const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607, 0x08090A0B0C0D0E0F);
+    __m128i       abcd     = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) p_state), 0x1B),
+                  e        = _mm_set_epi32((int) p_state[4], 0, 0, 0),
+                  p_msg[4];
+    for(size_t block = 0; block < numberOfBlocks; block++, p_data += 64)
+    {
+        for(unsigned int i = 0; i < 4; i++)
+            p_msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (p_data + 16 * i)),
+                                        byteSwap);
+        compressBlock(&abcd,
+                      &e,
+                      p_msg);
+    }
+    _mm_storeu_si128((__m128i *) p_state,
+                     _mm_shuffle_epi32(abcd, 0x1B));
+    p_state[4] = (uint32_t) _mm_extract_epi32(e, 3);
+}
+/**
+ * Function: sha1MultiShaNi
+ */
+void sha1MultiShaNi
+(
+    const char *const       *pp_messages,
+    const unsigned int      *p_lengths,
+    const struct sha1Prefix *p_prefix,
+    struct hash             *p_digests
+)
+{
+    uint32_t p_words[16],
+             p_state[4];
+    __m128i  p_abcd[SHANI_LANES],
+             p_e[SHANI_LANES],
+             p_msg[SHANI_LANES][4];
+    // sha1rnds4 runs four rounds at once, the prefix is not worth splitting them up
+    (void) p_prefix;
+    // the lanes are independent, so their rounds overlap in the pipeline
+    for(unsigned int lane = 0; lane < SHANI_LANES; lane++)
+    {
+        loadSha1Block(pp_messages[lane],
+                      p_lengths[lane],
+                      p_words);
+        for(unsigned int i = 0; i < 4; i++)
+            p_msg[lane][i] = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) (p_words + 4 * i)), 0x1B);
+        p_abcd[lane] = _mm_set_epi32((int) SHA1_IV_0, (int) SHA1_IV_1, (int) SHA1_IV_2, (int) SHA1_IV_3);
+        p_e[lane]    = _mm_set_epi32((int) SHA1_IV_4, 0, 0, 0);
+    }
+    for(unsigned int lane = 0; lane < SHANI_LANES; lane++)
+        compressBlock(&p_abcd[lane],
+                      &p_e[lane],
+                      p_msg[lane]);
+    for(unsigned int lane = 0; lane < SHANI_LANES; lane++)
+    {
+        _mm_storeu_si128((__m128i *) p_state,
+                         _mm_shuffle_epi32(p_abcd[lane], 0x1B));
+        p_digests[lane].a = p_state[0];
+        p_digests[lane].b = p_state[1];
+        p_digests[lane].c = p_state[2];
+        p_digests[lane].d = p_state[3];
+        p_digests[lane].e = (uint32_t) _mm_extract_epi32(p_e[lane], 3);
+    }
+}
+/**
+ * Function: compressBlock
+ */
+static inline void compressBlock
+(
+    __m128i *p_abcd,
+    __m128i *p_e,
+    __m128i *p_msg
+)
+{
+    __m128i abcd       = *p_abcd,
+            p_eTemp[2] = { *p_e, abcd };
+    SHANI_GROUP(0, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(1, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(2, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(3, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(4, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(5, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(6, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(7, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(8, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(9, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(10, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(11, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(12, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(13, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(14, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(15, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(16, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(17, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(18, abcd, p_eTemp, p_msg)
+    SHANI_GROUP(19, abcd, p_eTemp, p_msg)
+    // e of the next block: e rotated from the a of round 76 plus the e of the previous one
+    *p_e    = _mm_sha1nexte_epu32(p_eTemp[0], *p_e);
+    *p_abcd = _mm_add_epi32(abcd, *p_abcd);
+}
@@ -0,0 +1,374 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// errno, EINTR
+#include <errno.h>
+// poll, struct pollfd
+#include <poll.h>
+// kill, SIGKILL
+#include <signal.h>
+// malloc, calloc, free
+#include <stdlib.h>
+// socketpair, send, recv, MSG_NOSIGNAL
+#include <sys/socket.h>
+// waitpid
+#include <sys/wait.h>
+// fork, close, _exit
+#include <unistd.h>
+
+// replies of a shard worker
+#define SHARD_FOUND  1
+#define SHARD_DONE   2
+#define SHARD_FAILED 3
+
+/*
+ *  Wire format between coordinator and workers (native byte order). The
+ *  coordinator sends one request per shard and closes the socket once no
+ *  shard is left; a worker answers every preimage it finds, then one
+ *  SHARD_DONE (or SHARD_FAILED) per shard.
+ */
+struct shardRequest
+{
+	uint64_t firstCandidate;
+	uint64_t endCandidate;
+};
+
+struct shardReply
+{
+	uint32_t type;
+	uint32_t error;
+	uint64_t target;
+	char     p_preimage[CRACK_RESULT_SIZE];
+};
+
+// function prototypes
+static int sendShard(int                         fd,
+                     const struct keyspaceLayout *p_layout,
+                     uint64_t                    shard,
+                     uint64_t                    numberOfShards);
+static int sendFully(int        fd,
+                     const void *p_data,
+                     size_t     size);
+static int receiveFully(int    fd,
+                        void   *p_data,
+                        size_t size);
+
+/**
+ * Function: crackHashesSharded
+ */
+int crackHashesSharded
+(
+    const struct hash     *p_targets,
+    size_t                numberOfTargets,
+    const struct keyspace *p_keyspace,
+    char                  *p_results,
+    unsigned int          numberOfProcesses,
+    uint64_t              numberOfShards
+)
+{
+    int                   err             = 0,
+                          p_sockets[2];
+    unsigned int          numberOfStarted = 0,
+                          numberOfActive  = 0;
+    size_t                numberOfFound   = 0;
+    uint64_t              nextShard       = 0,
+                          numberOfSlices;
+    pid_t                 p_workers[CRACK_MAX_PROCESSES];
+    struct pollfd         p_polls[CRACK_MAX_PROCESSES];
+    struct shardReply     reply;
+    struct keyspaceLayout layout;
+    unsigned char         *p_found;
+    // zero processes means one per online core
+    if(numberOfProcesses == 0)
+        numberOfProcesses = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+    if(numberOfProcesses == 0)
+        numberOfProcesses = 1;
+    if(numberOfProcesses > CRACK_MAX_PROCESSES)
+        numberOfProcesses = CRACK_MAX_PROCESSES;
+    if((err = initKeyspaceLayout(&layout, p_keyspace)) != 0)
+        return err;
+    // shards are whole slices, so no worker sweeps a slice another one sweeps as well
+    numberOfSlices = layout.p_firstSlice[layout.maxLength + 1];
+    if(numberOfShards == 0)
+        numberOfShards = (uint64_t) numberOfProcesses * CRACK_SHARDS_PER_PROCESS;
+    if(numberOfShards > numberOfSlices)
+        numberOfShards = numberOfSlices;
+    p_found = calloc(numberOfTargets + 1, sizeof(unsigned char));
+    if(p_found == NULL)
+    {
+        freeKeyspaceLayout(&layout);
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    memset(p_results,
+           0,
+           numberOfTargets * CRACK_RESULT_SIZE);
+    // every worker is a forked process connected by its own socket
+    while(numberOfStarted < numberOfProcesses && numberOfStarted < numberOfShards)
+    {
+        if(socketpair(AF_UNIX, SOCK_STREAM, 0, p_sockets) != 0)
+            break;
+        if((p_workers[numberOfStarted] = fork()) == 0)
+        {
+            // the worker must not keep the sockets of its siblings open
+            for(unsigned int i = 0; i < numberOfStarted; i++)
+                close(p_polls[i].fd);
+            close(p_sockets[0]);
+            // the workers take the cores in turn rather than all pinning to the first one
+            pinCrackProcess(numberOfStarted);
+            _exit(runShardWorker(p_sockets[1],
+                                 p_targets,
+                                 numberOfTargets,
+                                 p_keyspace,
+                                 1) == 0 ? 0 : 1);
+        }
+        close(p_sockets[1]);
+        if(p_workers[numberOfStarted] < 0)
+        {
+            close(p_sockets[0]);
+            break;
+        }
+        p_polls[numberOfStarted].fd     = p_sockets[0];
+        p_polls[numberOfStarted].events = POLLIN;
+        numberOfStarted++;
+    }
+    if(numberOfStarted == 0)
+        err = E_CRACK_IO;
+    // hand out the first shard to every worker
+    for(unsigned int i = 0; i < numberOfStarted && err == 0; i++)
+    {
+        if(sendShard(p_polls[i].fd, &layout, nextShard++, numberOfShards) != 0)
+            err = E_CRACK_IO;
+        numberOfActive++;
+    }
+    // collect results and hand out the remaining shards until all targets are found
+    while(err == 0 && numberOfActive > 0 && numberOfFound < numberOfTargets)
+    {
+        if(poll(p_polls, numberOfStarted, -1) < 0)
+        {
+            if(errno != EINTR)
+                err = E_CRACK_IO;
+            continue;
+        }
+        for(unsigned int i = 0; i < numberOfStarted && err == 0; i++)
+        {
+            if(p_polls[i].fd < 0 || p_polls[i].revents == 0)
+                continue;
+            // a worker that dies closes its socket before it replies
+            if(receiveFully(p_polls[i].fd, &reply, sizeof(reply)) != 0
+               || (reply.type == SHARD_FOUND && reply.target >= numberOfTargets))
+                err = E_CRACK_IO;
+            else if(reply.type == SHARD_FAILED)
+                err = (reply.error != 0) ? (int) reply.error : E_CRACK_IO;
+            if(err != 0)
+                break;
+            if(reply.type == SHARD_FOUND)
+            {
+                if(!p_found[reply.target])
+                {
+                    p_found[reply.target] = 1;
+                    numberOfFound++;
+                    reply.p_preimage[CRACK_MAX_PREIMAGE_LENGTH] = '\0';
+                    memcpy(p_results + reply.target * CRACK_RESULT_SIZE,
+                           reply.p_preimage,
+                           CRACK_RESULT_SIZE);
+                }
+            }
+            else if(nextShard < numberOfShards)
+            {
+                if(sendShard(p_polls[i].fd, &layout, nextShard++, numberOfShards) != 0)
+                    err = E_CRACK_IO;
+            }
+            else
+            {
+                // no shard left, closing the socket lets the worker exit
+                close(p_polls[i].fd);
+                p_polls[i].fd = -1;
+                numberOfActive--;
+            }
+        }
+    }
+    /*
+     *  Once every target is found (or a worker failed), the shards still in
+     *  progress are cancelled by killing their workers.
+     */
+    for(unsigned int i = 0; i < numberOfStarted; i++)
+    {
+        if(p_polls[i].fd >= 0)
+        {
+            kill(p_workers[i],
+                 SIGKILL);
+            close(p_polls[i].fd);
+        }
+        waitpid(p_workers[i],
+                NULL,
+                0);
+    }
+    free(p_found);
+    freeKeyspaceLayout(&layout);
+    if(err != 0)
+        return err;
+    // if a target is left over, the keyspace is exhausted
+    if(numberOfFound < numberOfTargets)
+        return E_CRACK_NOT_FOUND;
+
+    return 0;
+}
+/**
+ * Function: runShardWorker
+ */
+int runShardWorker
+(
+    int                   fd,
+    const struct hash     *p_targets,
+    size_t                numberOfTargets,
+    const struct keyspace *p_keyspace,
+    unsigned int          numberOfThreads
+)
+{
+    int                 err,
+                        result = 0;
+    char                *p_results;
+    struct shardRequest request;
+    struct shardReply   reply;
+    p_results = malloc(numberOfTargets * CRACK_RESULT_SIZE + 1);
+    if(p_results == NULL)
+        return E_CRACK_OUT_OF_MEMORY;
+    // sweep shards until the coordinator closes the socket
+    while(receiveFully(fd, &request, sizeof(request)) == 0)
+    {
+        memset(&reply,
+               0,
+               sizeof(reply));
+        err = crackHashesInRange(p_targets,
+                                 numberOfTargets,
+                                 request.firstCandidate,
+                                 request.endCandidate,
+                                 p_keyspace,
+                                 p_results,
+                                 numberOfThreads);
+        if(err != 0 && err != E_CRACK_NOT_FOUND)
+        {
+            result      = err;
+            reply.type  = SHARD_FAILED;
+            reply.error = (uint32_t) err;
+            sendFully(fd,
+                      &reply,
+                      sizeof(reply));
+            break;
+        }
+        for(size_t i = 0; i < numberOfTargets; i++)
+        {
+            if(p_results[i * CRACK_RESULT_SIZE] == '\0')
+                continue;
+            reply.type   = SHARD_FOUND;
+            reply.target = i;
+            memcpy(reply.p_preimage,
+                   p_results + i * CRACK_RESULT_SIZE,
+                   CRACK_RESULT_SIZE);
+            if(sendFully(fd, &reply, sizeof(reply)) != 0)
+                break;
+        }
+        reply.type = SHARD_DONE;
+        if(sendFully(fd, &reply, sizeof(reply)) != 0)
+            break;
+    }
+    free(p_results);
+    close(fd);
+
+    return result;
+}
+/**
+ * Function: sendShard
+ */
+static int sendShard
+(
+    int                         fd,
+    const struct keyspaceLayout *p_layout,
+    uint64_t                    shard,
+    uint64_t                    numberOfShards
+)
+{
+    uint64_t            numberOfSlices = p_layout->p_firstSlice[p_layout->maxLength + 1];
+    struct shardRequest request;
+    // shard i covers slices [i * slices / shards, (i + 1) * slices / shards)
+    request.firstCandidate = getSliceCandidate(p_layout,
+                                               (uint64_t) ((unsigned __int128) shard * numberOfSlices
+                                                           / numberOfShards));
+    request.endCandidate   = getSliceCandidate(p_layout,
+                                               (uint64_t) ((unsigned __int128) (shard + 1) * numberOfSlices
+                                                           / numberOfShards));
+
+    return sendFully(fd,
+                     &request,
+                     sizeof(request));
+}
+/**
+ * Function: sendFully
+ */
+static int sendFully
+(
+    int        fd,
+    const void *p_data,
+    size_t     size
+)
+{
+    ssize_t sent;
+    // MSG_NOSIGNAL turns a closed peer into an error instead of SIGPIPE
+    while(size > 0)
+    {
+        sent = send(fd,
+                    p_data,
+                    size,
+                    MSG_NOSIGNAL);
+        if(sent < 0 && errno == EINTR)
+            continue;
+        if(sent <= 0)
+            return -1;
+        p_data = (const char *) p_data + sent;
+        size  -= (size_t) sent;
+    }
+
+    return 0;
+}
+/**
+ * Function: receiveFully
+ */
+static int receiveFully
+(
+    int    fd,
+    void   *p_data,
+    size_t size
+)
+{
+    ssize_t received;
+    // a closed socket ends the stream
+    while(size > 0)
+    {
+        received = recv(fd,
+                        p_data,
+                        size,
+                        0);
+        if(received < 0 && errno == EINTR)
+            continue;
+        if(received <= 0)
+            return -1;
+        p_data = (char *) p_data + received;
+        size  -= (size_t) received;
+    }
+
+    return 0;
+}
@@ -0,0 +1,405 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// pthread_create, pthread_join
+#include <pthread.h>
+// fopen, fwrite, fclose, remove
+#include <stdio.h>
+// malloc, free, qsort
+#include <stdlib.h>
+// open, O_RDONLY
+#include <fcntl.h>
+// fstat
+#include <sys/stat.h>
+// mmap, munmap, madvise
+#include <sys/mman.h>
+// close, sysconf
+#include <unistd.h>
+
+// an entry holds the digest prefix above the candidate index
+#define TABLE_INDEX_BITS     29
+#define TABLE_PREFIX_BITS    (64 - TABLE_INDEX_BITS)
+#define TABLE_INDEX_MASK     ((UINT64_C(1) << TABLE_INDEX_BITS) - 1)
+// the entries start on a page boundary after the header
+#define TABLE_HEADER_SIZE    4096
+#define TABLE_MAGIC          "SHA1LUT"
+#define TABLE_VERSION        1
+// candidates hashed per call of sha1Multi
+#define TABLE_BATCH_SIZE     64
+
+// file header (native byte order, the table is not meant to be portable)
+union tableHeader
+{
+	struct
+	{
+		char     p_magic[8];
+		uint32_t version;
+		uint32_t minLength;
+		uint32_t maxLength;
+		uint32_t p_charsetLengths[CRACK_MAX_PREIMAGE_LENGTH];
+		char     p_charsets[CRACK_MAX_PREIMAGE_LENGTH][256];
+		uint64_t numberOfEntries;
+	}    fields;
+	char p_padding[TABLE_HEADER_SIZE];
+};
+
+struct tableJob
+{
+	const struct keyspaceLayout *p_layout;
+	uint64_t                    *p_entries;
+	uint64_t                    numberOfSlices;
+	atomic_uint_fast64_t        nextSlice;
+};
+
+// function prototypes
+static void *tableWorker(void *p_arg);
+static uint64_t getEntryPrefix(const struct hash *p_digest);
+static int compareTableEntries(const void *p_left,
+                               const void *p_right);
+
+/**
+ * Function: buildLookupTable
+ */
+int buildLookupTable
+(
+    const char            *p_path,
+    const struct keyspace *p_keyspace,
+    unsigned int          numberOfThreads
+)
+{
+    unsigned int          numberOfStarted = 0;
+    int                   result;
+    uint64_t              numberOfEntries;
+    pthread_t             p_threads[CRACK_MAX_THREADS];
+    struct keyspaceLayout layout;
+    struct tableJob       job;
+    union tableHeader     header;
+    FILE                  *p_file;
+    if((result = initKeyspaceLayout(&layout, p_keyspace)) != 0)
+        return result;
+    numberOfEntries = getNumberOfCandidates(&layout);
+    // every candidate index has to fit below the digest prefix
+    if(numberOfEntries > TABLE_INDEX_MASK + 1)
+    {
+        freeKeyspaceLayout(&layout);
+        return E_CRACK_BAD_KEYSPACE;
+    }
+    job.p_layout       = &layout;
+    job.p_entries      = malloc(numberOfEntries * sizeof(uint64_t));
+    job.numberOfSlices = layout.p_firstSlice[layout.maxLength + 1];
+    atomic_init(&job.nextSlice, 0);
+    if(job.p_entries == NULL)
+    {
+        freeKeyspaceLayout(&layout);
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    // zero threads means one thread per online core
+    if(numberOfThreads == 0)
+        numberOfThreads = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+    if(numberOfThreads == 0)
+        numberOfThreads = 1;
+    if(numberOfThreads > CRACK_MAX_THREADS)
+        numberOfThreads = CRACK_MAX_THREADS;
+    while(numberOfStarted < numberOfThreads - 1)
+    {
+        if(pthread_create(&p_threads[numberOfStarted],
+                          NULL,
+                          tableWorker,
+                          &job) != 0)
+            break;
+        numberOfStarted++;
+    }
+    tableWorker(&job);
+    for(unsigned int i = 0; i < numberOfStarted; i++)
+        pthread_join(p_threads[i],
+                     NULL);
+    qsort(job.p_entries,
+          numberOfEntries,
+          sizeof(uint64_t),
+          compareTableEntries);
+    // the header keeps the layout, so a lookup can map indices back to preimages
+    memset(&header,
+           0,
+           sizeof(header));
+    memcpy(header.fields.p_magic,
+           TABLE_MAGIC,
+           sizeof(TABLE_MAGIC));
+    header.fields.version         = TABLE_VERSION;
+    header.fields.minLength       = layout.minLength;
+    header.fields.maxLength       = layout.maxLength;
+    header.fields.numberOfEntries = numberOfEntries;
+    for(unsigned int i = 0; i < CRACK_MAX_PREIMAGE_LENGTH; i++)
+    {
+        header.fields.p_charsetLengths[i] = layout.p_charsetLengths[i];
+        memcpy(header.fields.p_charsets[i],
+               layout.p_charsets[i],
+               sizeof(layout.p_charsets[i]));
+    }
+    freeKeyspaceLayout(&layout);
+    result = E_CRACK_IO;
+    if((p_file = fopen(p_path, "wb")) != NULL)
+    {
+        if(fwrite(&header, sizeof(header), 1, p_file) == 1
+           && fwrite(job.p_entries, sizeof(uint64_t), numberOfEntries, p_file) == numberOfEntries)
+            result = 0;
+        if(fclose(p_file) != 0)
+            result = E_CRACK_IO;
+        // do not leave a truncated table behind
+        if(result != 0)
+            remove(p_path);
+    }
+    free(job.p_entries);
+
+    return result;
+}
+/**
+ * Function: openLookupTable
+ */
+int openLookupTable
+(
+    struct lookupTable *p_table,
+    const char         *p_path
+)
+{
+    int                     fd,
+                            result;
+    struct stat             status;
+    const union tableHeader *p_header;
+    memset(p_table,
+           0,
+           sizeof(struct lookupTable));
+    if((fd = open(p_path, O_RDONLY)) < 0)
+        return E_CRACK_IO;
+    if(fstat(fd, &status) != 0)
+    {
+        close(fd);
+        return E_CRACK_IO;
+    }
+    if((size_t) status.st_size < TABLE_HEADER_SIZE)
+    {
+        close(fd);
+        return E_CRACK_BAD_TABLE;
+    }
+    p_table->mappingSize = (size_t) status.st_size;
+    p_table->p_mapping   = mmap(NULL,
+                                p_table->mappingSize,
+                                PROT_READ,
+                                MAP_SHARED,
+                                fd,
+                                0);
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    if(p_table->p_mapping == MAP_FAILED)
+    {
+        p_table->p_mapping = NULL;
+        return E_CRACK_IO;
+    }
+    // lookups jump around the whole table
+    madvise(p_table->p_mapping,
+            p_table->mappingSize,
+            MADV_RANDOM);
+    p_header = p_table->p_mapping;
+    if(memcmp(p_header->fields.p_magic, TABLE_MAGIC, sizeof(TABLE_MAGIC)) != 0
+       || p_header->fields.version != TABLE_VERSION
+       || p_header->fields.numberOfEntries
+          != (p_table->mappingSize - TABLE_HEADER_SIZE) / sizeof(uint64_t))
+    {
+        closeLookupTable(p_table);
+        return E_CRACK_BAD_TABLE;
+    }
+    // rebuild the layout the table was built from
+    p_table->layout.minLength = p_header->fields.minLength;
+    p_table->layout.maxLength = p_header->fields.maxLength;
+    for(unsigned int i = 0; i < CRACK_MAX_PREIMAGE_LENGTH; i++)
+    {
+        if(p_header->fields.p_charsetLengths[i] > 255)
+        {
+            closeLookupTable(p_table);
+            return E_CRACK_BAD_TABLE;
+        }
+        p_table->layout.p_charsetLengths[i] = p_header->fields.p_charsetLengths[i];
+        memcpy(p_table->layout.p_charsets[i],
+               p_header->fields.p_charsets[i],
+               sizeof(p_table->layout.p_charsets[i]));
+        p_table->layout.p_charsets[i][p_table->layout.p_charsetLengths[i]] = '\0';
+    }
+    if((result = buildKeyspaceLayout(&p_table->layout)) != 0
+       || getNumberOfCandidates(&p_table->layout) != p_header->fields.numberOfEntries)
+    {
+        closeLookupTable(p_table);
+        return (result == E_CRACK_OUT_OF_MEMORY) ? result : E_CRACK_BAD_TABLE;
+    }
+    p_table->p_entries       = (const uint64_t *) ((const char *) p_table->p_mapping + TABLE_HEADER_SIZE);
+    p_table->numberOfEntries = p_header->fields.numberOfEntries;
+
+    return 0;
+}
+/**
+ * Function: lookupHash
+ */
+int lookupHash
+(
+    const struct lookupTable *p_table,
+    struct hash              targetHash,
+    char                     *p_result
+)
+{
+    uint64_t     prefix      = getEntryPrefix(&targetHash),
+                 lowKey      = prefix << TABLE_INDEX_BITS,
+                 low         = 0,
+                 high        = p_table->numberOfEntries,
+                 middle,
+                 lowValue    = 0,
+                 highValue   = UINT64_MAX;
+    unsigned int length;
+    /*
+     *  The digest prefixes are uniformly distributed, so interpolation finds
+     *  the first entry with a key >= lowKey in a few probes. It falls back to
+     *  bisection if an estimate is off (the bounds shrink either way).
+     */
+    while(low < high)
+    {
+        if(highValue > lowValue && lowKey >= lowValue)
+            middle = low + (uint64_t) ((double) (lowKey - lowValue) / (double) (highValue - lowValue)
+                                       * (double) (high - low));
+        else
+            middle = low + (high - low) / 2;
+        if(middle >= high)
+            middle = high - 1;
+        if(p_table->p_entries[middle] < lowKey)
+        {
+            low      = middle + 1;
+            lowValue = p_table->p_entries[middle];
+        }
+        else
+        {
+            high      = middle;
+            highValue = p_table->p_entries[middle];
+        }
+    }
+    // a prefix is shared by a few candidates at most, the full digest decides
+    for(uint64_t i = low; i < p_table->numberOfEntries
+                          && (p_table->p_entries[i] >> TABLE_INDEX_BITS) == prefix; i++)
+    {
+        length = getCandidatePreimage(&p_table->layout,
+                                      p_table->p_entries[i] & TABLE_INDEX_MASK,
+                                      p_result);
+        if(sha1Verify(p_result, length, &targetHash) == 0)
+        {
+            p_result[length] = '\0';
+            return 0;
+        }
+    }
+    p_result[0] = '\0';
+
+    return E_CRACK_NOT_FOUND;
+}
+/**
+ * Function: closeLookupTable
+ */
+void closeLookupTable
+(
+    struct lookupTable *p_table
+)
+{
+    freeKeyspaceLayout(&p_table->layout);
+    if(p_table->p_mapping != NULL)
+        munmap(p_table->p_mapping,
+               p_table->mappingSize);
+    p_table->p_mapping       = NULL;
+    p_table->p_entries       = NULL;
+    p_table->numberOfEntries = 0;
+}
+/**
+ * Function: tableWorker
+ */
+static void *tableWorker
+(
+    void *p_arg
+)
+{
+    struct tableJob   *p_job = p_arg;
+    struct sliceSetup setup;
+    char              p_preimages[TABLE_BATCH_SIZE][CRACK_MAX_PREIMAGE_LENGTH];
+    const char        *pp_preimages[TABLE_BATCH_SIZE];
+    unsigned int      p_lengths[TABLE_BATCH_SIZE];
+    struct hash       p_digests[TABLE_BATCH_SIZE];
+    uint64_t          slice,
+                      index,
+                      numberOfInner,
+                      numberOfBatch;
+    for(unsigned int i = 0; i < TABLE_BATCH_SIZE; i++)
+        pp_preimages[i] = p_preimages[i];
+    // slices are handed out one at a time, every candidate has its own entry
+    while((slice = atomic_fetch_add(&p_job->nextSlice, 1)) < p_job->numberOfSlices)
+    {
+        setupSlice(p_job->p_layout,
+                   slice,
+                   &setup);
+        numberOfInner = (uint64_t) setup.numberOfInnerHigh * setup.numberOfInnerLow;
+        index         = getCandidateIndex(&setup,
+                                          slice,
+                                          0);
+        for(unsigned int i = 0; i < TABLE_BATCH_SIZE; i++)
+            p_lengths[i] = setup.length;
+        // the candidates are hashed in batches, so a multi-buffer engine fills its lanes
+        for(uint64_t inner = 0; inner < numberOfInner; inner += numberOfBatch)
+        {
+            numberOfBatch = numberOfInner - inner;
+            if(numberOfBatch > TABLE_BATCH_SIZE)
+                numberOfBatch = TABLE_BATCH_SIZE;
+            for(uint64_t i = 0; i < numberOfBatch; i++)
+                getSlicePreimage(&setup,
+                                 inner + i,
+                                 p_preimages[i]);
+            sha1Multi(pp_preimages,
+                      p_lengths,
+                      numberOfBatch,
+                      p_digests);
+            for(uint64_t i = 0; i < numberOfBatch; i++)
+                p_job->p_entries[index + inner + i] = (getEntryPrefix(&p_digests[i]) << TABLE_INDEX_BITS)
+                                                      | (index + inner + i);
+        }
+    }
+
+    return NULL;
+}
+/**
+ * Function: getEntryPrefix
+ */
+static uint64_t getEntryPrefix
+(
+    const struct hash *p_digest
+)
+{
+    // leading TABLE_PREFIX_BITS bits of the digest
+    return (((uint64_t) p_digest->a << 32) | p_digest->b) >> (64 - TABLE_PREFIX_BITS);
+}
+/**
+ * Function: compareTableEntries
+ */
+static int compareTableEntries
+(
+    const void *p_left,
+    const void *p_right
+)
+{
+    uint64_t left  = *(const uint64_t *) p_left,
+             right = *(const uint64_t *) p_right;
+
+    return (left > right) - (left < right);
+}
@@ -0,0 +1,199 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ * 
+ * This program is free software: you can redistribute it and/or modify  
+ * it under the terms of the GNU General Public License as published by  
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// malloc, calloc, free, qsort
+#include <stdlib.h>
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+// constant for k-values of rounds 60 - 79
+#define K_60_79              UINT32_C(0xCA62C1D6)
+/*
+ *  Filter bits per target: about 5 % false positives, and a million targets
+ *  take 1 MiB, so the filter stays in L2.
+ */
+#define FILTER_BITS_PER_TARGET 8
+// smallest filter (8 KiB, stays in L1 for single targets)
+#define FILTER_MIN_WORDS       UINT32_C(0x800)
+// largest filter (512 MiB, indices stay positive for the gathers of the kernels)
+#define FILTER_MAX_WORDS       UINT32_C(0x8000000)
+
+// macro for circular left-shift of a 32-bit word (taken from RFC 3174)
+#define LEFT_ROTATE(word, bits) (((word) << (bits)) | ((word) >> (32 - (bits))))
+// early exit value of an entry
+#define ENTRY_KEY(p_entry) (getEarlyExitKey((p_entry)->p_state))
+
+// function prototype
+static int compareEntries(const void *p_first,
+                          const void *p_second);
+
+/**
+ * Function: initTargetSet
+ */
+int initTargetSet
+(
+    struct targetSet  *p_set,
+    const struct hash *p_targets,
+    size_t            numberOfTargets
+)
+{
+    uint32_t directoryBits = 1,
+             filterWords   = FILTER_MIN_WORDS,
+             key,
+             *p_state;
+    size_t   bucket        = 0;
+    // size the filter and the directory to the number of targets
+    while((uint64_t) filterWords * 32 < (uint64_t) numberOfTargets * FILTER_BITS_PER_TARGET
+          && filterWords < FILTER_MAX_WORDS)
+        filterWords <<= 1;
+    while(directoryBits < 24 && ((size_t) 1 << directoryBits) < numberOfTargets)
+        directoryBits++;
+    p_set->numberOfTargets = numberOfTargets;
+    p_set->filterMask      = filterWords - 1;
+    p_set->directoryShift  = 32 - directoryBits;
+    p_set->p_filter        = calloc(filterWords, sizeof(uint32_t));
+    p_set->p_directory     = malloc((((size_t) 1 << directoryBits) + 1) * sizeof(uint32_t));
+    p_set->p_keys          = malloc(numberOfTargets * sizeof(uint32_t) + 1);
+    p_set->p_entries       = malloc(numberOfTargets * sizeof(struct targetEntry) + 1);
+    if(p_set->p_filter == NULL || p_set->p_directory == NULL
+       || p_set->p_keys == NULL || p_set->p_entries == NULL)
+    {
+        freeTargetSet(p_set);
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    // undo the final addition of the initial hash state
+    for(size_t i = 0; i < numberOfTargets; i++)
+    {
+        p_set->p_entries[i].p_state[0] = p_targets[i].a - SHA1_IV_0;
+        p_set->p_entries[i].p_state[1] = p_targets[i].b - SHA1_IV_1;
+        p_set->p_entries[i].p_state[2] = p_targets[i].c - SHA1_IV_2;
+        p_set->p_entries[i].p_state[3] = p_targets[i].d - SHA1_IV_3;
+        p_set->p_entries[i].p_state[4] = p_targets[i].e - SHA1_IV_4;
+        p_set->p_entries[i].target     = p_targets[i];
+        p_set->p_entries[i].index      = i;
+    }
+    qsort(p_set->p_entries,
+          numberOfTargets,
+          sizeof(struct targetEntry),
+          compareEntries);
+    // fill filter, sorted keys and directory in one pass
+    for(size_t i = 0; i < numberOfTargets; i++)
+    {
+        key = ENTRY_KEY(&p_set->p_entries[i]);
+        p_set->p_keys[i] = key;
+        p_set->p_filter[key & p_set->filterMask] |= TARGET_FILTER_BITS(key);
+        while(bucket <= (key >> p_set->directoryShift))
+            p_set->p_directory[bucket++] = (uint32_t) i;
+    }
+    // remaining buckets (including the extra one) end after the last key
+    while(bucket <= ((size_t) 1 << directoryBits))
+        p_set->p_directory[bucket++] = (uint32_t) numberOfTargets;
+    /*
+     *  For a single target the kernels rewind rounds 79 - 76 instead. The state
+     *  holds the results of rounds 79 and 78 and the rotated results of rounds
+     *  77 - 75; everything but the word blocks and the rewound results of the
+     *  later rounds is folded into these constants.
+     */
+    if(numberOfTargets > 0)
+    {
+        p_state = p_set->p_entries[0].p_state;
+        p_set->p_rewind[0] = p_set->p_keys[0];
+        p_set->p_rewind[1] = p_state[1] - LEFT_ROTATE(p_state[2], 7) - K_60_79;
+        p_set->p_rewind[2] = LEFT_ROTATE(p_state[3], 2) ^ p_state[4];
+        p_set->p_rewind[3] = LEFT_ROTATE(p_state[2], 2) - LEFT_ROTATE(p_state[3], 7) - K_60_79;
+        p_set->p_rewind[4] = LEFT_ROTATE(p_state[4], 2);
+        p_set->p_rewind[5] = LEFT_ROTATE(p_state[3], 2) - LEFT_ROTATE(p_state[4], 7) - K_60_79;
+    }
+
+    return 0;
+}
+/**
+ * Function: freeTargetSet
+ */
+void freeTargetSet
+(
+    struct targetSet *p_set
+)
+{
+    free(p_set->p_filter);
+    free(p_set->p_directory);
+    free(p_set->p_keys);
+    free(p_set->p_entries);
+    p_set->p_filter    = NULL;
+    p_set->p_directory = NULL;
+    p_set->p_keys      = NULL;
+    p_set->p_entries   = NULL;
+}
+/**
+ * Function: targetSetContainsKey
+ */
+int targetSetContainsKey
+(
+    const struct targetSet *p_set,
+    uint32_t               key
+)
+{
+    uint32_t first = p_set->p_directory[key >> p_set->directoryShift],
+             last  = p_set->p_directory[(key >> p_set->directoryShift) + 1];
+    // the kernels only get here once the filter passed
+    COUNT(earlyExitPassed, 1);
+    // buckets hold about one key each, so a linear scan is enough
+    for(uint32_t i = first; i < last; i++)
+    {
+        if(p_set->p_keys[i] == key)
+        {
+            COUNT(keyPassed, 1);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+/**
+ * Function: getEarlyExitKey
+ */
+uint32_t getEarlyExitKey
+(
+    const uint32_t *p_state
+)
+{
+    /*
+     *  Undo round 79 of a state (the hash minus the initial hash state): what
+     *  is left is the rotated result of round 74 plus word block 79, which the
+     *  kernels know one round before round 75.
+     */
+    return p_state[0] - LEFT_ROTATE(p_state[1], 5)
+           - (LEFT_ROTATE(p_state[2], 2) ^ p_state[3] ^ p_state[4]) - K_60_79;
+}
+/**
+ * Function: compareEntries
+ */
+static int compareEntries
+(
+    const void *p_first,
+    const void *p_second
+)
+{
+    uint32_t firstKey  = ENTRY_KEY((const struct targetEntry *) p_first),
+             secondKey = ENTRY_KEY((const struct targetEntry *) p_second);
+
+    return (firstKey > secondKey) - (firstKey < secondKey);
+}
@@ -0,0 +1,530 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sha1-cracker.h"
+// pthread_create, pthread_join
+#include <pthread.h>
+// calloc, free
+#include <stdlib.h>
+// open, O_RDONLY
+#include <fcntl.h>
+// fstat
+#include <sys/stat.h>
+// mmap, munmap, madvise
+#include <sys/mman.h>
+// close, sysconf
+#include <unistd.h>
+
+// constants for hash state initialisation
+#define SHA1_IV_0            UINT32_C(0x67452301)
+#define SHA1_IV_1            UINT32_C(0xEFCDAB89)
+#define SHA1_IV_2            UINT32_C(0x98BADCFE)
+#define SHA1_IV_3            UINT32_C(0x10325476)
+#define SHA1_IV_4            UINT32_C(0xC3D2E1F0)
+
+struct wordlistJob
+{
+	// p_layout, crackSlice and the range are not used by a wordlist
+	struct crackJob        job;
+	const char             *p_words;
+	size_t                 size;
+	uint64_t               numberOfChunks;
+	atomic_uint_fast64_t   nextChunk;
+	// every word is hashed as it is if there are no rules
+	const struct crackRule *p_rules;
+	size_t                 numberOfRules;
+};
+
+// words of the same length waiting for the lanes of the SHA-1 engine to fill up
+struct wordBatch
+{
+	const char   *pp_words[CRACK_SHA1_MAX_LANES];
+	unsigned int numberOfWords;
+	// rule outputs are copied here, words of the wordlist are hashed in place
+	char         p_storage[CRACK_SHA1_MAX_LANES][CRACK_SHA1_MAX_SHORT_LENGTH];
+};
+
+// batches of a worker thread
+struct wordBatches
+{
+	struct wordBatch  p_batches[CRACK_SHA1_MAX_SHORT_LENGTH + 1];
+	// rule outputs that start with the current word share the rounds over it
+	struct wordBatch  p_prefixBatches[CRACK_SHA1_MAX_SHORT_LENGTH + 1];
+	struct sha1Prefix prefix;
+	int               hasPrefix;
+	// lengths with prefix outputs of the current word, each one listed once
+	unsigned int      p_pendingLengths[CRACK_SHA1_MAX_SHORT_LENGTH + 1];
+	unsigned int      numberOfPending;
+	unsigned char     p_isPending[CRACK_SHA1_MAX_SHORT_LENGTH + 1];
+	char              p_output[CRACK_MAX_WORD_LENGTH];
+};
+
+// function prototypes
+static void *wordlistWorker(void *p_arg);
+static void expandWord(struct wordlistJob *p_job,
+                       struct wordBatches *p_batches,
+                       const char         *p_word,
+                       unsigned int       length);
+static void addWord(struct wordlistJob *p_job,
+                    struct wordBatches *p_batches,
+                    const char         *p_word,
+                    unsigned int       length,
+                    int                isCopied);
+static void addPrefixWord(struct wordlistJob *p_job,
+                          struct wordBatches *p_batches,
+                          const char         *p_word,
+                          unsigned int       wordLength,
+                          unsigned int       length);
+static void hashBatch(struct wordlistJob      *p_job,
+                      struct wordBatch        *p_batch,
+                      unsigned int            length,
+                      const struct sha1Prefix *p_prefix);
+static void checkDigest(struct wordlistJob *p_job,
+                        const struct hash  *p_digest,
+                        const char         *p_word,
+                        unsigned int       length);
+
+/**
+ * Function: crackHashesInWordlist
+ */
+int crackHashesInWordlist
+(
+    const struct hash *p_targets,
+    size_t            numberOfTargets,
+    const char        *p_path,
+    char              *p_results,
+    unsigned int      numberOfThreads
+)
+{
+    return crackHashesWithRules(p_targets,
+                                numberOfTargets,
+                                p_path,
+                                NULL,
+                                p_results,
+                                numberOfThreads);
+}
+/**
+ * Function: crackHashesWithRules
+ */
+int crackHashesWithRules
+(
+    const struct hash *p_targets,
+    size_t            numberOfTargets,
+    const char        *p_path,
+    const char        *p_rules,
+    char              *p_results,
+    unsigned int      numberOfThreads
+)
+{
+    int                err,
+                       fd;
+    unsigned int       numberOfStarted = 0;
+    void               *p_mapping;
+    pthread_t          p_threads[CRACK_MAX_THREADS];
+    struct stat        status;
+    struct targetSet   targets;
+    struct wordlistJob wordlistJob;
+    struct crackRule   *p_parsedRules  = NULL;
+    size_t             numberOfRules   = 0;
+    // zero threads means one thread per online core
+    if(numberOfThreads == 0)
+        numberOfThreads = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+    if(numberOfThreads == 0)
+        numberOfThreads = 1;
+    if(numberOfThreads > CRACK_MAX_THREADS)
+        numberOfThreads = CRACK_MAX_THREADS;
+    memset(p_results,
+           0,
+           numberOfTargets * CRACK_WORD_RESULT_SIZE);
+    // the rules are compiled once, the workers apply them to every word
+    if(p_rules != NULL && (err = parseRules(p_rules, &p_parsedRules, &numberOfRules)) != 0)
+        return err;
+    // a rule file without rules leaves nothing to try
+    if(p_rules != NULL && numberOfRules == 0)
+        return E_CRACK_NOT_FOUND;
+    fd = open(p_path,
+              O_RDONLY);
+    if(fd < 0 || fstat(fd, &status) != 0)
+    {
+        if(fd >= 0)
+            close(fd);
+        free(p_parsedRules);
+        return E_CRACK_IO;
+    }
+    // nothing to map, nothing to find
+    if(status.st_size == 0)
+    {
+        close(fd);
+        free(p_parsedRules);
+        return E_CRACK_NOT_FOUND;
+    }
+    // the words are hashed straight from the page cache, never copied
+    p_mapping = mmap(NULL,
+                     (size_t) status.st_size,
+                     PROT_READ,
+                     MAP_PRIVATE,
+                     fd,
+                     0);
+    close(fd);
+    if(p_mapping == MAP_FAILED)
+    {
+        free(p_parsedRules);
+        return E_CRACK_IO;
+    }
+    madvise(p_mapping,
+            (size_t) status.st_size,
+            MADV_SEQUENTIAL);
+    err = initTargetSet(&targets,
+                        p_targets,
+                        numberOfTargets);
+    if(err != 0)
+    {
+        munmap(p_mapping,
+               (size_t) status.st_size);
+        free(p_parsedRules);
+        return err;
+    }
+    memset(&wordlistJob,
+           0,
+           sizeof(wordlistJob));
+    wordlistJob.job.p_targets  = &targets;
+    wordlistJob.job.p_results  = p_results;
+    wordlistJob.job.resultSize = CRACK_WORD_RESULT_SIZE;
+    wordlistJob.job.p_found    = calloc(numberOfTargets + 1, sizeof(atomic_uchar));
+    wordlistJob.p_words        = p_mapping;
+    wordlistJob.size           = (size_t) status.st_size;
+    wordlistJob.numberOfChunks = (wordlistJob.size + CRACK_WORDLIST_CHUNK_SIZE - 1) / CRACK_WORDLIST_CHUNK_SIZE;
+    wordlistJob.p_rules        = p_parsedRules;
+    wordlistJob.numberOfRules  = numberOfRules;
+    if(wordlistJob.job.p_found == NULL)
+    {
+        freeTargetSet(&targets);
+        munmap(p_mapping,
+               (size_t) status.st_size);
+        free(p_parsedRules);
+        return E_CRACK_OUT_OF_MEMORY;
+    }
+    atomic_init(&wordlistJob.job.numberOfFound, 0);
+    atomic_init(&wordlistJob.nextChunk, 0);
+    // the calling thread works on the wordlist as well
+    while(numberOfStarted < numberOfThreads - 1)
+    {
+        if(pthread_create(&p_threads[numberOfStarted],
+                          NULL,
+                          wordlistWorker,
+                          &wordlistJob) != 0)
+            break;
+        numberOfStarted++;
+    }
+    wordlistWorker(&wordlistJob);
+    for(unsigned int i = 0; i < numberOfStarted; i++)
+        pthread_join(p_threads[i],
+                     NULL);
+    err = (atomic_load(&wordlistJob.job.numberOfFound) < numberOfTargets) ? E_CRACK_NOT_FOUND : 0;
+    free(wordlistJob.job.p_found);
+    freeTargetSet(&targets);
+    munmap(p_mapping,
+           (size_t) status.st_size);
+    free(p_parsedRules);
+
+    return err;
+}
+/**
+ * Function: wordlistWorker
+ */
+static void *wordlistWorker
+(
+    void *p_arg
+)
+{
+    struct wordlistJob *p_job = p_arg;
+    struct wordBatches batches;
+    uint64_t           chunk;
+    const char         *p_curr,
+                       *p_chunkEnd,
+                       *p_lineEnd,
+                       *p_end     = p_job->p_words + p_job->size;
+    size_t             length;
+    for(unsigned int i = 0; i <= CRACK_SHA1_MAX_SHORT_LENGTH; i++)
+    {
+        batches.p_batches[i].numberOfWords       = 0;
+        batches.p_prefixBatches[i].numberOfWords = 0;
+        batches.p_isPending[i]                   = 0;
+    }
+    // grab chunks until the wordlist is exhausted or all targets were found
+    while(atomic_load_explicit(&p_job->job.numberOfFound, memory_order_relaxed)
+          < p_job->job.p_targets->numberOfTargets)
+    {
+        chunk = atomic_fetch_add(&p_job->nextChunk,
+                                 1);
+        if(chunk >= p_job->numberOfChunks)
+            break;
+        p_curr     = p_job->p_words + chunk * CRACK_WORDLIST_CHUNK_SIZE;
+        p_chunkEnd = (chunk + 1 < p_job->numberOfChunks) ? p_curr + CRACK_WORDLIST_CHUNK_SIZE : p_end;
+        /*
+         *  A chunk owns the words that start in it: the tail of a word from
+         *  the previous chunk is skipped, the last word may reach into the next.
+         */
+        if(chunk > 0 && p_curr[-1] != '\n')
+        {
+            p_curr = memchr(p_curr,
+                            '\n',
+                            (size_t) (p_chunkEnd - p_curr));
+            if(p_curr == NULL)
+                continue;
+            p_curr++;
+        }
+        while(p_curr < p_chunkEnd)
+        {
+            p_lineEnd = memchr(p_curr,
+                               '\n',
+                               (size_t) (p_end - p_curr));
+            if(p_lineEnd == NULL)
+                p_lineEnd = p_end;
+            length = (size_t) (p_lineEnd - p_curr);
+            // wordlists with Windows line endings
+            if(length > 0 && p_curr[length - 1] == '\r')
+                length--;
+            if(length <= CRACK_MAX_WORD_LENGTH)
+                expandWord(p_job,
+                           &batches,
+                           p_curr,
+                           (unsigned int) length);
+            p_curr = p_lineEnd + 1;
+        }
+    }
+    // hash the words left in partially filled batches
+    for(unsigned int i = 0; i <= CRACK_SHA1_MAX_SHORT_LENGTH; i++)
+        if(batches.p_batches[i].numberOfWords > 0)
+            hashBatch(p_job,
+                      &batches.p_batches[i],
+                      i,
+                      NULL);
+
+    return NULL;
+}
+/**
+ * Function: expandWord
+ */
+static void expandWord
+(
+    struct wordlistJob *p_job,
+    struct wordBatches *p_batches,
+    const char         *p_word,
+    unsigned int       length
+)
+{
+    unsigned int           outputLength;
+    const struct crackRule *p_rule;
+    struct wordBatch       *p_batch;
+    if(p_job->numberOfRules == 0)
+    {
+        addWord(p_job,
+                p_batches,
+                p_word,
+                length,
+                0);
+        return;
+    }
+    // the rounds over the word are only precomputed once a rule keeps it at the front
+    p_batches->hasPrefix       = 0;
+    p_batches->numberOfPending = 0;
+    for(size_t i = 0; i < p_job->numberOfRules; i++)
+    {
+        p_rule = &p_job->p_rules[i];
+        // a rule of no-ops hashes the word in place
+        if(p_rule->length == 0)
+        {
+            addWord(p_job,
+                    p_batches,
+                    p_word,
+                    length,
+                    0);
+            continue;
+        }
+        outputLength = applyRule(p_rule,
+                                 p_word,
+                                 length,
+                                 p_batches->p_output);
+        if(outputLength == CRACK_RULE_REJECTED)
+            continue;
+        // only a word of at least one full word block saves rounds
+        if(p_rule->keepsWord && length >= 4 && outputLength <= CRACK_SHA1_MAX_SHORT_LENGTH)
+            addPrefixWord(p_job,
+                          p_batches,
+                          p_word,
+                          length,
+                          outputLength);
+        else
+            addWord(p_job,
+                    p_batches,
+                    p_batches->p_output,
+                    outputLength,
+                    1);
+    }
+    // outputs that did not fill a batch of their own join the other words of their length
+    for(unsigned int i = 0; i < p_batches->numberOfPending; i++)
+    {
+        p_batch = &p_batches->p_prefixBatches[p_batches->p_pendingLengths[i]];
+        p_batches->p_isPending[p_batches->p_pendingLengths[i]] = 0;
+        for(unsigned int lane = 0; lane < p_batch->numberOfWords; lane++)
+            addWord(p_job,
+                    p_batches,
+                    p_batch->pp_words[lane],
+                    p_batches->p_pendingLengths[i],
+                    1);
+        p_batch->numberOfWords = 0;
+    }
+}
+/**
+ * Function: addWord
+ */
+static void addWord
+(
+    struct wordlistJob *p_job,
+    struct wordBatches *p_batches,
+    const char         *p_word,
+    unsigned int       length,
+    int                isCopied
+)
+{
+    struct hash      digest;
+    struct wordBatch *p_batch;
+    // words that need more than one block are rare, they are hashed on their own
+    if(length > CRACK_SHA1_MAX_SHORT_LENGTH)
+    {
+        sha1(p_word,
+             length,
+             &digest);
+        checkDigest(p_job,
+                    &digest,
+                    p_word,
+                    length);
+        return;
+    }
+    // grouped by length, all lanes share the position of the padding and the length word
+    p_batch = &p_batches->p_batches[length];
+    if(isCopied)
+    {
+        memcpy(p_batch->p_storage[p_batch->numberOfWords],
+               p_word,
+               length);
+        p_word = p_batch->p_storage[p_batch->numberOfWords];
+    }
+    p_batch->pp_words[p_batch->numberOfWords++] = p_word;
+    if(p_batch->numberOfWords == numberOfSha1Lanes)
+        hashBatch(p_job,
+                  p_batch,
+                  length,
+                  NULL);
+}
+/**
+ * Function: addPrefixWord
+ */
+static void addPrefixWord
+(
+    struct wordlistJob *p_job,
+    struct wordBatches *p_batches,
+    const char         *p_word,
+    unsigned int       wordLength,
+    unsigned int       length
+)
+{
+    struct wordBatch *p_batch = &p_batches->p_prefixBatches[length];
+    // like precomputeOuterLoop, the rounds over the leading word blocks are done once per word
+    if(!p_batches->hasPrefix)
+    {
+        precomputeSha1Prefix(p_word,
+                             wordLength,
+                             &p_batches->prefix);
+        p_batches->hasPrefix = 1;
+    }
+    // a batch that was hashed fills up again under the same length
+    if(!p_batches->p_isPending[length])
+    {
+        p_batches->p_pendingLengths[p_batches->numberOfPending++] = length;
+        p_batches->p_isPending[length]                            = 1;
+    }
+    memcpy(p_batch->p_storage[p_batch->numberOfWords],
+           p_batches->p_output,
+           length);
+    p_batch->pp_words[p_batch->numberOfWords] = p_batch->p_storage[p_batch->numberOfWords];
+    p_batch->numberOfWords++;
+    if(p_batch->numberOfWords == numberOfSha1Lanes)
+        hashBatch(p_job,
+                  p_batch,
+                  length,
+                  &p_batches->prefix);
+}
+/**
+ * Function: hashBatch
+ */
+static void hashBatch
+(
+    struct wordlistJob      *p_job,
+    struct wordBatch        *p_batch,
+    unsigned int            length,
+    const struct sha1Prefix *p_prefix
+)
+{
+    unsigned int p_lengths[CRACK_SHA1_MAX_LANES];
+    struct hash  p_digests[CRACK_SHA1_MAX_LANES];
+    // a partial batch repeats its first word in the lanes left over
+    for(unsigned int lane = 0; lane < numberOfSha1Lanes; lane++)
+    {
+        if(lane >= p_batch->numberOfWords)
+            p_batch->pp_words[lane] = p_batch->pp_words[0];
+        p_lengths[lane] = length;
+    }
+    sha1MultiLanes(p_batch->pp_words,
+                   p_lengths,
+                   p_prefix,
+                   p_digests);
+    for(unsigned int lane = 0; lane < p_batch->numberOfWords; lane++)
+        checkDigest(p_job,
+                    &p_digests[lane],
+                    p_batch->pp_words[lane],
+                    length);
+    p_batch->numberOfWords = 0;
+}
+/**
+ * Function: checkDigest
+ */
+static void checkDigest
+(
+    struct wordlistJob *p_job,
+    const struct hash  *p_digest,
+    const char         *p_word,
+    unsigned int       length
+)
+{
+    const struct targetSet *p_set      = p_job->job.p_targets;
+    uint32_t               p_state[5]  = { p_digest->a - SHA1_IV_0,
+                                           p_digest->b - SHA1_IV_1,
+                                           p_digest->c - SHA1_IV_2,
+                                           p_digest->d - SHA1_IV_3,
+                                           p_digest->e - SHA1_IV_4 },
+                           key         = getEarlyExitKey(p_state);
+    // the same filters the kernels probe after round 74
+    if(LIKELY(!TARGET_SET_MAY_CONTAIN(p_set, key)))
+        return;
+    if(!targetSetContainsKey(p_set, key))
+        return;
+    reportCandidate(&p_job->job,
+                    p_state,
+                    p_word,
+                    length);
+}
@@ -15,32 +15,461 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 #include "testCracker.h"
+// __rdtsc
+#include <x86intrin.h>
+
+// defaults of the command line options
+#define BENCH_DEFAULT_WARMUPS   1
+#define BENCH_DEFAULT_TRIALS    5
+#define BENCH_DEFAULT_OUTPUT    "benchCracker.csv"
+#define BENCH_MAX_TRIALS        101
+// seed of the random targets of the scaling runs
+#define BENCH_SCALING_SEED      1
+
+struct benchTarget
+{
+    // label in the report
+    char        *p_name;
+    // NULL for a hash outside the keyspace (the whole keyspace is swept)
+    char        *p_preImage;
+    struct hash resultingHash;
+};
+
+// function prototypes
+int benchKernel(const char *p_kernel,
+                int        numberOfWarmups,
+                int        numberOfTrials,
+                FILE       *p_output);
+int benchScaling(unsigned int numberOfTargets,
+                 int          numberOfWarmups,
+                 int          numberOfTrials,
+                 FILE         *p_output);
+double getPercentile(double *p_values,
+                     int    numberOfValues,
+                     double percentile);
+int compareDoubles(const void *p_left,
+                   const void *p_right);
+double getWallNanoseconds(void);
+void printCounters(void);
+
+// first, middle (index 26^6 / 2) and last candidate of the default keyspace, plus a full sweep
+const struct benchTarget benchTargets[] = { { "first", "aaaaaa",
+                                            { 0xF7A9E247, 0x77EC2321, 0x2C54D7A3, 0x50BC5BEA, 0x5477FDBB }},
+                                            { "middle", "aaaana",
+                                            { 0xB7F38E79, 0xE638B4B5, 0x6165E8BC, 0x8DDE4D13, 0x59D48A23 }},
+                                            { "last", "zzzzzz",
+                                            { 0x984FF6EE, 0x7C78078D, 0x4CB1CA08, 0x255303FB, 0x8741D986 }},
+                                            { "exhaust", NULL,
+                                            { 0xDA39A3EE, 0x5E6B4B0D, 0x3255BFEF, 0x95601890, 0xAFD80709 }} };
+const char               *p_benchKernels[] = { "scalar", "sse2", "avx2", "avx512", "bitslice" };
 
 /**
  * Function: main
  */
-int main() 
-{
-    int         err;
-    char        p_result[6];
-    clock_t     start,
-                stop;
-    double      elapsed;
-    struct hash targetHash = { 0x984FF6EE, 0x7C78078D, 0x4CB1CA08, 0x255303FB, 0x8741D986 };
-
-    for(int i = 0; i < 5; i++)
-    {
-        start = clock();
-        err = crackHash(targetHash,
-                        p_result);
-        stop = clock();
-        elapsed = ((double) (stop - start)) * 1000.0 / CLOCKS_PER_SEC;
-        if(err == 0)
-            printf("Run#%d\nTime: %f\n\n", i,
-                                           elapsed);
+int main(int argc, char **argv)
+{
+    int          option,
+                 numberOfWarmups = BENCH_DEFAULT_WARMUPS,
+                 numberOfTrials  = BENCH_DEFAULT_TRIALS;
+    unsigned int numberOfTargets = 0;
+    const char   *p_kernel       = NULL,
+                 *p_path         = BENCH_DEFAULT_OUTPUT;
+    FILE         *p_output;
+    // -k kernel, -w warm-up runs, -t trials, -o CSV file, -s targets of the scaling runs
+    while((option = getopt(argc, argv, "k:w:t:o:s:")) != -1)
+    {
+        if(option == 'k')
+            p_kernel = optarg;
+        else if(option == 'w')
+            numberOfWarmups = atoi(optarg);
+        else if(option == 't')
+            numberOfTrials = atoi(optarg);
+        else if(option == 'o')
+            p_path = optarg;
+        else if(option == 's' && atoi(optarg) > 0)
+            numberOfTargets = (unsigned int) atoi(optarg);
         else
-            printf("An error occurred!\n\n");
+        {
+            printf("Usage: %s [-k kernel] [-w warm-up runs] [-t trials] [-o file] [-s targets]\n", argv[0]);
+            return 1;
+        }
     }
+    if(numberOfWarmups < 0 || numberOfTrials < 1 || numberOfTrials > BENCH_MAX_TRIALS)
+    {
+        printf("Between 1 and %d trials are supported!\n", BENCH_MAX_TRIALS);
+        return 1;
+    }
+    if((p_output = fopen(p_path, "w")) == NULL)
+    {
+        printf("Could not open %s!\n", p_path);
+        return 1;
+    }
+    // one row per kernel and target, times in nanoseconds
+    fprintf(p_output, "kernel,target,candidates,trials,median_ns,p10_ns,p90_ns,median_cycles,"
+                      "hashes_per_second,cycles_per_candidate\n");
+    // full sweeps on 1 to all cores instead, with and without thread placement and work stealing
+    if(numberOfTargets > 0)
+    {
+        if(p_kernel != NULL && selectCrackKernel(p_kernel) != 0)
+            printf("%-8s not supported by this CPU\n", p_kernel);
+        else
+            benchScaling(numberOfTargets,
+                         numberOfWarmups,
+                         numberOfTrials,
+                         p_output);
+        fclose(p_output);
+        printf("Results written to %s\n", p_path);
+        return 0;
+    }
+    printf("%-8s %-8s %12s %12s %12s %12s %10s %10s\n", "kernel",
+                                                        "target",
+                                                        "median ms",
+                                                        "p10 ms",
+                                                        "p90 ms",
+                                                        "MH/s",
+                                                        "cyc/cand",
+                                                        "candidates");
+    // every kernel the CPU supports (or the one selected)
+    for(size_t i = 0; i < sizeof(p_benchKernels) / sizeof(p_benchKernels[0]); i++)
+        if(p_kernel == NULL || strcmp(p_kernel, p_benchKernels[i]) == 0)
+            benchKernel(p_benchKernels[i],
+                        numberOfWarmups,
+                        numberOfTrials,
+                        p_output);
+    fclose(p_output);
+    printf("Results written to %s\n", p_path);
 
     return 0;
 }
+/**
+ * Function: benchKernel
+ */
+int benchKernel
+(
+    const char *p_kernel,
+    int        numberOfWarmups,
+    int        numberOfTrials,
+    FILE       *p_output
+)
+{
+    int                   err;
+    char                  p_result[PREIMAGE_LENGTH_BYTE];
+    double                p_nanoseconds[BENCH_MAX_TRIALS],
+                          p_cycles[BENCH_MAX_TRIALS],
+                          start,
+                          median,
+                          medianCycles;
+    uint64_t              startCycles,
+                          numberOfCandidates;
+    struct keyspaceLayout layout;
+    const struct keyspace keyspace = { CRACK_DEFAULT_CHARSET, PREIMAGE_LENGTH_BYTE, PREIMAGE_LENGTH_BYTE, NULL, { NULL } };
+    if(selectCrackKernel(p_kernel) != 0)
+    {
+        printf("%-8s not supported by this CPU\n", p_kernel);
+        return 1;
+    }
+    if(initKeyspaceLayout(&layout, &keyspace) != 0)
+        return 1;
+    for(size_t i = 0; i < sizeof(benchTargets) / sizeof(benchTargets[0]); i++)
+    {
+        // a single thread sweeps the slices in order, up to and including the target
+        if(benchTargets[i].p_preImage != NULL)
+            numberOfCandidates = getPreimageIndex(&layout,
+                                                  benchTargets[i].p_preImage,
+                                                  PREIMAGE_LENGTH_BYTE) + 1;
+        else
+            numberOfCandidates = getNumberOfCandidates(&layout);
+        for(int j = 0; j < numberOfWarmups; j++)
+            crackHash(benchTargets[i].resultingHash,
+                      p_result);
+        for(int j = 0; j < numberOfTrials; j++)
+        {
+            start       = getWallNanoseconds();
+            startCycles = __rdtsc();
+            err         = crackHash(benchTargets[i].resultingHash,
+                                    p_result);
+            p_cycles[j]      = (double) (__rdtsc() - startCycles);
+            p_nanoseconds[j] = getWallNanoseconds() - start;
+            if(err != ((benchTargets[i].p_preImage != NULL) ? 0 : E_CRACK_NOT_FOUND))
+            {
+                printf("%-8s %-8s failed!\n", p_kernel,
+                                              benchTargets[i].p_name);
+                freeKeyspaceLayout(&layout);
+                return 1;
+            }
+        }
+        median       = getPercentile(p_nanoseconds, numberOfTrials, 50.0);
+        medianCycles = getPercentile(p_cycles, numberOfTrials, 50.0);
+        /*
+         *  A found target ends the sweep within the slice that holds it, so only
+         *  the full sweep has a known number of candidates to rate. The other
+         *  rows report the wall-clock time to the preimage.
+         */
+        if(benchTargets[i].p_preImage != NULL)
+        {
+            printf("%-8s %-8s %12.3f %12.3f %12.3f %12s %10s %10llu\n", p_kernel,
+                                                                      benchTargets[i].p_name,
+                                                                      median / 1e6,
+                                                                      getPercentile(p_nanoseconds, numberOfTrials, 10.0) / 1e6,
+                                                                      getPercentile(p_nanoseconds, numberOfTrials, 90.0) / 1e6,
+                                                                      "-",
+                                                                      "-",
+                                                                      (unsigned long long) numberOfCandidates);
+            fprintf(p_output, "%s,%s,%llu,%d,%.0f,%.0f,%.0f,%.0f,,\n", p_kernel,
+                                                                      benchTargets[i].p_name,
+                                                                      (unsigned long long) numberOfCandidates,
+                                                                      numberOfTrials,
+                                                                      median,
+                                                                      getPercentile(p_nanoseconds, numberOfTrials, 10.0),
+                                                                      getPercentile(p_nanoseconds, numberOfTrials, 90.0),
+                                                                      medianCycles);
+        }
+        else
+        {
+            printf("%-8s %-8s %12.3f %12.3f %12.3f %12.2f %10.3f %10llu\n", p_kernel,
+                                                                            benchTargets[i].p_name,
+                                                                            median / 1e6,
+                                                                            getPercentile(p_nanoseconds, numberOfTrials, 10.0) / 1e6,
+                                                                            getPercentile(p_nanoseconds, numberOfTrials, 90.0) / 1e6,
+                                                                            numberOfCandidates / median * 1e3,
+                                                                            medianCycles / numberOfCandidates,
+                                                                            (unsigned long long) numberOfCandidates);
+            fprintf(p_output, "%s,%s,%llu,%d,%.0f,%.0f,%.0f,%.0f,%.0f,%.4f\n", p_kernel,
+                                                                              benchTargets[i].p_name,
+                                                                              (unsigned long long) numberOfCandidates,
+                                                                              numberOfTrials,
+                                                                              median,
+                                                                              getPercentile(p_nanoseconds, numberOfTrials, 10.0),
+                                                                              getPercentile(p_nanoseconds, numberOfTrials, 90.0),
+                                                                              medianCycles,
+                                                                              numberOfCandidates / median * 1e9,
+                                                                              medianCycles / numberOfCandidates);
+        }
+        fflush(p_output);
+        // hot path counters of the last trial
+        printCounters();
+    }
+    freeKeyspaceLayout(&layout);
+
+    return 0;
+}
+/**
+ * Function: benchScaling
+ */
+int benchScaling
+(
+    unsigned int numberOfTargets,
+    int          numberOfWarmups,
+    int          numberOfTrials,
+    FILE         *p_output
+)
+{
+    int                  err,
+                         wasPlaced   = getCrackPlacement(),
+                         wasStealing = getCrackStealing(),
+                         isPlaced,
+                         isStealing;
+    unsigned int         numberOfCores;
+    char                 p_name[48],
+                         *p_results;
+    double               p_nanoseconds[BENCH_MAX_TRIALS],
+                         p_cycles[BENCH_MAX_TRIALS],
+                         start,
+                         median,
+                         singleMedian = 0;
+    uint64_t             startCycles,
+                         numberOfCandidates = (uint64_t) CRACK_NUMBER_OF_SLICES * 26 * 26 * 26 * 26;
+    struct hash          *p_targets;
+    struct crackTopology topology;
+    // the cores placement would pin to, without placement as many threads
+    if(getCrackTopology(&topology) == 0)
+        numberOfCores = topology.numberOfCores;
+    else
+        numberOfCores = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+    p_targets = malloc(numberOfTargets * sizeof(struct hash));
+    p_results = malloc(numberOfTargets * PREIMAGE_LENGTH_BYTE);
+    if(p_targets == NULL || p_results == NULL)
+    {
+        free(p_targets);
+        free(p_results);
+        return 1;
+    }
+    // random targets are practically never in the keyspace, so every run sweeps all of it
+    srand(BENCH_SCALING_SEED);
+    // the hash outside the keyspace of the exhaust runs comes first
+    p_targets[0] = benchTargets[sizeof(benchTargets) / sizeof(benchTargets[0]) - 1].resultingHash;
+    for(unsigned int i = 1; i < numberOfTargets; i++)
+    {
+        p_targets[i].a = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+        p_targets[i].b = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+        p_targets[i].c = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+        p_targets[i].d = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+        p_targets[i].e = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+    }
+    printf("%-8s %8s %-9s %-8s %12s %12s %12s %12s %10s\n", "kernel",
+                                                          "threads",
+                                                          "placement",
+                                                          "slices",
+                                                      "median ms",
+                                                      "p10 ms",
+                                                      "p90 ms",
+                                                      "MH/s",
+                                                      "speedup");
+    // the shared slice counter is the baseline of work stealing
+    for(int run = 0; run < 4; run++)
+    {
+        isPlaced   = (run < 2);
+        isStealing = !(run & 1);
+        setCrackPlacement(isPlaced);
+        setCrackStealing(isStealing);
+        for(unsigned int threads = 1; threads <= numberOfCores; threads++)
+        {
+            for(int j = 0; j < numberOfWarmups; j++)
+                crackHashes(p_targets,
+                            numberOfTargets,
+                            p_results,
+                            threads);
+            for(int j = 0; j < numberOfTrials; j++)
+            {
+                start       = getWallNanoseconds();
+                startCycles = __rdtsc();
+                err         = crackHashes(p_targets,
+                                          numberOfTargets,
+                                          p_results,
+                                          threads);
+                p_cycles[j]      = (double) (__rdtsc() - startCycles);
+                p_nanoseconds[j] = getWallNanoseconds() - start;
+                if(err != E_CRACK_NOT_FOUND)
+                {
+                    printf("%-8s %8u failed!\n", getCrackKernelName(),
+                                                 threads);
+                    setCrackPlacement(wasPlaced);
+                    setCrackStealing(wasStealing);
+                    free(p_targets);
+                    free(p_results);
+                    return 1;
+                }
+            }
+            median = getPercentile(p_nanoseconds, numberOfTrials, 50.0);
+            if(threads == 1)
+                singleMedian = median;
+            printf("%-8s %8u %-9s %-8s %12.3f %12.3f %12.3f %12.2f %10.2f\n", getCrackKernelName(),
+                                                                             threads,
+                                                                             isPlaced ? "pinned" : "off",
+                                                                             isStealing ? "stealing" : "shared",
+                                                                             median / 1e6,
+                                                                             getPercentile(p_nanoseconds, numberOfTrials, 10.0) / 1e6,
+                                                                             getPercentile(p_nanoseconds, numberOfTrials, 90.0) / 1e6,
+                                                                             numberOfCandidates / median * 1e3,
+                                                                             singleMedian / median);
+            // same columns as the single thread runs, cycles are wall-clock TSC cycles
+            snprintf(p_name, sizeof(p_name), "scale-%u-%u-%s-%s", numberOfTargets,
+                                                                threads,
+                                                                isPlaced ? "pinned" : "off",
+                                                                isStealing ? "stealing" : "shared");
+            fprintf(p_output, "%s,%s,%llu,%d,%.0f,%.0f,%.0f,%.0f,%.0f,%.4f\n", getCrackKernelName(),
+                                                                              p_name,
+                                                                              (unsigned long long) numberOfCandidates,
+                                                                              numberOfTrials,
+                                                                              median,
+                                                                              getPercentile(p_nanoseconds, numberOfTrials, 10.0),
+                                                                              getPercentile(p_nanoseconds, numberOfTrials, 90.0),
+                                                                              getPercentile(p_cycles, numberOfTrials, 50.0),
+                                                                              numberOfCandidates / median * 1e9,
+                                                                              getPercentile(p_cycles, numberOfTrials, 50.0) / numberOfCandidates);
+            fflush(p_output);
+        }
+    }
+    setCrackPlacement(wasPlaced);
+    setCrackStealing(wasStealing);
+    free(p_targets);
+    free(p_results);
+
+    return 0;
+}
+/**
+ * Function: printCounters
+ */
+void printCounters
+(
+    void
+)
+{
+    unsigned int         numberOfThreads;
+    struct crackCounters p_counters[CRACK_MAX_THREADS];
+    // only an instrumented build (-DCRACK_INSTRUMENT) leaves counters behind
+    numberOfThreads = getCrackCounters(p_counters,
+                                       CRACK_MAX_THREADS);
+    for(unsigned int i = 0; i < numberOfThreads; i++)
+        printf("  thread %u: %llu slices (%llu ranges stolen), %llu candidates, %llu early exits passed, %llu keys passed, "
+               "%llu reported, %llu matched\n"
+               "  %llu outer precomputes (%.2f%% of cycles), %llu inner precomputes (%.2f%% of cycles), "
+               "%.3f cycles per candidate\n", i,
+                                               (unsigned long long) p_counters[i].slices,
+                                               (unsigned long long) p_counters[i].steals,
+                                               (unsigned long long) p_counters[i].candidates,
+                                               (unsigned long long) p_counters[i].earlyExitPassed,
+                                               (unsigned long long) p_counters[i].keyPassed,
+                                               (unsigned long long) p_counters[i].reported,
+                                               (unsigned long long) p_counters[i].matched,
+                                               (unsigned long long) p_counters[i].outerPrecomputes,
+                                               100.0 * p_counters[i].outerCycles / (p_counters[i].sliceCycles + 1),
+                                               (unsigned long long) p_counters[i].innerPrecomputes,
+                                               100.0 * p_counters[i].innerCycles / (p_counters[i].sliceCycles + 1),
+                                               (double) p_counters[i].sliceCycles / (p_counters[i].candidates + 1));
+}
+/**
+ * Function: getPercentile
+ */
+double getPercentile
+(
+    double *p_values,
+    int    numberOfValues,
+    double percentile
+)
+{
+    double position,
+           fraction;
+    int    lower;
+    // linear interpolation between the closest ranks
+    qsort(p_values,
+          numberOfValues,
+          sizeof(double),
+          compareDoubles);
+    position = percentile / 100.0 * (numberOfValues - 1);
+    lower    = (int) position;
+    fraction = position - lower;
+    if(lower + 1 >= numberOfValues)
+        return p_values[numberOfValues - 1];
+
+    return p_values[lower] + fraction * (p_values[lower + 1] - p_values[lower]);
+}
+/**
+ * Function: compareDoubles
+ */
+int compareDoubles
+(
+    const void *p_left,
+    const void *p_right
+)
+{
+    double left  = *(const double *) p_left,
+           right = *(const double *) p_right;
+
+    return (left > right) - (left < right);
+}
+/**
+ * Function: getWallNanoseconds
+ */
+double getWallNanoseconds
+(
+    void
+)
+{
+    struct timespec now;
+    // wall-clock time, unlike clock() which counts CPU time of all threads
+    clock_gettime(CLOCK_MONOTONIC,
+                  &now);
+
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
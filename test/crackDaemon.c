@@ -0,0 +1,66 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ * 
+ * This program is free software: you can redistribute it and/or modify  
+ * it under the terms of the GNU General Public License as published by  
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "testCracker.h"
+
+/**
+ * Function: main
+ */
+int main(int argc, char **argv)
+{
+    int             err;
+    unsigned int    numberOfThreads = 0;
+    const char      *p_path         = NULL;
+    struct keyspace keyspace        = { CRACK_DEFAULT_CHARSET, PREIMAGE_LENGTH_BYTE, PREIMAGE_LENGTH_BYTE, NULL, { NULL } };
+    // [-s socket] [-t threads] [-m mask]
+    for(int i = 1; i < argc; i += 2)
+    {
+        if(i + 1 < argc && strcmp(argv[i], "-s") == 0)
+            p_path = argv[i + 1];
+        else if(i + 1 < argc && strcmp(argv[i], "-t") == 0)
+            numberOfThreads = (unsigned int) atoi(argv[i + 1]);
+        else if(i + 1 < argc && strcmp(argv[i], "-m") == 0)
+        {
+            keyspace.p_mask    = argv[i + 1];
+            keyspace.minLength = 0;
+            keyspace.maxLength = 0;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-s socket] [-t threads] [-m mask]\n", argv[0]);
+            return 1;
+        }
+    }
+    // a reader that went away must not kill the daemon
+    signal(SIGPIPE,
+           SIG_IGN);
+    if(p_path != NULL)
+        err = listenCrackDaemon(p_path,
+                                &keyspace,
+                                numberOfThreads);
+    else
+        err = runCrackDaemon(STDIN_FILENO,
+                             STDOUT_FILENO,
+                             &keyspace,
+                             numberOfThreads);
+    if(err != 0)
+    {
+        fprintf(stderr, "The daemon stopped (error %d)!\n", err);
+        return 1;
+    }
+
+    return 0;
+}
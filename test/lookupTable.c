@@ -0,0 +1,117 @@
+/*
+ * This file is part of <https://github.com/cbscorpion/sha1-cracker>.
+ * Copyright (c) 2018 Christoph Buttler.
+ * 
+ * This program is free software: you can redistribute it and/or modify  
+ * it under the terms of the GNU General Public License as published by  
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but 
+ * WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License 
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "testCracker.h"
+
+// function prototypes
+int parseHash(const char  *p_hex,
+              struct hash *p_hash);
+
+/**
+ * Function: main
+ */
+int main(int argc, char **argv)
+{
+    int                err;
+    char               p_result[CRACK_RESULT_SIZE];
+    clock_t            start,
+                       stop;
+    struct hash        targetHash;
+    struct lookupTable table;
+    struct keyspace    keyspace = { CRACK_DEFAULT_CHARSET, PREIMAGE_LENGTH_BYTE, PREIMAGE_LENGTH_BYTE, NULL, { NULL } };
+    // build <file> [threads] or lookup <file> <hash>
+    if(argc >= 3 && strcmp(argv[1], "build") == 0)
+    {
+        start = clock();
+        err = buildLookupTable(argv[2],
+                               &keyspace,
+                               (argc > 3) ? (unsigned int) atoi(argv[3]) : 0);
+        stop = clock();
+        if(err != 0)
+        {
+            printf("Building %s failed (error %d)!\n", argv[2], err);
+            return 1;
+        }
+        printf("Built %s\nCPU time: %f s\n", argv[2],
+                                            ((double) (stop - start)) / CLOCKS_PER_SEC);
+    }
+    else if(argc == 4 && strcmp(argv[1], "lookup") == 0)
+    {
+        if(parseHash(argv[3], &targetHash) != 0)
+        {
+            printf("%s is not a SHA-1 hash!\n", argv[3]);
+            return 1;
+        }
+        if((err = openLookupTable(&table, argv[2])) != 0)
+        {
+            printf("Opening %s failed (error %d)!\n", argv[2], err);
+            return 1;
+        }
+        start = clock();
+        err = lookupHash(&table,
+                         targetHash,
+                         p_result);
+        stop = clock();
+        closeLookupTable(&table);
+        if(err == 0)
+            printf("Preimage: %s\n", p_result);
+        else
+            printf("Not found!\n");
+        printf("Time: %f us\n", ((double) (stop - start)) * 1000000.0 / CLOCKS_PER_SEC);
+    }
+    else
+    {
+        printf("Usage: %s build <file> [threads]\n       %s lookup <file> <hash>\n", argv[0],
+                                                                                  argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+/**
+ * Function: parseHash
+ */
+int parseHash
+(
+    const char  *p_hex,
+    struct hash *p_hash
+)
+{
+    uint32_t p_words[5] = { 0 };
+    char     digit;
+    if(strlen(p_hex) != 40)
+        return 1;
+    for(int i = 0; i < 40; i++)
+    {
+        digit = p_hex[i];
+        if(digit >= '0' && digit <= '9')
+            digit -= '0';
+        else if(digit >= 'a' && digit <= 'f')
+            digit -= 'a' - 10;
+        else if(digit >= 'A' && digit <= 'F')
+            digit -= 'A' - 10;
+        else
+            return 1;
+        p_words[i / 8] = (p_words[i / 8] << 4) | (uint32_t) digit;
+    }
+    p_hash->a = p_words[0];
+    p_hash->b = p_words[1];
+    p_hash->c = p_words[2];
+    p_hash->d = p_words[3];
+    p_hash->e = p_words[4];
+
+    return 0;
+}
@@ -16,9 +16,50 @@
  */
 #include "testCracker.h"
 
-// function prototype
+// function prototypes
 void printPreimageDiff(char *p_expected,
                        char *p_received);
+int testKeyspace(const struct keyspace         *p_keyspace,
+                 const struct crackSha1TestVec *p_testVectors,
+                 int                           numberOfTests);
+int testRange(const struct keyspace         *p_keyspace,
+              const struct crackSha1TestVec *p_testVectors,
+              int                           numberOfTests);
+int testSharded(const struct keyspace         *p_keyspace,
+                const struct crackSha1TestVec *p_testVectors,
+                int                           numberOfTests);
+int testCheckpoint(void);
+int testCheckpointTargets(void);
+int testCheckpointCorrupt(void);
+int patchCheckpointTargets(const char        *p_path,
+                           const struct hash *p_first,
+                           uint64_t          numberOfTargets);
+int testProgress(const struct keyspace *p_keyspace);
+int testSha1(const char *p_engine);
+int testWordlist(void);
+int testRules(const char *p_engine);
+void countProgress(const struct crackProgress *p_progress,
+                   void                       *p_context);
+int testScheduler(void);
+void *takeSlices(void *p_arg);
+int testTopology(void);
+int isTopology(const struct crackTopology *p_topology,
+               unsigned int               numberOfCores,
+               const unsigned int         *p_cpus,
+               const unsigned int         *p_nodes,
+               unsigned int               numberOfNodes);
+void writeSysfsFile(const char *p_root,
+                    const char *p_file,
+                    const char *p_text);
+void removeSysfsFile(const char *p_root,
+                     const char *p_file);
+int testPlacement(void);
+int testLookupTable(const struct keyspace         *p_keyspace,
+                    const struct crackSha1TestVec *p_testVectors,
+                    int                           numberOfTests);
+int testDaemon(const struct keyspace         *p_keyspace,
+               const struct crackSha1TestVec *p_testVectors,
+               int                           numberOfTests);
 
 // test vectors
 const struct crackSha1TestVec testVectors[] = { { "ananas",
@@ -31,16 +72,98 @@ const struct crackSha1TestVec testVectors[] = { { "ananas",
                                                 { 0xD6056E47, 0xD33A009D, 0x754613AF, 0xBB20A3A3, 0x86496177 }},
                                                 { "zzzzzz",
                                                 { 0x984FF6EE, 0x7C78078D, 0x4CB1CA08, 0x255303FB, 0x8741D986 }} };
+// test vectors for configurable keyspaces (all lengths of "ab1", up to four of alphanumerics)
+const struct keyspace         shortKeyspace      = { "ab1", 1, 12, NULL, { NULL } };
+const struct crackSha1TestVec shortTestVectors[] = { { "b",
+                                                     { 0xE9D71F5E, 0xE7C92D6D, 0xC9E92FFD, 0xAD17B8BD, 0x49418F98 }},
+                                                     { "1a",
+                                                     { 0x9B2C3280, 0xCCEA0BA4, 0x08270C45, 0x185BFBCD, 0x36164237 }},
+                                                     { "ab1",
+                                                     { 0xE175EA4C, 0xE0A55326, 0x0A14BC5E, 0x922A935B, 0x40425C1E }},
+                                                     { "1ba1",
+                                                     { 0x9CB97EA1, 0xB57A6A3B, 0x84AAFF39, 0x24A587B8, 0x8808C0B9 }},
+                                                     { "ba1ab",
+                                                     { 0x08426030, 0xBC78B8BF, 0x87A68EA1, 0x7520AD96, 0xFB15C2D8 }},
+                                                     { "111111a",
+                                                     { 0x02CD3D36, 0x6AF1835C, 0xA1A9C10D, 0x9401581F, 0xF1517F7E }},
+                                                     { "ab1ab1ab",
+                                                     { 0x031942B3, 0x3222BF34, 0x7DD729F3, 0xBA2EE13F, 0x66B8A42C }},
+                                                     { "bbbbbbbbbbb1",
+                                                     { 0xCF1A5A75, 0x0444CFC4, 0xBF8FCEFF, 0xF9D12350, 0xFC1F1C5C }},
+                                                     { "a1b1a1b1a1b1",
+                                                     { 0x249A8306, 0x4616526C, 0x41629AF3, 0xDAED82A3, 0x17F4006E }} };
+const struct keyspace         alnumKeyspace      = { "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", 1, 4, NULL, { NULL } };
+const struct crackSha1TestVec alnumTestVectors[] = { { "Z",
+                                                     { 0x909F99A7, 0x79ADB66A, 0x76FC53AB, 0x56C7DD1C, 0xAF35D0FD }},
+                                                     { "x9",
+                                                     { 0x316D9AAD, 0xFFDC8868, 0x8239AF8B, 0x11B6D602, 0x8CD665E3 }},
+                                                     { "Qz0",
+                                                     { 0xBBB92659, 0x8EC2EFF5, 0x2DBAC709, 0xF1F957C5, 0x92E05E15 }},
+                                                     { "A1b2",
+                                                     { 0x4F87B684, 0xE5151225, 0x801BF1E3, 0x828A8BF6, 0xBDE79F84 }} };
+// test vectors for masks (whole mask, literals with a custom charset, all prefixes of a mask)
+const struct keyspace         wordMask          = { NULL, 0, 0, "?u?l?l?l?d?d", { NULL } };
+const struct crackSha1TestVec wordTestVectors[] = { { "Pass12",
+                                                    { 0x0D203581, 0x19015198, 0x19B9B679, 0xA7390058, 0x3A42944A }},
+                                                    { "Zebr99",
+                                                    { 0x89FE07DA, 0xC1155B7B, 0x92AD2E63, 0xDD875137, 0x0232F0AB }} };
+const struct keyspace         leetMask          = { NULL, 0, 0, "p?1ss?d?d?d", { "aA@4" } };
+const struct crackSha1TestVec leetTestVectors[] = { { "p@ss007",
+                                                    { 0xD836C606, 0x1D9FE98D, 0x4B466E2E, 0x4BE16F50, 0xA0ABB3FA }},
+                                                    { "pAss123",
+                                                    { 0xAEBD8609, 0xFBC659BA, 0xD776F5E5, 0x47AE3FA2, 0x0BF85C2D }},
+                                                    { "p4ss900",
+                                                    { 0xDF8D6FC0, 0xF6EC3789, 0xE4DCAEC0, 0x21D41DF2, 0x2FAA3A3C }} };
+const struct keyspace         bitMask          = { NULL, 1, 8, "?1?1?1?1?1?1?1?1", { "01" } };
+const struct crackSha1TestVec bitTestVectors[] = { { "0",
+                                                   { 0xB6589FC6, 0xAB0DC82C, 0xF12099D1, 0xC2D40AB9, 0x94E8410C }},
+                                                   { "01",
+                                                   { 0xDDFE1633, 0x45D33819, 0x3AC2BDC1, 0x83F8E9DC, 0xFF904B43 }},
+                                                   { "1011",
+                                                   { 0xDD2DFA50, 0xDC8FECA1, 0xE5303A87, 0xB2C6A42D, 0xB3EBE102 }},
+                                                   { "10110011",
+                                                   { 0x1CCB2999, 0xF43A2F3B, 0x9C735BA1, 0xAE7E28FB, 0x77DD854F }} };
+// lookup table over the short test vectors up to length 8
+const struct keyspace         tableKeyspace      = { "ab1", 1, 8, NULL, { NULL } };
+// the keyspace of the hand-tuned kernels
+const struct keyspace         defaultKeyspace    = { CRACK_DEFAULT_CHARSET, PREIMAGE_LENGTH_BYTE, PREIMAGE_LENGTH_BYTE, NULL, { NULL } };
+// FIPS 180 examples for the full SHA-1 (one, two and three blocks)
+const struct crackSha1TestVec sha1TestVectors[] = { { "abc",
+                                                    { 0xA9993E36, 0x4706816A, 0xBA3E2571, 0x7850C26C, 0x9CD0D89D }},
+                                                    { "",
+                                                    { 0xDA39A3EE, 0x5E6B4B0D, 0x3255BFEF, 0x95601890, 0xAFD80709 }},
+                                                    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+                                                    { 0x84983E44, 0x1C3BD26E, 0xBAAE4AA1, 0xF95129E5, 0xE54670F1 }},
+                                                    { "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+                                                    { 0xA49B2446, 0xA02C645B, 0xF419F995, 0xB6709125, 0x3A04A259 }} };
+// SHA-1 of one million times 'a'
+const struct hash millionHash = { 0x34AA973C, 0xD4C4DAA4, 0xF61EEB2B, 0xDBAD2731, 0x6534016F };
+// SHA-1 of the empty string, which is not part of any keyspace
+const struct hash unreachableHash = { 0xDA39A3EE, 0x5E6B4B0D, 0x3255BFEF, 0x95601890, 0xAFD80709 };
 
 /**
  * Function: main
  */
-int main()
+int main(int argc, char **argv)
 {
-    int  numberOfTests = sizeof(testVectors) / sizeof(struct crackSha1TestVec),
-         testsPassed   = 0;
-    char p_result[6];
-    printf("Testing SHA1-Cracker...\n");
+    int         numberOfTests = sizeof(testVectors) / sizeof(struct crackSha1TestVec),
+                testsPassed   = 0;
+    char        p_result[6],
+                p_results[(sizeof(testVectors) / sizeof(struct crackSha1TestVec) + 1) * 6];
+    struct hash p_targets[sizeof(testVectors) / sizeof(struct crackSha1TestVec) + 1];
+    // an optional argument selects the kernel under test
+    if(argc > 1 && selectCrackKernel(argv[1]) != 0)
+    {
+        printf("Kernel %s is not supported!\n", argv[1]);
+        return 1;
+    }
+    // full SHA-1 engines used to confirm preimages and to build lookup tables
+    testSha1("scalar");
+    testSha1("sse2");
+    testSha1("avx2");
+    testSha1("sha-ni");
+    testSha1("sha-ni-avx2");
+    printf("Testing SHA1-Cracker (%s kernel)...\n", getCrackKernelName());
     for(int i = 0; i < numberOfTests; i++)
     {
         if(crackHash(testVectors[i].resultingHash,
@@ -57,6 +180,115 @@ int main()
     }
     printf("Passed %d/%d!\n", testsPassed,
                               numberOfTests);
+    testsPassed = 0;
+    printf("Testing SHA1-Cracker with %d threads...\n", TEST_NUMBER_OF_THREADS);
+    for(int i = 0; i < numberOfTests; i++)
+    {
+        if(crackHashParallel(testVectors[i].resultingHash,
+                             p_result,
+                             TEST_NUMBER_OF_THREADS) == 0)
+        {
+            if(memcmp(testVectors[i].p_preImage,
+                      p_result,
+                      6) == 0)
+                testsPassed++;
+            else
+                printPreimageDiff(testVectors[i].p_preImage,
+                                  p_result);
+        }
+    }
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests);
+    // all test vectors plus one unreachable hash in a single sweep
+    testsPassed = 0;
+    printf("Testing SHA1-Cracker with %d targets at once...\n", numberOfTests + 1);
+    for(int i = 0; i < numberOfTests; i++)
+        p_targets[i] = testVectors[i].resultingHash;
+    p_targets[numberOfTests] = unreachableHash;
+    if(crackHashes(p_targets,
+                   numberOfTests + 1,
+                   p_results,
+                   TEST_NUMBER_OF_THREADS) == E_CRACK_NOT_FOUND)
+    {
+        for(int i = 0; i < numberOfTests; i++)
+        {
+            if(memcmp(testVectors[i].p_preImage,
+                      &p_results[i * 6],
+                      6) == 0)
+                testsPassed++;
+            else
+                printPreimageDiff(testVectors[i].p_preImage,
+                                  &p_results[i * 6]);
+        }
+        // the unreachable hash must come back empty
+        if(p_results[numberOfTests * 6] == 0)
+            testsPassed++;
+    }
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests + 1);
+    // configurable keyspaces
+    testKeyspace(&shortKeyspace,
+                 shortTestVectors,
+                 sizeof(shortTestVectors) / sizeof(struct crackSha1TestVec));
+    testKeyspace(&alnumKeyspace,
+                 alnumTestVectors,
+                 sizeof(alnumTestVectors) / sizeof(struct crackSha1TestVec));
+    // masks
+    testKeyspace(&wordMask,
+                 wordTestVectors,
+                 sizeof(wordTestVectors) / sizeof(struct crackSha1TestVec));
+    testKeyspace(&leetMask,
+                 leetTestVectors,
+                 sizeof(leetTestVectors) / sizeof(struct crackSha1TestVec));
+    testKeyspace(&bitMask,
+                 bitTestVectors,
+                 sizeof(bitTestVectors) / sizeof(struct crackSha1TestVec));
+    // ranges of the keyspace and shards over worker processes
+    testRange(&shortKeyspace,
+              shortTestVectors,
+              sizeof(shortTestVectors) / sizeof(struct crackSha1TestVec));
+    testSharded(&shortKeyspace,
+                shortTestVectors,
+                sizeof(shortTestVectors) / sizeof(struct crackSha1TestVec));
+    testSharded(&defaultKeyspace,
+                testVectors,
+                numberOfTests);
+    // interrupted and resumed sweep
+    testCheckpoint();
+    // resumed sweep with more targets than the interrupted one
+    testCheckpointTargets();
+    // checkpoint with a corrupt count of targets
+    testCheckpointCorrupt();
+    // progress reported once per slice
+    testProgress(&shortKeyspace);
+    testProgress(&defaultKeyspace);
+    // slices stolen between the workers
+    testScheduler();
+    // cores and nodes of the sysfs topology
+    testTopology();
+    // cores claimed by a sweep and taken in turn by worker processes
+    testPlacement();
+    // dictionary attack
+    testWordlist();
+    // rules applied to the words of the wordlist
+    testRules("scalar");
+    testRules("sse2");
+    testRules("avx2");
+    testRules("sha-ni-avx2");
+    // precomputed lookup tables
+    testLookupTable(&tableKeyspace,
+                    shortTestVectors,
+                    7);
+    testLookupTable(&bitMask,
+                    bitTestVectors,
+                    sizeof(bitTestVectors) / sizeof(struct crackSha1TestVec));
+    // hex digests streamed to a daemon
+    testDaemon(&shortKeyspace,
+               shortTestVectors,
+               sizeof(shortTestVectors) / sizeof(struct crackSha1TestVec));
+    testDaemon(&defaultKeyspace,
+               testVectors,
+               numberOfTests);
 
 	return 0;
 }
@@ -82,3 +314,1348 @@ void printPreimageDiff
                                          p_received[4],
                                          p_received[5]);
 }
+/**
+ * Function: testKeyspace
+ */
+int testKeyspace
+(
+    const struct keyspace         *p_keyspace,
+    const struct crackSha1TestVec *p_testVectors,
+    int                           numberOfTests
+)
+{
+    int         testsPassed = 0;
+    char        p_results[(TEST_MAX_KEYSPACE_VECTORS + 1) * CRACK_RESULT_SIZE];
+    struct hash p_targets[TEST_MAX_KEYSPACE_VECTORS + 1];
+    if(p_keyspace->p_mask != NULL)
+        printf("Testing SHA1-Cracker with mask \"%s\"...\n", p_keyspace->p_mask);
+    else
+        printf("Testing SHA1-Cracker with charset \"%s\" and lengths %u - %u...\n", p_keyspace->p_charset,
+                                                                                      p_keyspace->minLength,
+                                                                                      p_keyspace->maxLength);
+    // all test vectors plus one unreachable hash in a single sweep
+    for(int i = 0; i < numberOfTests; i++)
+        p_targets[i] = p_testVectors[i].resultingHash;
+    p_targets[numberOfTests] = unreachableHash;
+    if(crackHashesInKeyspace(p_targets,
+                             numberOfTests + 1,
+                             p_keyspace,
+                             p_results,
+                             TEST_NUMBER_OF_THREADS) == E_CRACK_NOT_FOUND)
+    {
+        for(int i = 0; i < numberOfTests; i++)
+        {
+            if(strcmp(p_testVectors[i].p_preImage,
+                      &p_results[i * CRACK_RESULT_SIZE]) == 0)
+                testsPassed++;
+            else
+                printf("\nExpected: %s\nReceived: %s\n\n", p_testVectors[i].p_preImage,
+                                                             &p_results[i * CRACK_RESULT_SIZE]);
+        }
+        // the unreachable hash must come back empty
+        if(p_results[numberOfTests * CRACK_RESULT_SIZE] == '\0')
+            testsPassed++;
+    }
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests + 1);
+
+    return testsPassed;
+}
+/**
+ * Function: testRules
+ */
+int testRules
+(
+    const char *p_engine
+)
+{
+    int              testsPassed     = 0,
+                     numberOfTargets = 0,
+                     fd;
+    char             p_path[]        = TEST_WORDLIST_PATH,
+                     p_appendPath[]  = TEST_WORDLIST_PATH,
+                     p_longWord[61],
+                     p_appendResults[2 * CRACK_WORD_RESULT_SIZE],
+                     *p_appendRules,
+                     *p_curr,
+                     p_output[CRACK_MAX_WORD_LENGTH],
+                     *p_results;
+    const char       *p_best         = getSha1EngineName(),
+                     *pp_words[]     = { "password", "letmein", "abc", "dragonfly", "correcthorsebatterystaple" },
+                     *pp_expected[]  = { "Password", "letmein", "ABC", "dragonfly12", "xletmein", "p@ssword", "cba",
+                                         "dragonflydragonfly", "letmein!", "dragonfly5", "correcthorsebatterystaple3",
+                                         NULL, NULL },
+                     *p_rules        = "c\n"
+                                       ":\n"
+                                       "u\n"
+                                       "# appended digits keep the word in front\n"
+                                       "$1 $2\n"
+                                       "^x\n"
+                                       "sa@\n"
+                                       "r\n"
+                                       "d\n"
+                                       "\n"
+                                       "$!\r\n"
+                                       "$0\n$1\n$2\n$3\n$4\n$5\n$6\n$7\n";
+    size_t           numberOfChars   = strlen(TEST_RULE_CHARSET);
+    struct hash      p_targets[TEST_MAX_KEYSPACE_VECTORS];
+    struct crackRule *p_parsed;
+    size_t           numberOfRules;
+    FILE             *p_file;
+    if(selectSha1Engine(p_engine) != 0)
+    {
+        printf("SHA-1 engine %s is not supported!\n", p_engine);
+        return 0;
+    }
+    printf("Testing SHA1-Cracker with rules on SHA-1 engine %s...\n", p_engine);
+    if((fd = mkstemp(p_path)) < 0 || (p_file = fdopen(fd, "w")) == NULL)
+    {
+        printf("Could not create %s!\n", p_path);
+        selectSha1Engine(p_best);
+        return 0;
+    }
+    // a word that needs two blocks once digits are appended
+    memset(p_longWord,
+           'w',
+           sizeof(p_longWord) - 1);
+    p_longWord[sizeof(p_longWord) - 1] = '\0';
+    for(size_t i = 0; i < sizeof(pp_words) / sizeof(pp_words[0]); i++)
+        fprintf(p_file, "%s\n", pp_words[i]);
+    fprintf(p_file, "%s\n", p_longWord);
+    fclose(p_file);
+    strcpy(p_output,
+           p_longWord);
+    strcat(p_output,
+           "12");
+    pp_expected[11] = p_output;
+    while(pp_expected[numberOfTargets] != NULL)
+    {
+        sha1(pp_expected[numberOfTargets],
+             strlen(pp_expected[numberOfTargets]),
+             &p_targets[numberOfTargets]);
+        numberOfTargets++;
+    }
+    p_targets[numberOfTargets++] = unreachableHash;
+    p_results = malloc((size_t) numberOfTargets * CRACK_WORD_RESULT_SIZE);
+    if(p_results != NULL
+       && crackHashesWithRules(p_targets,
+                               (size_t) numberOfTargets,
+                               p_path,
+                               p_rules,
+                               p_results,
+                               TEST_NUMBER_OF_THREADS) == E_CRACK_NOT_FOUND)
+    {
+        for(int i = 0; i < numberOfTargets - 1; i++)
+            if(strcmp(pp_expected[i],
+                      &p_results[i * CRACK_WORD_RESULT_SIZE]) == 0)
+                testsPassed++;
+        // the unreachable hash must come back empty
+        if(p_results[(numberOfTargets - 1) * CRACK_WORD_RESULT_SIZE] == '\0')
+            testsPassed++;
+    }
+    free(p_results);
+    unlink(p_path);
+    /*
+     *  One word with far more append rules than its prefix batches hold: the
+     *  batch of a length is hashed and filled again many times over.
+     */
+    p_appendRules = malloc(numberOfChars * numberOfChars * 5 + 1);
+    if(p_appendRules != NULL && (fd = mkstemp(p_appendPath)) >= 0 && (p_file = fdopen(fd, "w")) != NULL)
+    {
+        fprintf(p_file, "abcde\n");
+        fclose(p_file);
+        p_curr = p_appendRules;
+        for(size_t i = 0; i < numberOfChars; i++)
+            for(size_t j = 0; j < numberOfChars; j++)
+                p_curr += sprintf(p_curr, "$%c$%c\n", TEST_RULE_CHARSET[i], TEST_RULE_CHARSET[j]);
+        sha1("abcde00", 7, &p_targets[0]);
+        sha1("abcdezz", 7, &p_targets[1]);
+        if(crackHashesWithRules(p_targets,
+                                2,
+                                p_appendPath,
+                                p_appendRules,
+                                p_appendResults,
+                                TEST_NUMBER_OF_THREADS) == 0
+           && strcmp(p_appendResults, "abcde00") == 0
+           && strcmp(p_appendResults + CRACK_WORD_RESULT_SIZE, "abcdezz") == 0)
+            testsPassed++;
+        unlink(p_appendPath);
+    }
+    free(p_appendRules);
+    // unknown functions and missing operands are rejected
+    if(parseRules("c\nsa\n", &p_parsed, &numberOfRules) == E_CRACK_BAD_RULE
+       && parseRules("z\n", &p_parsed, &numberOfRules) == E_CRACK_BAD_RULE)
+        testsPassed++;
+    selectSha1Engine(p_best);
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTargets + 2);
+
+    return testsPassed;
+}
+/**
+ * Function: testLookupTable
+ */
+int testLookupTable
+(
+    const struct keyspace         *p_keyspace,
+    const struct crackSha1TestVec *p_testVectors,
+    int                           numberOfTests
+)
+{
+    int                testsPassed = 0,
+                       fd;
+    char               p_path[]    = TEST_TABLE_PATH,
+                       p_result[CRACK_RESULT_SIZE];
+    struct lookupTable table;
+    if(p_keyspace->p_mask != NULL)
+        printf("Testing lookup table with mask \"%s\"...\n", p_keyspace->p_mask);
+    else
+        printf("Testing lookup table with charset \"%s\" and lengths %u - %u...\n", p_keyspace->p_charset,
+                                                                                     p_keyspace->minLength,
+                                                                                     p_keyspace->maxLength);
+    if((fd = mkstemp(p_path)) < 0)
+    {
+        printf("Could not create %s!\n", p_path);
+        return 0;
+    }
+    close(fd);
+    if(buildLookupTable(p_path,
+                        p_keyspace,
+                        TEST_NUMBER_OF_THREADS) == 0
+       && openLookupTable(&table,
+                          p_path) == 0)
+    {
+        for(int i = 0; i < numberOfTests; i++)
+        {
+            if(lookupHash(&table,
+                          p_testVectors[i].resultingHash,
+                          p_result) == 0
+               && strcmp(p_testVectors[i].p_preImage,
+                         p_result) == 0)
+                testsPassed++;
+            else
+                printf("\nExpected: %s\nReceived: %s\n\n", p_testVectors[i].p_preImage,
+                                                             p_result);
+        }
+        // the unreachable hash must not be found
+        if(lookupHash(&table,
+                      unreachableHash,
+                      p_result) == E_CRACK_NOT_FOUND)
+            testsPassed++;
+        closeLookupTable(&table);
+    }
+    unlink(p_path);
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests + 1);
+
+    return testsPassed;
+}
+/**
+ * Function: testRange
+ */
+int testRange
+(
+    const struct keyspace         *p_keyspace,
+    const struct crackSha1TestVec *p_testVectors,
+    int                           numberOfTests
+)
+{
+    int                   testsPassed = 0;
+    char                  p_result[CRACK_RESULT_SIZE];
+    uint64_t              index,
+                          numberOfCandidates;
+    struct keyspaceLayout layout;
+    printf("Testing SHA1-Cracker with ranges of charset \"%s\" and lengths %u - %u...\n", p_keyspace->p_charset,
+                                                                                           p_keyspace->minLength,
+                                                                                           p_keyspace->maxLength);
+    if(initKeyspaceLayout(&layout, p_keyspace) != 0)
+        return 0;
+    numberOfCandidates = getNumberOfCandidates(&layout);
+    // a preimage is found by the range holding its index only
+    for(int i = 0; i < numberOfTests; i++)
+    {
+        index = getPreimageIndex(&layout,
+                                 p_testVectors[i].p_preImage,
+                                 (unsigned int) strlen(p_testVectors[i].p_preImage));
+        if(crackHashRange(p_testVectors[i].resultingHash,
+                          index,
+                          index + 1,
+                          p_keyspace,
+                          p_result,
+                          TEST_NUMBER_OF_THREADS) == 0
+           && strcmp(p_testVectors[i].p_preImage,
+                     p_result) == 0
+           && crackHashRange(p_testVectors[i].resultingHash,
+                             0,
+                             index,
+                             p_keyspace,
+                             p_result,
+                             TEST_NUMBER_OF_THREADS) == E_CRACK_NOT_FOUND
+           && crackHashRange(p_testVectors[i].resultingHash,
+                             index + 1,
+                             numberOfCandidates,
+                             p_keyspace,
+                             p_result,
+                             TEST_NUMBER_OF_THREADS) == E_CRACK_NOT_FOUND)
+            testsPassed++;
+        else
+            printf("\nRange of %s (index %llu) failed!\n\n", p_testVectors[i].p_preImage,
+                                                             (unsigned long long) index);
+    }
+    freeKeyspaceLayout(&layout);
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests);
+
+    return testsPassed;
+}
+/**
+ * Function: testSharded
+ */
+int testSharded
+(
+    const struct keyspace         *p_keyspace,
+    const struct crackSha1TestVec *p_testVectors,
+    int                           numberOfTests
+)
+{
+    int         testsPassed = 0;
+    char        p_results[(TEST_MAX_KEYSPACE_VECTORS + 1) * CRACK_RESULT_SIZE];
+    struct hash p_targets[TEST_MAX_KEYSPACE_VECTORS + 1];
+    printf("Testing SHA1-Cracker with charset \"%s\" and lengths %u - %u on %d processes...\n", p_keyspace->p_charset,
+                                                                                                p_keyspace->minLength,
+                                                                                                p_keyspace->maxLength,
+                                                                                                TEST_NUMBER_OF_PROCESSES);
+    // all test vectors plus one unreachable hash sweep every shard
+    for(int i = 0; i < numberOfTests; i++)
+        p_targets[i] = p_testVectors[i].resultingHash;
+    p_targets[numberOfTests] = unreachableHash;
+    if(crackHashesSharded(p_targets,
+                          numberOfTests + 1,
+                          p_keyspace,
+                          p_results,
+                          TEST_NUMBER_OF_PROCESSES,
+                          0) == E_CRACK_NOT_FOUND)
+    {
+        for(int i = 0; i < numberOfTests; i++)
+        {
+            if(strcmp(p_testVectors[i].p_preImage,
+                      &p_results[i * CRACK_RESULT_SIZE]) == 0)
+                testsPassed++;
+            else
+                printf("\nExpected: %s\nReceived: %s\n\n", p_testVectors[i].p_preImage,
+                                                             &p_results[i * CRACK_RESULT_SIZE]);
+        }
+        // the unreachable hash must come back empty
+        if(p_results[numberOfTests * CRACK_RESULT_SIZE] == '\0')
+            testsPassed++;
+    }
+    // a single target cancels the remaining shards once it is found
+    if(crackHashesSharded(&p_testVectors[0].resultingHash,
+                          1,
+                          p_keyspace,
+                          p_results,
+                          TEST_NUMBER_OF_PROCESSES,
+                          0) == 0
+       && strcmp(p_testVectors[0].p_preImage,
+                 p_results) == 0)
+        testsPassed++;
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests + 2);
+
+    return testsPassed;
+}
+/**
+ * Function: testCheckpoint
+ */
+int testCheckpoint
+(
+    void
+)
+{
+    int               numberOfTests = sizeof(testVectors) / sizeof(struct crackSha1TestVec),
+                      testsPassed   = 0,
+                      fd,
+                      waited        = 0;
+    char              p_path[]      = TEST_TABLE_PATH,
+                      p_results[(sizeof(testVectors) / sizeof(struct crackSha1TestVec) + 1) * CRACK_RESULT_SIZE];
+    pid_t             child;
+    struct hash       p_targets[sizeof(testVectors) / sizeof(struct crackSha1TestVec) + 1];
+    struct checkpoint checkpoint    = { p_path, 0 };
+    printf("Testing SHA1-Cracker with an interrupted sweep...\n");
+    // only the name is needed, the sweep must not find an empty checkpoint
+    if((fd = mkstemp(p_path)) < 0)
+    {
+        printf("Could not create %s!\n", p_path);
+        return 0;
+    }
+    close(fd);
+    unlink(p_path);
+    for(int i = 0; i < numberOfTests; i++)
+        p_targets[i] = testVectors[i].resultingHash;
+    p_targets[numberOfTests] = unreachableHash;
+    // a child process starts the sweep and is killed after its first checkpoint
+    if((child = fork()) == 0)
+    {
+        crackHashesWithCheckpoint(p_targets,
+                                  numberOfTests + 1,
+                                  &defaultKeyspace,
+                                  p_results,
+                                  1,
+                                  &checkpoint);
+        _exit(0);
+    }
+    while(child > 0 && access(p_path, F_OK) != 0 && waited++ < TEST_CHECKPOINT_TIMEOUT)
+        usleep(1000);
+    if(child > 0)
+    {
+        kill(child,
+             SIGKILL);
+        waitpid(child,
+                NULL,
+                0);
+    }
+    // the resumed sweep has to find everything the interrupted one did not
+    if(access(p_path, F_OK) == 0
+       && crackHashesWithCheckpoint(p_targets,
+                                    numberOfTests + 1,
+                                    &defaultKeyspace,
+                                    p_results,
+                                    TEST_NUMBER_OF_THREADS,
+                                    &checkpoint) == E_CRACK_NOT_FOUND)
+    {
+        for(int i = 0; i < numberOfTests; i++)
+        {
+            if(strcmp(testVectors[i].p_preImage,
+                      &p_results[i * CRACK_RESULT_SIZE]) == 0)
+                testsPassed++;
+            else
+                printf("\nExpected: %s\nReceived: %s\n\n", testVectors[i].p_preImage,
+                                                             &p_results[i * CRACK_RESULT_SIZE]);
+        }
+        // the unreachable hash must come back empty and the finished sweep leaves no checkpoint
+        if(p_results[numberOfTests * CRACK_RESULT_SIZE] == '\0' && access(p_path, F_OK) != 0)
+            testsPassed++;
+    }
+    unlink(p_path);
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests + 1);
+
+    return testsPassed;
+}
+/**
+ * Function: testCheckpointTargets
+ */
+int testCheckpointTargets
+(
+    void
+)
+{
+    int               numberOfTests = sizeof(testVectors) / sizeof(struct crackSha1TestVec),
+                      testsPassed   = 0,
+                      fd,
+                      waited        = 0;
+    char              p_path[]      = TEST_TABLE_PATH,
+                      p_late[]      = "lateaa",
+                      p_results[(sizeof(testVectors) / sizeof(struct crackSha1TestVec) + 2) * CRACK_RESULT_SIZE];
+    pid_t             child;
+    struct hash       p_targets[sizeof(testVectors) / sizeof(struct crackSha1TestVec) + 2];
+    struct checkpoint checkpoint    = { p_path, 0 };
+    printf("Testing SHA1-Cracker with targets added to an interrupted sweep...\n");
+    if((fd = mkstemp(p_path)) < 0)
+    {
+        printf("Could not create %s!\n", p_path);
+        return 0;
+    }
+    close(fd);
+    unlink(p_path);
+    // the interrupted sweep only has the test vectors after the first one
+    for(int i = 1; i < numberOfTests; i++)
+        p_targets[i - 1] = testVectors[i].resultingHash;
+    p_targets[numberOfTests - 1] = unreachableHash;
+    if((child = fork()) == 0)
+    {
+        crackHashesWithCheckpoint(p_targets,
+                                  (size_t) numberOfTests,
+                                  &defaultKeyspace,
+                                  p_results,
+                                  1,
+                                  &checkpoint);
+        _exit(0);
+    }
+    while(child > 0 && access(p_path, F_OK) != 0 && waited++ < TEST_CHECKPOINT_TIMEOUT)
+        usleep(1000);
+    if(child > 0)
+    {
+        kill(child,
+             SIGKILL);
+        waitpid(child,
+                NULL,
+                0);
+    }
+    /*
+     *  The resumed sweep adds the first test vector and one in the first slice,
+     *  which the checkpoint holds as completed, in a different order.
+     */
+    sha1(p_late,
+         strlen(p_late),
+         &p_targets[0]);
+    for(int i = 0; i < numberOfTests; i++)
+        p_targets[i + 1] = testVectors[i].resultingHash;
+    p_targets[numberOfTests + 1] = unreachableHash;
+    if(access(p_path, F_OK) == 0
+       && crackHashesWithCheckpoint(p_targets,
+                                    (size_t) numberOfTests + 2,
+                                    &defaultKeyspace,
+                                    p_results,
+                                    TEST_NUMBER_OF_THREADS,
+                                    &checkpoint) == E_CRACK_NOT_FOUND)
+    {
+        if(strcmp(p_late, p_results) == 0)
+            testsPassed++;
+        else
+            printf("\nExpected: %s\nReceived: %s\n\n", p_late,
+                                                         p_results);
+        for(int i = 0; i < numberOfTests; i++)
+        {
+            if(strcmp(testVectors[i].p_preImage,
+                      &p_results[(i + 1) * CRACK_RESULT_SIZE]) == 0)
+                testsPassed++;
+            else
+                printf("\nExpected: %s\nReceived: %s\n\n", testVectors[i].p_preImage,
+                                                             &p_results[(i + 1) * CRACK_RESULT_SIZE]);
+        }
+        if(p_results[(numberOfTests + 1) * CRACK_RESULT_SIZE] == '\0' && access(p_path, F_OK) != 0)
+            testsPassed++;
+    }
+    unlink(p_path);
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests + 2);
+
+    return testsPassed;
+}
+/**
+ * Function: testCheckpointCorrupt
+ */
+int testCheckpointCorrupt
+(
+    void
+)
+{
+    int               numberOfTests = sizeof(testVectors) / sizeof(struct crackSha1TestVec),
+                      testsPassed   = 0,
+                      fd,
+                      waited        = 0;
+    char              p_path[]      = TEST_TABLE_PATH,
+                      p_results[(sizeof(testVectors) / sizeof(struct crackSha1TestVec)) * CRACK_RESULT_SIZE];
+    const uint64_t    p_counts[]    = { UINT64_C(1) << 60, numberOfTests + 1 };
+    pid_t             child;
+    struct hash       p_targets[sizeof(testVectors) / sizeof(struct crackSha1TestVec)];
+    struct checkpoint checkpoint    = { p_path, 0 };
+    printf("Testing SHA1-Cracker with a corrupt checkpoint...\n");
+    if((fd = mkstemp(p_path)) < 0)
+    {
+        printf("Could not create %s!\n", p_path);
+        return 0;
+    }
+    close(fd);
+    unlink(p_path);
+    for(int i = 0; i < numberOfTests; i++)
+        p_targets[i] = testVectors[i].resultingHash;
+    if((child = fork()) == 0)
+    {
+        crackHashesWithCheckpoint(p_targets,
+                                  (size_t) numberOfTests,
+                                  &defaultKeyspace,
+                                  p_results,
+                                  1,
+                                  &checkpoint);
+        _exit(0);
+    }
+    while(child > 0 && access(p_path, F_OK) != 0 && waited++ < TEST_CHECKPOINT_TIMEOUT)
+        usleep(1000);
+    if(child > 0)
+    {
+        kill(child,
+             SIGKILL);
+        waitpid(child,
+                NULL,
+                0);
+    }
+    /*
+     *  A count of targets whose buffers wrap around and one beyond the end of
+     *  the file are rejected, and the checkpoint is kept.
+     */
+    for(size_t i = 0; i < sizeof(p_counts) / sizeof(uint64_t); i++)
+        if(patchCheckpointTargets(p_path, &p_targets[0], p_counts[i]) == 0
+           && crackHashesWithCheckpoint(p_targets,
+                                        (size_t) numberOfTests,
+                                        &defaultKeyspace,
+                                        p_results,
+                                        TEST_NUMBER_OF_THREADS,
+                                        &checkpoint) == E_CRACK_BAD_CHECKPOINT
+           && access(p_path, F_OK) == 0)
+            testsPassed++;
+    unlink(p_path);
+    printf("Passed %d/%d!\n", testsPassed,
+                              (int) (sizeof(p_counts) / sizeof(uint64_t)));
+
+    return testsPassed;
+}
+/**
+ * Function: patchCheckpointTargets
+ */
+int patchCheckpointTargets
+(
+    const char        *p_path,
+    const struct hash *p_first,
+    uint64_t          numberOfTargets
+)
+{
+    int           result = 1;
+    long          size;
+    unsigned char *p_data;
+    FILE          *p_file;
+    if((p_file = fopen(p_path, "r+b")) == NULL)
+        return 1;
+    fseek(p_file, 0, SEEK_END);
+    size   = ftell(p_file);
+    p_data = (size > 0) ? malloc((size_t) size) : NULL;
+    rewind(p_file);
+    /*
+     *  The header ends with the counts of targets and classes, right before
+     *  the hash of the first target.
+     */
+    if(p_data != NULL && fread(p_data, 1, (size_t) size, p_file) == (size_t) size)
+    {
+        for(long i = 2 * (long) sizeof(uint64_t); i + (long) sizeof(struct hash) <= size; i++)
+        {
+            if(memcmp(p_data + i, p_first, sizeof(struct hash)) != 0)
+                continue;
+            if(fseek(p_file, i - 2 * (long) sizeof(uint64_t), SEEK_SET) == 0
+               && fwrite(&numberOfTargets, sizeof(uint64_t), 1, p_file) == 1)
+                result = 0;
+            break;
+        }
+    }
+    free(p_data);
+    fclose(p_file);
+
+    return result;
+}
+/**
+ * Function: testProgress
+ */
+int testProgress
+(
+    const struct keyspace *p_keyspace
+)
+{
+    int                   testsPassed = 0;
+    char                  p_result[CRACK_RESULT_SIZE];
+    atomic_uint_fast64_t  numberOfCalls;
+    struct crackProgress  progress;
+    struct keyspaceLayout layout;
+    printf("Testing SHA1-Cracker progress with charset \"%s\" and lengths %u - %u...\n", p_keyspace->p_charset,
+                                                                                          p_keyspace->minLength,
+                                                                                          p_keyspace->maxLength);
+    if(initKeyspaceLayout(&layout, p_keyspace) != 0)
+        return 0;
+    memset(&progress,
+           0,
+           sizeof(progress));
+    progress.callback  = countProgress;
+    progress.p_context = &numberOfCalls;
+    atomic_init(&numberOfCalls, 0);
+    // the unreachable hash sweeps every slice
+    if(crackHashesWithProgress(&unreachableHash,
+                               1,
+                               p_keyspace,
+                               p_result,
+                               TEST_NUMBER_OF_THREADS,
+                               NULL,
+                               &progress) == E_CRACK_NOT_FOUND)
+        testsPassed++;
+    // one call per slice
+    if(atomic_load(&numberOfCalls) == layout.p_firstSlice[layout.maxLength + 1])
+        testsPassed++;
+    if(progress.numberOfCandidates == getNumberOfCandidates(&layout)
+       && atomic_load(&progress.candidatesTested) == progress.numberOfCandidates)
+        testsPassed++;
+    if(atomic_load(&progress.hashesPerSecond) > 0
+       && atomic_load(&progress.secondsRemaining) == 0)
+        testsPassed++;
+    freeKeyspaceLayout(&layout);
+    printf("Passed %d/%d!\n", testsPassed,
+                              4);
+
+    return testsPassed;
+}
+/**
+ * Function: countProgress
+ */
+void countProgress
+(
+    const struct crackProgress *p_progress,
+    void                       *p_context
+)
+{
+    // candidates never exceed the sweep
+    if(atomic_load(&p_progress->candidatesTested) <= p_progress->numberOfCandidates)
+        atomic_fetch_add((atomic_uint_fast64_t *) p_context,
+                         1);
+}
+/**
+ * Function: testScheduler
+ */
+int testScheduler
+(
+    void
+)
+{
+    int                        testsPassed = 0,
+                               isComplete;
+    unsigned int               numberOfStarted;
+    uint64_t                   slice;
+    char                       p_results[(sizeof(testVectors) / sizeof(struct crackSha1TestVec)) * 6];
+    struct hash                p_targets[sizeof(testVectors) / sizeof(struct crackSha1TestVec)];
+    atomic_uint                *p_counts;
+    pthread_t                  p_threads[TEST_NUMBER_OF_THREADS];
+    struct sliceScheduler      scheduler;
+    struct schedulerTestWorker p_workers[TEST_NUMBER_OF_THREADS];
+    printf("Testing SHA1-Cracker work stealing...\n");
+    p_counts = malloc(TEST_SCHEDULER_SLICES * sizeof(atomic_uint));
+    if(p_counts == NULL)
+        return 0;
+    /*
+     *  Every slice is handed out exactly once: with all workers, with only the
+     *  last one (it steals the shares of the others) and with a shared counter.
+     */
+    for(int i = 0; i < 3; i++)
+    {
+        for(unsigned int j = 0; j < TEST_SCHEDULER_SLICES; j++)
+            atomic_init(&p_counts[j], 0);
+        initSliceScheduler(&scheduler,
+                           TEST_NUMBER_OF_THREADS,
+                           TEST_SCHEDULER_FIRST,
+                           TEST_SCHEDULER_FIRST + TEST_SCHEDULER_SLICES,
+                           i < 2);
+        numberOfStarted = 0;
+        for(unsigned int j = (i == 1) ? TEST_NUMBER_OF_THREADS - 1 : 0; j < TEST_NUMBER_OF_THREADS; j++)
+        {
+            p_workers[j].p_scheduler = &scheduler;
+            p_workers[j].worker      = j;
+            p_workers[j].p_counts    = p_counts;
+            if(pthread_create(&p_threads[numberOfStarted], NULL, takeSlices, &p_workers[j]) == 0)
+                numberOfStarted++;
+        }
+        for(unsigned int j = 0; j < numberOfStarted; j++)
+            pthread_join(p_threads[j],
+                         NULL);
+        freeSliceScheduler(&scheduler);
+        isComplete = (numberOfStarted > 0);
+        for(unsigned int j = 0; j < TEST_SCHEDULER_SLICES; j++)
+            if(atomic_load(&p_counts[j]) != 1)
+                isComplete = 0;
+        if(isComplete)
+            testsPassed++;
+    }
+    /*
+     *  A worker that stops after its first slice leaves its share behind. The
+     *  last worker takes the rest and returns once no slice is left, even the
+     *  ones the first worker kept back from a full deque.
+     */
+    for(unsigned int j = 0; j < TEST_SCHEDULER_SLICES; j++)
+        atomic_init(&p_counts[j], 0);
+    initSliceScheduler(&scheduler,
+                       TEST_NUMBER_OF_THREADS,
+                       TEST_SCHEDULER_FIRST,
+                       TEST_SCHEDULER_FIRST + TEST_SCHEDULER_SLICES,
+                       1);
+    p_workers[0].p_scheduler = &scheduler;
+    p_workers[0].worker      = 0;
+    p_workers[0].p_counts    = p_counts;
+    if(getNextSlice(&scheduler, 0, &slice) == 0 && slice == TEST_SCHEDULER_FIRST)
+    {
+        atomic_fetch_add(&p_counts[0],
+                         1);
+        leaveSliceScheduler(&scheduler,
+                            0);
+        p_workers[0].worker = TEST_NUMBER_OF_THREADS - 1;
+        takeSlices(&p_workers[0]);
+        isComplete = 1;
+        for(unsigned int j = 0; j < TEST_SCHEDULER_SLICES; j++)
+            if(atomic_load(&p_counts[j]) > 1)
+                isComplete = 0;
+        if(isComplete)
+            testsPassed++;
+    }
+    freeSliceScheduler(&scheduler);
+    free(p_counts);
+    // a whole sweep with the shared counter
+    setCrackStealing(0);
+    for(size_t i = 0; i < sizeof(testVectors) / sizeof(struct crackSha1TestVec); i++)
+        p_targets[i] = testVectors[i].resultingHash;
+    if(crackHashes(p_targets,
+                   sizeof(testVectors) / sizeof(struct crackSha1TestVec),
+                   p_results,
+                   TEST_NUMBER_OF_THREADS) == 0)
+    {
+        isComplete = 1;
+        for(size_t i = 0; i < sizeof(testVectors) / sizeof(struct crackSha1TestVec); i++)
+            if(memcmp(testVectors[i].p_preImage, &p_results[i * 6], 6) != 0)
+                isComplete = 0;
+        if(isComplete)
+            testsPassed++;
+    }
+    setCrackStealing(1);
+    printf("Passed %d/%d!\n", testsPassed,
+                              5);
+
+    return testsPassed;
+}
+/**
+ * Function: takeSlices
+ */
+void *takeSlices
+(
+    void *p_arg
+)
+{
+    uint64_t                   slice;
+    volatile uint64_t          work;
+    struct schedulerTestWorker *p_worker = p_arg;
+    while(getNextSlice(p_worker->p_scheduler, p_worker->worker, &slice) == 0)
+    {
+        if(slice < TEST_SCHEDULER_FIRST || slice >= TEST_SCHEDULER_FIRST + TEST_SCHEDULER_SLICES)
+            continue;
+        atomic_fetch_add(&p_worker->p_counts[slice - TEST_SCHEDULER_FIRST],
+                         1);
+        // uneven slices, so the workers run out of work at different times
+        for(work = 0; work < (slice % 7) * 100; work++);
+    }
+
+    return NULL;
+}
+/**
+ * Function: testTopology
+ */
+int testTopology
+(
+    void
+)
+{
+    int                  testsPassed   = 0,
+                         isComplete;
+    char                 p_root[]      = TEST_SYSFS_PATH,
+                         p_file[128],
+                         p_text[32];
+    const unsigned int   p_allCpus[]   = { 0, 1, 2, 3 },
+                         p_allNodes[]  = { 0, 0, 1, 1 },
+                         p_maskCpus[]  = { 1, 4, 6 },
+                         p_maskNodes[] = { 0, 0, 1 },
+                         p_flatNodes[] = { 0, 0, 0, 0 };
+    struct crackCpuSet   set,
+                         allowed;
+    struct crackTopology topology;
+    printf("Testing SHA1-Cracker topology...\n");
+    // ranges and single CPUs, up to the line end of the sysfs file
+    if(parseCpuList("0-3,8-11", &set) == 0)
+    {
+        isComplete = 1;
+        for(unsigned int cpu = 0; cpu < 16; cpu++)
+            if(CRACK_CPU_ISSET(&set, cpu) != (cpu < 4 || (cpu >= 8 && cpu < 12)))
+                isComplete = 0;
+        if(isComplete)
+            testsPassed++;
+    }
+    if(parseCpuList("5\n", &set) == 0 && CRACK_CPU_ISSET(&set, 5) && set.p_words[0] == UINT64_C(1) << 5)
+        testsPassed++;
+    // a node without CPUs has an empty list
+    if(parseCpuList("\n", &set) == 0 && set.p_words[0] == 0)
+        testsPassed++;
+    if(parseCpuList("3-1", &set) == E_CRACK_IO
+       && parseCpuList("0-", &set) == E_CRACK_IO
+       && parseCpuList("0,x", &set) == E_CRACK_IO)
+        testsPassed++;
+    /*
+     *  A fake sysfs of 8 hardware threads: 4 cores with 2 siblings each
+     *  ("0,4" to "3,7"), the first two cores on node 0, the others on node 1.
+     */
+    if(mkdtemp(p_root) == NULL)
+    {
+        printf("Could not create %s!\n", p_root);
+        return testsPassed;
+    }
+    for(unsigned int cpu = 0; cpu < 8; cpu++)
+    {
+        sprintf(p_file, "devices/system/cpu/cpu%u/topology/thread_siblings_list", cpu);
+        sprintf(p_text, "%u,%u\n", cpu % 4, cpu % 4 + 4);
+        writeSysfsFile(p_root, p_file, p_text);
+    }
+    writeSysfsFile(p_root, "devices/system/node/node0/cpulist", "0-1,4-5\n");
+    writeSysfsFile(p_root, "devices/system/node/node1/cpulist", "2-3,6-7\n");
+    // all threads allowed: one CPU per core, node by node
+    memset(&allowed,
+           0,
+           sizeof(allowed));
+    for(unsigned int cpu = 0; cpu < 8; cpu++)
+        CRACK_CPU_SET(&allowed, cpu);
+    if(buildCrackTopology(&topology, p_root, &allowed) == 0
+       && isTopology(&topology, 4, p_allCpus, p_allNodes, 2))
+        testsPassed++;
+    // a restricted affinity mask: the first allowed sibling represents the core, 5 is a sibling of 1
+    memset(&allowed,
+           0,
+           sizeof(allowed));
+    CRACK_CPU_SET(&allowed, 1);
+    CRACK_CPU_SET(&allowed, 4);
+    CRACK_CPU_SET(&allowed, 5);
+    CRACK_CPU_SET(&allowed, 6);
+    if(buildCrackTopology(&topology, p_root, &allowed) == 0
+       && isTopology(&topology, 3, p_maskCpus, p_maskNodes, 2))
+        testsPassed++;
+    // without the nodes of a NUMA kernel, every core is on node 0
+    removeSysfsFile(p_root, "devices/system/node/node0/cpulist");
+    removeSysfsFile(p_root, "devices/system/node/node1/cpulist");
+    for(unsigned int cpu = 0; cpu < 8; cpu++)
+        CRACK_CPU_SET(&allowed, cpu);
+    if(buildCrackTopology(&topology, p_root, &allowed) == 0
+       && isTopology(&topology, 4, p_allCpus, p_flatNodes, 1))
+        testsPassed++;
+    for(unsigned int cpu = 0; cpu < 8; cpu++)
+    {
+        sprintf(p_file, "devices/system/cpu/cpu%u/topology/thread_siblings_list", cpu);
+        removeSysfsFile(p_root, p_file);
+    }
+    rmdir(p_root);
+    // the topology of this machine
+    if(getCrackTopology(&topology) == 0 && topology.numberOfCores > 0 && topology.numberOfNodes > 0)
+        testsPassed++;
+    printf("Passed %d/%d!\n", testsPassed,
+                              8);
+
+    return testsPassed;
+}
+/**
+ * Function: isTopology
+ */
+int isTopology
+(
+    const struct crackTopology *p_topology,
+    unsigned int               numberOfCores,
+    const unsigned int         *p_cpus,
+    const unsigned int         *p_nodes,
+    unsigned int               numberOfNodes
+)
+{
+    return p_topology->numberOfCores == numberOfCores
+           && p_topology->numberOfNodes == numberOfNodes
+           && memcmp(p_topology->p_cpus, p_cpus, numberOfCores * sizeof(unsigned int)) == 0
+           && memcmp(p_topology->p_nodes, p_nodes, numberOfCores * sizeof(unsigned int)) == 0;
+}
+/**
+ * Function: writeSysfsFile
+ */
+void writeSysfsFile
+(
+    const char *p_root,
+    const char *p_file,
+    const char *p_text
+)
+{
+    char p_path[256];
+    FILE *p_stream;
+    snprintf(p_path, sizeof(p_path), "%s/%s", p_root, p_file);
+    // the directories of the path, below the root
+    for(char *p_curr = p_path + strlen(p_root) + 1; (p_curr = strchr(p_curr, '/')) != NULL; p_curr++)
+    {
+        *p_curr = '\0';
+        mkdir(p_path, 0700);
+        *p_curr = '/';
+    }
+    if((p_stream = fopen(p_path, "w")) == NULL)
+        return;
+    fputs(p_text,
+          p_stream);
+    fclose(p_stream);
+}
+/**
+ * Function: removeSysfsFile
+ */
+void removeSysfsFile
+(
+    const char *p_root,
+    const char *p_file
+)
+{
+    char p_path[256],
+         *p_curr;
+    snprintf(p_path, sizeof(p_path), "%s/%s", p_root, p_file);
+    unlink(p_path);
+    // directories that are empty now, up to the root
+    while((p_curr = strrchr(p_path, '/')) != NULL && p_curr > p_path + strlen(p_root))
+    {
+        *p_curr = '\0';
+        if(rmdir(p_path) != 0)
+            break;
+    }
+}
+/**
+ * Function: testPlacement
+ */
+int testPlacement
+(
+    void
+)
+{
+    int                  testsPassed      = 0,
+                         wasPlaced        = getCrackPlacement(),
+                         numberOfPinned   = 0,
+                         numberOfDistinct = 0,
+                         p_pipe[2],
+                         p_cpus[TEST_NUMBER_OF_PROCESSES],
+                         status;
+    pid_t                child;
+    struct crackTopology topology;
+    printf("Testing SHA1-Cracker placement...\n");
+    setCrackPlacement(1);
+    // only one sweep at a time pins its workers
+    if(claimCrackPlacement() == 0)
+    {
+        if(claimCrackPlacement() != 0)
+            testsPassed++;
+        releaseCrackPlacement();
+        if(claimCrackPlacement() == 0)
+        {
+            testsPassed++;
+            releaseCrackPlacement();
+        }
+    }
+    /*
+     *  Worker processes pin themselves like the shard workers do and report
+     *  the only core their sweeps would see (-1 if they see more or none).
+     */
+    if(getCrackTopology(&topology) == 0 && pipe(p_pipe) == 0)
+    {
+        for(int i = 0; i < TEST_NUMBER_OF_PROCESSES; i++)
+        {
+            if((child = fork()) == 0)
+            {
+                struct crackTopology pinned;
+                int                  cpu = -1;
+                close(p_pipe[0]);
+                if(pinCrackProcess((unsigned int) i) == 0
+                   && getCrackTopology(&pinned) == 0
+                   && pinned.numberOfCores == 1)
+                    cpu = (int) pinned.p_cpus[0];
+                _exit(write(p_pipe[1], &cpu, sizeof(cpu)) == sizeof(cpu) ? 0 : 1);
+            }
+            if(child > 0)
+                waitpid(child,
+                        &status,
+                        0);
+            if(child < 0 || read(p_pipe[0], &p_cpus[i], sizeof(int)) != sizeof(int))
+                p_cpus[i] = -1;
+        }
+        close(p_pipe[0]);
+        close(p_pipe[1]);
+        // one core each, all different as long as there are enough cores
+        for(int i = 0; i < TEST_NUMBER_OF_PROCESSES; i++)
+        {
+            if(p_cpus[i] < 0)
+                continue;
+            numberOfPinned++;
+            numberOfDistinct++;
+            for(int j = 0; j < i; j++)
+                if(p_cpus[j] == p_cpus[i])
+                {
+                    numberOfDistinct--;
+                    break;
+                }
+        }
+        if(numberOfPinned == TEST_NUMBER_OF_PROCESSES
+           && (unsigned int) numberOfDistinct == ((topology.numberOfCores < TEST_NUMBER_OF_PROCESSES) ? topology.numberOfCores
+                                                                                                       : TEST_NUMBER_OF_PROCESSES))
+            testsPassed++;
+    }
+    // without placement, nothing is claimed or pinned
+    setCrackPlacement(0);
+    if(claimCrackPlacement() != 0 && pinCrackProcess(0) != 0)
+        testsPassed++;
+    setCrackPlacement(wasPlaced);
+    printf("Passed %d/%d!\n", testsPassed,
+                              4);
+
+    return testsPassed;
+}
+/**
+ * Function: testSha1
+ */
+int testSha1
+(
+    const char *p_engine
+)
+{
+    int          testsPassed     = 0,
+                 numberOfVectors = sizeof(sha1TestVectors) / sizeof(struct crackSha1TestVec),
+                 numberOfShort   = sizeof(shortTestVectors) / sizeof(struct crackSha1TestVec);
+    const char   *p_best         = getSha1EngineName(),
+                 *pp_messages[TEST_MAX_KEYSPACE_VECTORS];
+    unsigned int p_lengths[TEST_MAX_KEYSPACE_VECTORS];
+    struct hash  p_digests[TEST_MAX_KEYSPACE_VECTORS];
+    char         *p_million;
+    if(selectSha1Engine(p_engine) != 0)
+    {
+        printf("SHA-1 engine %s is not supported!\n", p_engine);
+        return 0;
+    }
+    printf("Testing SHA-1 engine %s...\n", p_engine);
+    for(int i = 0; i < numberOfVectors; i++)
+        if(sha1Verify(sha1TestVectors[i].p_preImage,
+                      strlen(sha1TestVectors[i].p_preImage),
+                      &sha1TestVectors[i].resultingHash) == 0)
+            testsPassed++;
+    // many blocks, hashed in place
+    p_million = malloc(1000000);
+    if(p_million != NULL)
+    {
+        memset(p_million,
+               'a',
+               1000000);
+        if(sha1Verify(p_million, 1000000, &millionHash) == 0)
+            testsPassed++;
+        free(p_million);
+    }
+    // the preimages of the keyspace tests fill the lanes of the multi-buffer engines
+    for(int i = 0; i < numberOfShort; i++)
+    {
+        pp_messages[i] = shortTestVectors[i].p_preImage;
+        p_lengths[i]   = (unsigned int) strlen(shortTestVectors[i].p_preImage);
+    }
+    sha1Multi(pp_messages,
+              p_lengths,
+              numberOfShort,
+              p_digests);
+    for(int i = 0; i < numberOfShort; i++)
+        if(memcmp(&p_digests[i],
+                  &shortTestVectors[i].resultingHash,
+                  sizeof(struct hash)) == 0)
+            testsPassed++;
+    // a wrong preimage is rejected
+    if(sha1Verify("abd", 3, &sha1TestVectors[0].resultingHash) == E_CRACK_NOT_FOUND)
+        testsPassed++;
+    selectSha1Engine(p_best);
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfVectors + numberOfShort + 2);
+
+    return testsPassed;
+}
+/**
+ * Function: testWordlist
+ */
+int testWordlist
+(
+    void
+)
+{
+    int         testsPassed     = 0,
+                numberOfTests   = sizeof(testVectors) / sizeof(struct crackSha1TestVec),
+                numberOfShort   = sizeof(shortTestVectors) / sizeof(struct crackSha1TestVec),
+                numberOfTargets = numberOfTests + numberOfShort + 2,
+                fd;
+    char        p_path[]        = TEST_WORDLIST_PATH,
+                p_longWord[101],
+                *p_results;
+    struct hash p_targets[2 * TEST_MAX_KEYSPACE_VECTORS];
+    FILE        *p_file;
+    printf("Testing SHA1-Cracker with a wordlist...\n");
+    if((fd = mkstemp(p_path)) < 0 || (p_file = fdopen(fd, "w")) == NULL)
+    {
+        printf("Could not create %s!\n", p_path);
+        return 0;
+    }
+    // a word that needs two blocks, hashed by sha1 for its target
+    memset(p_longWord,
+           'w',
+           sizeof(p_longWord) - 1);
+    p_longWord[sizeof(p_longWord) - 1] = '\0';
+    for(int i = 0; i < numberOfTests; i++)
+        p_targets[i] = testVectors[i].resultingHash;
+    for(int i = 0; i < numberOfShort; i++)
+        p_targets[numberOfTests + i] = shortTestVectors[i].resultingHash;
+    sha1(p_longWord,
+         strlen(p_longWord),
+         &p_targets[numberOfTests + numberOfShort]);
+    p_targets[numberOfTests + numberOfShort + 1] = unreachableHash;
+    /*
+     *  Filler lines of 9 bytes, except for the first test vector: it starts 4
+     *  bytes before the end of the first chunk. The other words follow with
+     *  mixed line endings, the long word ends the file without a newline.
+     */
+    for(int i = 0; i < TEST_WORDLIST_LINES; i++)
+    {
+        if(i == CRACK_WORDLIST_CHUNK_SIZE / 9)
+            fprintf(p_file, "%s\n", testVectors[0].p_preImage);
+        else
+            fprintf(p_file, "f%07d\n", i);
+    }
+    for(int i = 1; i < numberOfTests; i++)
+        fprintf(p_file, "%s\r\n", testVectors[i].p_preImage);
+    for(int i = 0; i < numberOfShort; i++)
+        fprintf(p_file, "%s\n", shortTestVectors[i].p_preImage);
+    fprintf(p_file, "%s", p_longWord);
+    fclose(p_file);
+    p_results = malloc((size_t) numberOfTargets * CRACK_WORD_RESULT_SIZE);
+    if(p_results != NULL
+       && crackHashesInWordlist(p_targets,
+                                (size_t) numberOfTargets,
+                                p_path,
+                                p_results,
+                                TEST_NUMBER_OF_THREADS) == E_CRACK_NOT_FOUND)
+    {
+        for(int i = 0; i < numberOfTests; i++)
+            if(strcmp(testVectors[i].p_preImage,
+                      &p_results[i * CRACK_WORD_RESULT_SIZE]) == 0)
+                testsPassed++;
+        for(int i = 0; i < numberOfShort; i++)
+            if(strcmp(shortTestVectors[i].p_preImage,
+                      &p_results[(numberOfTests + i) * CRACK_WORD_RESULT_SIZE]) == 0)
+                testsPassed++;
+        if(strcmp(p_longWord,
+                  &p_results[(numberOfTests + numberOfShort) * CRACK_WORD_RESULT_SIZE]) == 0)
+            testsPassed++;
+        // the unreachable hash must come back empty
+        if(p_results[(numberOfTargets - 1) * CRACK_WORD_RESULT_SIZE] == '\0')
+            testsPassed++;
+    }
+    free(p_results);
+    unlink(p_path);
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTargets);
+
+    return testsPassed;
+}
+/**
+ * Function: testDaemon
+ */
+int testDaemon
+(
+    const struct keyspace         *p_keyspace,
+    const struct crackSha1TestVec *p_testVectors,
+    int                           numberOfTests
+)
+{
+    int         testsPassed    = 0,
+                numberOfLines  = 0,
+                status         = -1,
+                p_input[2],
+                p_output[2];
+    char        p_text[(TEST_MAX_KEYSPACE_VECTORS + 4) * 48],
+                p_received[(TEST_MAX_KEYSPACE_VECTORS + 1) * (42 + CRACK_RESULT_SIZE) + 1],
+                p_line[42 + CRACK_RESULT_SIZE];
+    size_t      length         = 0,
+                receivedLength = 0,
+                numberOfHashes = 0;
+    ssize_t     received;
+    pid_t       child;
+    struct hash p_hashes[TEST_MAX_KEYSPACE_VECTORS];
+    printf("Testing SHA1-Cracker with a daemon...\n");
+    // upper and lower case digits, \r\n and lines that are no digest, the last line is incomplete
+    for(int i = 0; i < numberOfTests; i++)
+        length += (size_t) sprintf(p_text + length,
+                                   (i % 2 == 0) ? "%08x%08x%08x%08x%08x\n" : "%08X%08X%08X%08X%08X\r\n",
+                                   p_testVectors[i].resultingHash.a,
+                                   p_testVectors[i].resultingHash.b,
+                                   p_testVectors[i].resultingHash.c,
+                                   p_testVectors[i].resultingHash.d,
+                                   p_testVectors[i].resultingHash.e);
+    length += (size_t) sprintf(p_text + length, "da39a3ee5e6b4b0d3255bfef95601890afd8070g\n"
+                                                "da39a3ee5e6b4b0d3255bfef95601890afd807\n"
+                                                "\x1a" "a39a3ee5e6b4b0d3255bfef95601890afd80709\n\n"
+                                                "da39a3ee");
+    if(parseHashes(p_text, length, p_hashes, TEST_MAX_KEYSPACE_VECTORS, &numberOfHashes) == length - 8
+       && numberOfHashes == (size_t) numberOfTests
+       && memcmp(p_hashes, &p_testVectors[0].resultingHash, sizeof(struct hash)) == 0
+       && memcmp(&p_hashes[numberOfTests - 1], &p_testVectors[numberOfTests - 1].resultingHash, sizeof(struct hash)) == 0)
+        testsPassed++;
+    if(pipe(p_input) != 0 || pipe(p_output) != 0)
+        return testsPassed;
+    if((child = fork()) == 0)
+    {
+        close(p_input[1]);
+        close(p_output[0]);
+        _exit(runCrackDaemon(p_input[0],
+                             p_output[1],
+                             p_keyspace,
+                             TEST_NUMBER_OF_THREADS));
+    }
+    close(p_input[0]);
+    close(p_output[1]);
+    // the first half and the unreachable hash are answered before the rest is sent
+    for(int i = 0; i <= numberOfTests; i++)
+    {
+        if(i == numberOfTests / 2)
+        {
+            length = (size_t) sprintf(p_text, "%08x%08x%08x%08x%08x\n", unreachableHash.a,
+                                                                         unreachableHash.b,
+                                                                         unreachableHash.c,
+                                                                         unreachableHash.d,
+                                                                         unreachableHash.e);
+            if(write(p_input[1], p_text, length) != (ssize_t) length)
+                break;
+            while(numberOfLines < numberOfTests / 2 + 1
+                  && (received = read(p_output[0], p_received + receivedLength, sizeof(p_received) - 1 - receivedLength)) > 0)
+            {
+                for(ssize_t j = 0; j < received; j++)
+                    numberOfLines += (p_received[receivedLength + (size_t) j] == '\n');
+                receivedLength += (size_t) received;
+            }
+        }
+        if(i == numberOfTests)
+            break;
+        length = (size_t) sprintf(p_text, "%08x%08x%08x%08x%08x\n", p_testVectors[i].resultingHash.a,
+                                                                     p_testVectors[i].resultingHash.b,
+                                                                     p_testVectors[i].resultingHash.c,
+                                                                     p_testVectors[i].resultingHash.d,
+                                                                     p_testVectors[i].resultingHash.e);
+        if(write(p_input[1], p_text, length) != (ssize_t) length)
+            break;
+    }
+    // the daemon exits once its input ended and every digest is answered
+    close(p_input[1]);
+    while((received = read(p_output[0], p_received + receivedLength, sizeof(p_received) - 1 - receivedLength)) > 0)
+        receivedLength += (size_t) received;
+    p_received[receivedLength] = '\0';
+    close(p_output[0]);
+    if(child > 0)
+        waitpid(child,
+                &status,
+                0);
+    for(int i = 0; i < numberOfTests; i++)
+    {
+        sprintf(p_line, "%08x%08x%08x%08x%08x:%s\n", p_testVectors[i].resultingHash.a,
+                                                     p_testVectors[i].resultingHash.b,
+                                                     p_testVectors[i].resultingHash.c,
+                                                     p_testVectors[i].resultingHash.d,
+                                                     p_testVectors[i].resultingHash.e,
+                                                     p_testVectors[i].p_preImage);
+        if(strstr(p_received, p_line) != NULL)
+            testsPassed++;
+        else
+            printf("\nExpected: %s", p_line);
+    }
+    // the unreachable hash comes back without a preimage, and before the second half
+    sprintf(p_line, "%08x%08x%08x%08x%08x\n", unreachableHash.a,
+                                              unreachableHash.b,
+                                              unreachableHash.c,
+                                              unreachableHash.d,
+                                              unreachableHash.e);
+    if(strstr(p_received, p_line) != NULL && numberOfLines == numberOfTests / 2 + 1)
+        testsPassed++;
+    if(WIFEXITED(status) && WEXITSTATUS(status) == 0)
+        testsPassed++;
+    printf("Passed %d/%d!\n", testsPassed,
+                              numberOfTests + 3);
+
+    return testsPassed;
+}
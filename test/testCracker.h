@@ -24,6 +24,38 @@
 #include <string.h>
 // clock, clock_t
 #include <time.h>
+// mkstemp, mkdtemp
+#include <stdlib.h>
+// close, unlink, rmdir, fork, usleep, access, pipe, read, write
+#include <unistd.h>
+// kill, SIGKILL
+#include <signal.h>
+// waitpid
+#include <sys/wait.h>
+// mkdir
+#include <sys/stat.h>
+
+// number of worker threads for the parallel tests
+#define TEST_NUMBER_OF_THREADS 4
+// number of worker processes for the sharded tests
+#define TEST_NUMBER_OF_PROCESSES 4
+// upper bound for the number of test vectors per keyspace
+#define TEST_MAX_KEYSPACE_VECTORS 16
+// template for the temporary lookup table file
+#define TEST_TABLE_PATH "/tmp/testCracker-XXXXXX"
+// template for the temporary wordlist file
+#define TEST_WORDLIST_PATH "/tmp/testCracker-XXXXXX"
+// template for the temporary sysfs tree of the topology tests
+#define TEST_SYSFS_PATH "/tmp/testCracker-XXXXXX"
+// filler lines of the wordlist (spread over three chunks)
+#define TEST_WORDLIST_LINES 300000
+// characters of the appended pairs of the rules test ($X$Y for every pair, more than 8 lanes x 56 rules)
+#define TEST_RULE_CHARSET "0123456789abcdefghijklmnopqrstuvwxyz"
+// milliseconds to wait for the first checkpoint of the interrupted sweep
+#define TEST_CHECKPOINT_TIMEOUT 60000
+// slices handed out by the scheduler tests (behind TEST_SCHEDULER_FIRST)
+#define TEST_SCHEDULER_SLICES 100000
+#define TEST_SCHEDULER_FIRST 7
 
 struct crackSha1TestVec
 {
@@ -31,4 +63,13 @@ struct crackSha1TestVec
     struct hash resultingHash;
 };
 
+// worker of the scheduler tests
+struct schedulerTestWorker
+{
+    struct sliceScheduler *p_scheduler;
+    unsigned int          worker;
+    // times every slice was handed out
+    atomic_uint           *p_counts;
+};
+
 #endif